@@ -306,6 +306,29 @@ namespace PluginHost {
                 Core::JSON::String PluginConfigPath;
             };
 
+            // permessage-deflate on the websockets of the channels, if the client offers it.
+            class CompressionConfig : public Core::JSON::Container {
+            public:
+                CompressionConfig(const CompressionConfig&) = delete;
+                CompressionConfig& operator=(const CompressionConfig&) = delete;
+
+                CompressionConfig()
+                    : Core::JSON::Container()
+                    , WindowBits(15)
+                    , NoContextTakeover(false)
+                    , Threshold(128)
+                {
+                    Add(_T("windowbits"), &WindowBits);
+                    Add(_T("nocontexttakeover"), &NoContextTakeover);
+                    Add(_T("threshold"), &Threshold);
+                }
+                ~CompressionConfig() override = default;
+
+                Core::JSON::DecUInt8 WindowBits;
+                Core::JSON::Boolean NoContextTakeover;
+                Core::JSON::DecUInt16 Threshold;
+            };
+
 #ifdef HIBERNATE_SUPPORT_ENABLED
             class HibernateConfig : public Core::JSON::Container {
             public:
@@ -377,8 +400,10 @@ namespace PluginHost {
                 , SoftKillCheckWaitTime(10)
                 , HardKillCheckWaitTime(4)
                 , OutOfProcessWaitTime(3)
+                , Reactors(1)
                 , IPV6(false)
                 , LegacyInitialize(false)
+                , ParallelStartup(0)
                 , DefaultMessagingCategories(false)
                 , Process()
                 , Input()
@@ -391,6 +416,7 @@ namespace PluginHost {
                 , DelegatedReleases(true)
                 , Throttle(DefaultThrottle)
                 , ChannelThrottle(DefaultThrottle)
+                , Compression()
 #ifdef PROCESSCONTAINERS_ENABLED
                 , ProcessContainers()
 #endif
@@ -418,8 +444,10 @@ namespace PluginHost {
                 Add(_T("softkillcheckwaittime"), &SoftKillCheckWaitTime);
                 Add(_T("hardkillcheckwaittime"), &HardKillCheckWaitTime);
                 Add(_T("outofprocesswaittime"), &OutOfProcessWaitTime);
+                Add(_T("reactors"), &Reactors);
                 Add(_T("ipv6"), &IPV6);
                 Add(_T("legacyinitialize"), &LegacyInitialize);
+                Add(_T("parallelstartup"), &ParallelStartup);
                 Add(_T("messaging"), &DefaultMessagingCategories);
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
@@ -434,6 +462,7 @@ namespace PluginHost {
                 Add(_T("ccdr"), &DelegatedReleases); /* COMRPC channel delegated releases */
                 Add(_T("throttle"), &Throttle);
                 Add(_T("channel_throttle"), &ChannelThrottle);
+                Add(_T("compression"), &Compression);
 #ifdef PROCESSCONTAINERS_ENABLED
                 Add(_T("processcontainers"), &ProcessContainers);
 #endif
@@ -466,8 +495,10 @@ namespace PluginHost {
             Core::JSON::DecUInt8 SoftKillCheckWaitTime;
             Core::JSON::DecUInt8 HardKillCheckWaitTime;
             Core::JSON::DecUInt8 OutOfProcessWaitTime;
+            Core::JSON::DecUInt8 Reactors;
             Core::JSON::Boolean IPV6;
             Core::JSON::Boolean LegacyInitialize;
+            Core::JSON::DecUInt8 ParallelStartup;
             Core::JSON::String DefaultMessagingCategories; 
             ProcessSet Process;
             InputConfig Input;
@@ -481,6 +512,7 @@ namespace PluginHost {
             Core::JSON::Boolean DelegatedReleases;
             Core::JSON::DecUInt8 Throttle;
             Core::JSON::DecUInt8 ChannelThrottle;
+            CompressionConfig Compression;
 #ifdef PROCESSCONTAINERS_ENABLED
             Core::JSON::String ProcessContainers;
 #endif
@@ -635,10 +667,12 @@ namespace PluginHost {
             , _portNumber(0)
             , _IPV6()
             , _legacyInitialize(false)
+            , _parallelStartup(0)
             , _idleTime(180)
             , _softKillCheckWaitTime(3)
             , _hardKillCheckWaitTime(10)
             , _outOfProcessWaitTime(3000)
+            , _reactors(1)
             , _stackSize(0)
             , _inputInfo()
             , _processInfo()
@@ -649,6 +683,7 @@ namespace PluginHost {
             , _delegatedReleases(true)
             , _throttle(DefaultThrottle)
             , _channelThrottle(DefaultThrottle)
+            , _compression()
 #ifdef PROCESSCONTAINERS_ENABLED
             , _processContainersConfig()
 #endif
@@ -690,8 +725,10 @@ namespace PluginHost {
                 _softKillCheckWaitTime = config.SoftKillCheckWaitTime.Value();
                 _hardKillCheckWaitTime = config.HardKillCheckWaitTime.Value();
                 _outOfProcessWaitTime = config.OutOfProcessWaitTime.Value() * 1000; // Move to milliseconds
+                _reactors = (config.Reactors.Value() == 0 ? 1 : config.Reactors.Value());
                 _IPV6 = config.IPV6.Value();
                 _legacyInitialize = config.LegacyInitialize.Value();
+                _parallelStartup = config.ParallelStartup.Value();
                 _binding = config.Binding.Value();
                 _interface = config.Interface.Value();
                 _portNumber = config.Port.Value();
@@ -702,6 +739,15 @@ namespace PluginHost {
                 _delegatedReleases = config.DelegatedReleases.Value();
                 _throttle = config.Throttle.Value();
                 _channelThrottle = config.ChannelThrottle.Value();
+                if (config.Compression.IsSet() == true) {
+                    Web::WebSocket::Deflate::Settings settings;
+
+                    settings.serverMaxWindowBits = std::max(static_cast<uint8_t>(9), std::min(config.Compression.WindowBits.Value(), static_cast<uint8_t>(15)));
+                    settings.serverNoContextTakeover = config.Compression.NoContextTakeover.Value();
+                    settings.threshold = config.Compression.Threshold.Value();
+
+                    _compression = settings;
+                }
                 if( config.Latitude.IsSet() || config.Longitude.IsSet() ) {
                     SYSLOG(Logging::Error, (_T("Support for Latitude and Longitude moved from Thunder configuration to plugin providing ILocation support")));
                 }
@@ -897,6 +943,9 @@ namespace PluginHost {
         inline uint16_t OutOfProcessWaitTime() const {
             return _outOfProcessWaitTime;
         }
+        inline uint8_t Reactors() const {
+            return _reactors;
+        }
         inline const string& URL() const {
             return (_URL);
         }
@@ -915,6 +964,9 @@ namespace PluginHost {
         inline uint8_t ChannelThrottle() const {
             return(_channelThrottle);
         }
+        inline const Core::OptionalType<Web::WebSocket::Deflate::Settings>& Compression() const {
+            return(_compression);
+        }
         inline const InputInfo& Input() const {
             return(_inputInfo);
         }
@@ -927,6 +979,9 @@ namespace PluginHost {
         inline bool LegacyInitialize() const {
             return (_legacyInitialize);
         }
+        inline uint8_t ParallelStartup() const {
+            return (_parallelStartup);
+        }
 
         const Plugin::Config* Plugin(const string& name) const {
             Core::JSON::ArrayType<Plugin::Config>::ConstIterator index(_plugins.Elements());
@@ -1081,10 +1136,12 @@ namespace PluginHost {
         uint16_t _portNumber;
         bool _IPV6;
         bool _legacyInitialize;
+        uint8_t _parallelStartup;
         uint16_t _idleTime;
         uint8_t _softKillCheckWaitTime;
         uint8_t _hardKillCheckWaitTime;
         uint16_t _outOfProcessWaitTime;
+        uint8_t _reactors;
         uint32_t _stackSize;
         InputInfo _inputInfo;
         ProcessInfo _processInfo;
@@ -1095,6 +1152,7 @@ namespace PluginHost {
         bool _delegatedReleases;
         uint8_t _throttle;
         uint8_t _channelThrottle;
+        Core::OptionalType<Web::WebSocket::Deflate::Settings> _compression;
 
 #ifdef PROCESSCONTAINERS_ENABLED
         string _processContainersConfig;
@@ -1268,6 +1268,15 @@ namespace Plugin {
                 threads.push_back({ PluginHost::Metadata::InstanceId(entry.Id.Value()), entry.Job.Value(), entry.Runs.Value() });
             }
 
+            // The reactors report their load as the number of resources they handle.
+            auto reactor = meta.Reactors.Elements();
+
+            while (reactor.Next() == true) {
+                auto const& entry = reactor.Current();
+                threads.push_back({ PluginHost::Metadata::InstanceId(entry.Id.Value()), 
+                    _T("ResourceMonitor [") + Core::NumberType<uint32_t>(entry.Resources.Value()).Text() + _T(" resources]"), entry.Runs.Value() });
+            }
+
             using Iterator = IMetadata::Data::IThreadsIterator;
 
             outThreads = Core::ServiceType<RPC::IteratorType<Iterator>>::Create<Iterator>(threads);
@@ -0,0 +1,250 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Only depends on core and messaging, so it can be used outside of the Thunder process (unit tests) as well.
+#include <core/core.h>
+#include <messaging/messaging.h>
+
+namespace Thunder {
+namespace PluginHost {
+
+    // Runs an action (Launch) for a set of services on the workerpool, with at most "slots" of them in parallel. A
+    // service is only handed to the workerpool once all services it follows (see Follow) have completed. The
+    // workerpool must be running, Run() blocks till all services have been launched.
+    // The SERVICE handle should give access to StartupOrder(), SubSystemDependencies() (a bitmask),
+    // SubSystemControl() (a list of subsystems) and Callsign().
+    template <typename SERVICE>
+    class LauncherType {
+    private:
+        class Node {
+        public:
+            Node() = delete;
+            Node(Node&&) = delete;
+            Node(const Node&) = delete;
+            Node& operator=(Node&&) = delete;
+            Node& operator=(const Node&) = delete;
+
+            Node(LauncherType<SERVICE>& parent, const SERVICE& service)
+                : _parent(parent)
+                , _service(service)
+                , _pending(0)
+                , _followers()
+                , _job(*this)
+            {
+            }
+            ~Node() = default;
+
+        public:
+            inline const SERVICE& Source() const
+            {
+                return (_service);
+            }
+            inline uint32_t Pending() const
+            {
+                return (_pending);
+            }
+            inline const std::vector<Node*>& Followers() const
+            {
+                return (_followers);
+            }
+            inline void Precedes(Node& follower)
+            {
+                _followers.push_back(&follower);
+                follower._pending++;
+            }
+            // Returns true if this was the last node this node was waiting for.
+            inline bool Release()
+            {
+                return ((_pending != 0) && (--_pending == 0));
+            }
+            inline void Unblock()
+            {
+                _pending = 0;
+            }
+            inline void Submit()
+            {
+                _job.Submit();
+            }
+
+        private:
+            friend class Core::ThreadPool::JobType<Node&>;
+
+            string JobIdentifier() const
+            {
+                return (_T("Thunder::PluginHost::LauncherType::Node"));
+            }
+            void Dispatch()
+            {
+                _parent.Process(*this);
+            }
+
+        private:
+            LauncherType<SERVICE>& _parent;
+            SERVICE _service;
+            uint32_t _pending;
+            std::vector<Node*> _followers;
+            Core::WorkerPool::JobType<Node&> _job;
+        };
+
+        using Nodes = std::list<Node>;
+
+    public:
+        LauncherType() = delete;
+        LauncherType(LauncherType<SERVICE>&&) = delete;
+        LauncherType(const LauncherType<SERVICE>&) = delete;
+        LauncherType<SERVICE>& operator=(LauncherType<SERVICE>&&) = delete;
+        LauncherType<SERVICE>& operator=(const LauncherType<SERVICE>&) = delete;
+
+        LauncherType(const uint8_t slots)
+            : _lock()
+            , _done(false, true)
+            , _slots(slots == 0 ? 1 : slots)
+            , _running(0)
+            , _remaining(0)
+            , _nodes()
+            , _ready()
+        {
+        }
+        virtual ~LauncherType() = default;
+
+    public:
+        void Add(const SERVICE& service)
+        {
+            _nodes.emplace_back(*this, service);
+        }
+        // Make sure the services are added in their startup order: a service follows all services with a
+        // lower startup order and all services with the same (or lower) startup order controlling a subsystem
+        // it depends upon.
+        void Follow()
+        {
+            for (Node& follower : _nodes) {
+                const uint32_t order(follower.Source()->StartupOrder());
+                const uint32_t dependencies(follower.Source()->SubSystemDependencies());
+
+                for (Node& leader : _nodes) {
+                    if (&leader != &follower) {
+                        const uint32_t leaderOrder(leader.Source()->StartupOrder());
+
+                        if (leaderOrder < order) {
+                            leader.Precedes(follower);
+                        }
+                        else if ((leaderOrder == order) && (dependencies != 0)) {
+                            uint32_t controls = 0;
+
+                            for (const auto& entry : leader.Source()->SubSystemControl()) {
+                                controls |= (1 << entry);
+                            }
+
+                            if ((controls & dependencies) != 0) {
+                                leader.Precedes(follower);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        // Blocking call, returns once the action has been completed for all added services.
+        void Run()
+        {
+            _lock.Lock();
+
+            _remaining = static_cast<uint32_t>(_nodes.size());
+
+            for (Node& node : _nodes) {
+                if (node.Pending() == 0) {
+                    _ready.push_back(&node);
+                }
+            }
+
+            Schedule();
+
+            _lock.Unlock();
+
+            _done.Lock(Core::infinite);
+        }
+
+    private:
+        virtual void Launch(const SERVICE& service) = 0;
+
+        void Process(Node& node)
+        {
+            Launch(node.Source());
+
+            _lock.Lock();
+
+            ASSERT((_running > 0) && (_remaining > 0));
+
+            _running--;
+            _remaining--;
+
+            for (Node* follower : node.Followers()) {
+                if (follower->Release() == true) {
+                    _ready.push_back(follower);
+                }
+            }
+
+            Schedule();
+
+            _lock.Unlock();
+        }
+        void Schedule()
+        {
+            if ((_ready.empty() == true) && (_running == 0) && (_remaining != 0)) {
+                // Nothing can run, but there is still work, so the subsystem dependencies are circular. Let the
+                // first one waiting go, if its preconditions are not met it will be activated once they are.
+                typename Nodes::iterator index(_nodes.begin());
+
+                while ((index != _nodes.end()) && (index->Pending() == 0)) {
+                    index++;
+                }
+
+                ASSERT(index != _nodes.end());
+
+                SYSLOG(Logging::Startup, (_T("Circular subsystem dependency detected, starting plugin [%s] out of order"), index->Source()->Callsign().c_str()));
+
+                index->Unblock();
+                _ready.push_back(&(*index));
+            }
+
+            while ((_running < _slots) && (_ready.empty() == false)) {
+                Node* node = _ready.front();
+                _ready.pop_front();
+                _running++;
+                node->Submit();
+            }
+
+            if (_remaining == 0) {
+                _done.SetEvent();
+            }
+        }
+
+    private:
+        Core::CriticalSection _lock;
+        Core::Event _done;
+        const uint8_t _slots;
+        uint8_t _running;
+        uint32_t _remaining;
+        Nodes _nodes;
+        std::list<Node*> _ready;
+    };
+
+}
+}
@@ -629,6 +629,11 @@ POP_WARNING()
                 myself.Policy(_config->Process().Policy());
             }
 
+            // Spread the socket handling over the requested number of reactors, before any socket is opened.
+            if (Core::ResourceMonitor::Instance().Reactors(_config->Reactors()) != Core::ERROR_NONE) {
+                SYSLOG(Logging::Startup, (_T("Could not change the number of reactors to %d, resources are already monitored."), _config->Reactors()));
+            }
+
             // Time to start loading the config of the plugins.
             string pluginPath(_config->ConfigsPath());
 
@@ -737,7 +742,13 @@ POP_WARNING()
                             printf("State:      %s\n", Core::EnumerateType<Metadata::Channel::state>(index.Current().State.Value()).Data());
                             printf("Active:     %s\n", (index.Current().Activity.Value() == true ? _T("true") : _T("false")));
                             printf("Remote:     %s\n", (index.Current().Remote.Value().c_str()));
-                            printf("Name:       %s\n\n", (index.Current().Name.Value().c_str()));
+                            printf("Name:       %s\n", (index.Current().Name.Value().c_str()));
+                            if (index.Current().Deflate.IsSet() == true) {
+                                const Metadata::Channel::Compression& deflate(index.Current().Deflate);
+                                printf("Deflate:    out %u messages, %" PRIu64 " -> %" PRIu64 " bytes in %" PRIu64 " uS\n", deflate.MessagesOut.Value(), deflate.RawOut.Value(), deflate.DeflatedOut.Value(), deflate.DeflateTime.Value());
+                                printf("            in  %u messages, %" PRIu64 " -> %" PRIu64 " bytes in %" PRIu64 " uS\n", deflate.MessagesIn.Value(), deflate.DeflatedIn.Value(), deflate.RawIn.Value(), deflate.InflateTime.Value());
+                            }
+                            printf("\n");
                         }
                         break;
                     }
@@ -750,6 +761,17 @@ POP_WARNING()
                         printf("HTTP responses:   %d\n", responses);
                         printf("HTTP Files:       %d\n", filebodies);
                         printf("JSONRPC messages: %d\n", jsonrequests);
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+                        Core::ProxyAllocator::Statistics classes[Core::ProxyAllocator::Classes];
+                        uint32_t oversized = Core::ProxyAllocator::Snapshot(classes);
+                        printf("\nProxyObject size classes:\n");
+                        printf("============================================================\n");
+                        printf("  Size   Reserved  Available   Refills\n");
+                        for (uint8_t index = 0; index < Core::ProxyAllocator::Classes; index++) {
+                            printf("%6u %10u %10u %9u\n", classes[index].size, classes[index].reserved, classes[index].available, classes[index].refills);
+                        }
+                        printf("Oversized: %u\n", oversized);
+#endif
 
                         break;
                     }
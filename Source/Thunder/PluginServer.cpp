@@ -216,6 +216,14 @@ namespace PluginHost {
             else {
                 newInfo.State = (client->IsWebSocket() ? ((client->State() == PluginHost::Channel::RAW) ? Metadata::Channel::state::RAWSOCKET : Metadata::Channel::state::WEBSOCKET) : (client->IsWebServer() ? Metadata::Channel::state::WEBSERVER : Metadata::Channel::state::SUSPENDED));
             }
+            if (client->IsWebSocket() == true) {
+                const Web::WebSocket::Deflate::Statistics counters(client->Compression());
+
+                // Only links that actually (de)compressed a message report on it.
+                if ((counters.messagesOut != 0) || (counters.messagesIn != 0)) {
+                    newInfo.Deflate = counters;
+                }
+            }
             string name = client->Path();
 
             if (name.empty() == false) {
@@ -407,8 +415,18 @@ namespace PluginHost {
 
                 Unlock();
 
+                const uint64_t started(Core::Time::Now().Ticks());
+
                 REPORT_DURATION_WARNING( { ErrorMessage(_handler->Initialize(this)); }, WarningReporting::TooLongPluginState, WarningReporting::TooLongPluginState::StateChange::ACTIVATION, callSign.c_str());
 
+                // Round up, so a recorded activation time is never 0 ms.
+                const uint32_t duration(static_cast<uint32_t>((Core::Time::Now().Ticks() - started + Core::Time::TicksPerMillisecond - 1) / Core::Time::TicksPerMillisecond));
+
+                // The controller reads it while building the metadata, from any thread.
+                Lock();
+                _activationTime = duration;
+                Unlock();
+
                 if (HasError() == true) {
                     result = Core::ERROR_GENERAL;
 
@@ -920,11 +938,33 @@ namespace PluginHost {
     //
     // class Server::ServiceMap
     // -----------------------------------------------------------------------------------------------------------------------------------
+    uint8_t Server::ServiceMap::StartupSlots() {
+        // Keep at least one worker free for the COMRPC announcements of out-of-process plugins.
+        const uint8_t workers(WorkerPool().Count());
+
+        return (std::min(Configuration().ParallelStartup(), static_cast<uint8_t>(workers > 1 ? workers - 1 : 1)));
+    }
+
     void Server::ServiceMap::Open(std::vector<PluginHost::ISubSystem::subsystem>& externallyControlled) {
-        // Load the metadata for the subsystem information..
+        const uint8_t slots(StartupSlots());
+
+        // Load the metadata for the subsystem information, the workerpool must be running for the preloader.
+        if (slots > 1) {
+            Preloader preloader(slots);
+
+            for (auto service : _services) {
+                preloader.Add(service.second);
+            }
+
+            preloader.Run();
+        }
+
         for (auto service : _services)
         {
-            service.second->LoadMetadata();
+            if (slots <= 1) {
+                service.second->LoadMetadata();
+            }
+
             for (const PluginHost::ISubSystem::subsystem& entry : service.second->SubSystemControl()) {
                 Core::EnumerateType<PluginHost::ISubSystem::subsystem> name(entry);
                 if (std::find(externallyControlled.begin(), externallyControlled.end(), entry) != externallyControlled.end()) {
@@ -1057,13 +1097,21 @@ namespace PluginHost {
                 return lhs->StartupOrder() < rhs->StartupOrder();
             });
 
+        const uint8_t slots(StartupSlots());
+        Activator launcher(slots);
+
         for (auto service : configured_services)
         {
             if (service->State() != PluginHost::Service::state::UNAVAILABLE) {
                 if (service->StartMode() == PluginHost::IShell::startmode::ACTIVATED) {
-                    SYSLOG(Logging::Startup, (_T("Activating plugin [%s]:[%s]"),
-                        service->ClassName().c_str(), service->Callsign().c_str()));
-                    service->Activate(PluginHost::IShell::STARTUP);
+                    if (slots > 1) {
+                        launcher.Add(service);
+                    }
+                    else {
+                        SYSLOG(Logging::Startup, (_T("Activating plugin [%s]:[%s]"),
+                            service->ClassName().c_str(), service->Callsign().c_str()));
+                        service->Activate(PluginHost::IShell::STARTUP);
+                    }
                 }
                 else {
                     SYSLOG(Logging::Startup, (_T("Activation of plugin [%s]:[%s] delayed, start mode is %s"),
@@ -1072,6 +1120,13 @@ namespace PluginHost {
                 }
             }
         }
+
+        if (slots > 1) {
+            SYSLOG(Logging::Startup, (_T("Activating plugins, at most %d in parallel"), slots));
+
+            launcher.Follow();
+            launcher.Run();
+        }
     }
 
     //
@@ -1088,6 +1143,10 @@ namespace PluginHost {
         TRACE(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
 
         _jobs.Slots(static_cast<ChannelMap&>(*parent).MaxRequests());
+
+        if (_parent.Configuration().Compression().IsSet() == true) {
+            PluginHost::Channel::Compression(_parent.Configuration().Compression().Value());
+        }
     }
 
     /* virtual */ Server::Channel::~Channel()
@@ -1265,6 +1324,13 @@ namespace PluginHost {
 
         _config.Security(securityProvider);
 
+        // A parallel preload of the plugins runs on the workerpool, so it must be running by now.
+        const bool preload(_services.StartupSlots() > 1);
+
+        if (preload == true) {
+            _dispatcher.Run();
+        }
+
         std::vector<PluginHost::ISubSystem::subsystem> externallyControlled;
         _services.Open(externallyControlled);
 
@@ -1286,7 +1352,9 @@ namespace PluginHost {
 
         securityProvider->Release();
 
-        _dispatcher.Run();
+        if (preload == false) {
+            _dispatcher.Run();
+        }
         _connections.Open(MAX_EXTERNAL_WAITS, _config.IdleTime());
 
         _services.Startup();
@@ -26,6 +26,7 @@
 #include "IRemoteInstantiation.h"
 #include "WarningReportingCategories.h"
 #include "PostMortem.h"
+#include "Launcher.h"
 
 #ifndef HOSTING_COMPROCESS
 #error "Please define the name of the COM process!!!"
@@ -198,6 +199,16 @@ namespace PluginHost {
                     Core::JSON::DecUInt32 newElement;
                     data.ThreadPoolRuns.Add() = snapshot.Slot[teller];
                 }
+
+                const Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+
+                for (uint8_t teller = 0; teller < monitor.Reactors(); teller++) {
+                    PluginHost::Metadata::Server::Reactor& reactor(data.Reactors.Add());
+
+                    reactor.Id = PluginHost::Metadata::InstanceId(monitor.Id(teller));
+                    reactor.Resources = monitor.Count(teller);
+                    reactor.Runs = monitor.Runs(teller);
+                }
             }
 
         private:
@@ -653,6 +664,10 @@ namespace PluginHost {
                 {
                     return ((currentSet & _mask) ^ _events);
                 }
+                inline uint32_t Mask() const
+                {
+                    return (_mask);
+                }
             private:
                 void AddBit(const uint32_t input) {
 
@@ -844,6 +859,7 @@ namespace PluginHost {
                 , _activity(0)
                 , _connection(nullptr)
                 , _lastId(0)
+                , _activationTime(0)
                 , _metadata(plugin.Throttle.IsSet() ? plugin.Throttle.Value() : server.Throttle())
                 , _library()
                 , _external(PluginNodeId(server, plugin), server.ProxyStubPath(), handler, '/' + Callsign())
@@ -890,6 +906,17 @@ namespace PluginHost {
             inline const std::vector<PluginHost::ISubSystem::subsystem>& SubSystemControl() const {
                 return (_metadata.Control());
             }
+            // Bitmask of all subsystems this service reacts upon, during activation (precondition) or deactivation (termination)
+            inline uint32_t SubSystemDependencies() const {
+                return (_precondition.Mask() | _termination.Mask());
+            }
+            inline uint32_t ActivationTime() const {
+                Lock();
+                const uint32_t result(_activationTime);
+                Unlock();
+
+                return (result);
+            }
             inline const string& VersionHash() const
             {
                 return (_metadata.Hash());
@@ -992,7 +1019,7 @@ namespace PluginHost {
                     result = _unavailableHandler;
                 } else if (IsWebServerRequest(request.Path) == true) {
                     result = IFactories::Instance().Response();
-                    FileToServe(request.Path, *result, false);
+                    FileToServe(request, *result, false);
                 } else if (request.Verb == Web::Request::HTTP_OPTIONS) {
 
                     result = IFactories::Instance().Response();
@@ -1090,13 +1117,13 @@ namespace PluginHost {
                                 response->Result.Null(true);;
                             }
                             else {
-                                response->Result = output;
+                                response->Result = std::move(output);
                             }
                         }
                         else {
                             response->Error.SetError(result);
                             if (output.empty() == false) {
-                                response->Error.Text = output;
+                                response->Error.Text = std::move(output);
                             }
                         }
                     }
@@ -1214,6 +1241,12 @@ namespace PluginHost {
                 }
 
                 _pluginHandling.Unlock();
+
+                const uint32_t activationTime(ActivationTime());
+
+                if (activationTime != 0) {
+                    metaData.ActivationTime = activationTime;
+                }
             }
             inline void Evaluate()
             {
@@ -1670,6 +1703,7 @@ namespace PluginHost {
             uint32_t _activity;
             RPC::IRemoteConnection* _connection;
             uint32_t _lastId;
+            uint32_t _activationTime;
             ControlData _metadata;
             Core::Library _library;
 #ifdef HIBERNATE_SUPPORT_ENABLED
@@ -2764,6 +2798,50 @@ namespace PluginHost {
                 ServiceMap& _parent;
                 string _observerPath;
             };
+            // Loads the plugin libraries (and so their metadata) of the services, concurrently.
+            class Preloader : public LauncherType<Core::ProxyType<Service>> {
+            public:
+                Preloader() = delete;
+                Preloader(Preloader&&) = delete;
+                Preloader(const Preloader&) = delete;
+                Preloader& operator=(Preloader&&) = delete;
+                Preloader& operator=(const Preloader&) = delete;
+
+                Preloader(const uint8_t slots)
+                    : LauncherType<Core::ProxyType<Service>>(slots)
+                {
+                }
+                ~Preloader() override = default;
+
+            private:
+                void Launch(const Core::ProxyType<Service>& service) override
+                {
+                    service->LoadMetadata();
+                }
+            };
+            // Activates the services, in dependency order, with at most "slots" of them in parallel.
+            class Activator : public LauncherType<Core::ProxyType<Service>> {
+            public:
+                Activator() = delete;
+                Activator(Activator&&) = delete;
+                Activator(const Activator&) = delete;
+                Activator& operator=(Activator&&) = delete;
+                Activator& operator=(const Activator&) = delete;
+
+                Activator(const uint8_t slots)
+                    : LauncherType<Core::ProxyType<Service>>(slots)
+                {
+                }
+                ~Activator() override = default;
+
+            private:
+                void Launch(const Core::ProxyType<Service>& service) override
+                {
+                    SYSLOG(Logging::Startup, (_T("Activating plugin [%s]:[%s]"),
+                        service->ClassName().c_str(), service->Callsign().c_str()));
+                    service->Activate(PluginHost::IShell::STARTUP);
+                }
+            };
 
             using Channels = std::vector<uint32_t>;
 
@@ -3385,6 +3463,7 @@ namespace PluginHost {
 
             void Open(std::vector<PluginHost::ISubSystem::subsystem>& externallyControlled);
             void Startup();
+            uint8_t StartupSlots();
             void Close();
             void Destroy();
 
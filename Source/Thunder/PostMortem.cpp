@@ -25,6 +25,9 @@ namespace PluginHost {
 
 /* static */ void Server::PostMortem(Service& service, const IShell::reason why, RPC::IRemoteConnection* connection) {
 
+    // What led up to this might still be staged, allowed to dump or not, get it out now.
+    Messaging::MessageUnit::Instance().Flush();
+
     if (service.PostMortemAllowed(why) == true) {
         // See if this is an external process on which we could trigger a PostMortem log generation
         if (connection == nullptr) {
@@ -151,12 +151,12 @@ namespace Plugin {
                 }
             }
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
 
                 // We assume that this all fit a datagram. The datagram will *NOT* cross the datagram boundries.
                 // Hence why this method will only be called once !!
-                uint16_t size(0);
+                uint32_t size(0);
 
                 _adminLock.Lock();
 
@@ -176,7 +176,7 @@ namespace Plugin {
 
                         Core::SocketDatagram::RemoteNode(info._destination);
 
-                        size = (maxSendSize > data.length() ? static_cast<uint8_t>(data.length()) : maxSendSize);
+                        size = (maxSendSize > data.length() ? static_cast<uint32_t>(data.length()) : maxSendSize);
                         ::memcpy(dataFrame, data.c_str(), size);
 
                         _parent.Issued();
@@ -190,7 +190,7 @@ namespace Plugin {
             {
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize);
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override;
 
         private:
             std::string CreateRequest()
@@ -27,12 +27,12 @@ namespace RPC {
     /* static */ const string Administrator::DanglingId("/Dangling");
 
     Administrator::Administrator()
-        : _adminLock()
-        , _stubs()
-        , _proxy()
+        : _interfaceLock()
+        , _interfaces(std::make_shared<Interfaces>())
+        , _version(1)
         , _factory(8)
-        , _channelProxyMap()
-        , _channelReferenceMap()
+        , _shards()
+        , _danglingLock()
         , _danglingProxies()
         , _delegatedReleases(true)
     {
@@ -40,16 +40,16 @@ namespace RPC {
 
     /* virtual */ Administrator::~Administrator()
     {
-        for (auto& proxy : _proxy) {
+        for (auto& proxy : _interfaces->proxies) {
             delete proxy.second;
         }
 
-        for (auto& stub : _stubs) {
+        for (auto& stub : _interfaces->stubs) {
             delete stub.second;
         }
 
-        _proxy.clear();
-        _stubs.clear();
+        _interfaces->proxies.clear();
+        _interfaces->stubs.clear();
     }
 
     /* static */ Administrator& Administrator::Instance()
@@ -62,23 +62,70 @@ namespace RPC {
         return (systemAdministrator);
     }
 
+    const Administrator::Interfaces& Administrator::Snapshot() const
+    {
+        // Every thread holds on to the snapshot it used last, so it only needs the lock to pick up a new one
+        // after a proxy-stub library has been loaded or unloaded.
+        struct Cache {
+            uint32_t version;
+            std::shared_ptr<const Interfaces> tables;
+        };
+
+        static thread_local Cache cache = { 0, nullptr };
+
+        if (cache.version != _version.load(std::memory_order_acquire)) {
+            _interfaceLock.Lock();
+            cache.tables = _interfaces;
+            cache.version = _version.load(std::memory_order_relaxed);
+            _interfaceLock.Unlock();
+        }
+
+        return (*cache.tables);
+    }
+
+    Administrator::Interfaces& Administrator::Writable()
+    {
+        // Snapshots are only handed out under the _interfaceLock, so if we are the sole owner, no reader
+        // can be using this one and it can be changed in place (typically while loading the proxy-stubs
+        // at startup). Otherwise the readers keep the current one and we continue on a copy.
+        if (_interfaces.use_count() != 1) {
+            _interfaces = std::make_shared<Interfaces>(*_interfaces);
+        }
+
+        _version.fetch_add(1, std::memory_order_release);
+
+        return (*_interfaces);
+    }
+
+    ProxyStub::UnknownStub* Administrator::Stub(const uint32_t id) const
+    {
+        const Interfaces& tables(Snapshot());
+        Stubs::const_iterator index(tables.stubs.find(id));
+        return (index != tables.stubs.end() ? index->second : nullptr);
+    }
+
+    Administrator::IMetadata* Administrator::Factory(const uint32_t id) const
+    {
+        const Interfaces& tables(Snapshot());
+        Factories::const_iterator index(tables.proxies.find(id));
+        return (index != tables.proxies.end() ? index->second : nullptr);
+    }
+
     void Administrator::AddRef(const Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        Stubs::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (stub != nullptr) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
-            if (implementation != nullptr) {
-                _adminLock.Lock();
-                if (channel.IsValid() == true) {
-                    implementation->AddRef();
-                    RegisterUnknown(channel, implementation, interfaceId);
-                }
-                _adminLock.Unlock();
+            if ((implementation != nullptr) && (channel.IsValid() == true)) {
+                Shard& shard(Select(channel->Id()));
+                shard.Lock();
+                implementation->AddRef();
+                RegisterUnknown(shard, channel, implementation, interfaceId);
+                shard.Unlock();
             }
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
@@ -88,21 +135,21 @@ namespace RPC {
 
     void Administrator::Release(const Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId, const uint32_t dropCount)
     {
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        Stubs::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
-            Core::IUnknown* implementation(index->second->Convert(impl));
+        if (stub != nullptr) {
+            Core::IUnknown* implementation(stub->Convert(impl));
 
             ASSERT(implementation != nullptr);
 
-            if (implementation != nullptr) {
-                _adminLock.Lock();
-                if (channel.IsValid() == true) {
-                    UnregisterInterface(channel, implementation, interfaceId, dropCount);
-                    implementation->Release();
-                }
-                _adminLock.Unlock();
+            if ((implementation != nullptr) && (channel.IsValid() == true)) {
+                Shard& shard(Select(channel->Id()));
+                shard.Lock();
+                UnregisterUnknown(shard, channel, implementation, interfaceId, dropCount);
+                shard.Unlock();
+
+                // The last release might destruct proxies of other channels, so do not hold on to the shard.
+                implementation->Release();
             }
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
@@ -120,11 +167,13 @@ namespace RPC {
     {
         bool removed = false;
 
-        _adminLock.Lock();
+        Shard& shard(Select(channelId));
+
+        shard.Lock();
 
-        ChannelMap::iterator index(_channelProxyMap.find(channelId));
+        ChannelMap::iterator index(shard.Proxies().find(channelId));
 
-        if (index != _channelProxyMap.end()) {
+        if (index != shard.Proxies().end()) {
             Proxies::iterator entry(index->second.second.begin());
             while ((entry != index->second.second.end()) && ((*entry) != &proxy)) {
                 entry++;
@@ -136,11 +185,13 @@ namespace RPC {
                 index->second.second.erase(entry);
                 removed = true;
                 if (index->second.second.size() == 0) {
-                    _channelProxyMap.erase(index);
+                    shard.Proxies().erase(index);
                 }
             }
         } else {
             // If the channel nolonger exists, check the dangling map
+            _danglingLock.Lock();
+
             Proxies::iterator index = std::find(_danglingProxies.begin(), _danglingProxies.end(), &proxy);
 
             if (index != _danglingProxies.end()) {
@@ -151,9 +202,10 @@ namespace RPC {
                 TRACE_L1("Could not find the Proxy entry to be unregistered from a channel perspective.");
             }
 
+            _danglingLock.Unlock();
         }
 
-        _adminLock.Unlock();
+        shard.Unlock();
 
         return removed;
     }
@@ -162,12 +214,11 @@ namespace RPC {
     {
         uint32_t interfaceId(message->Parameters().InterfaceId());
 
-        // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
-        Stubs::iterator index(_stubs.find(interfaceId));
+        ProxyStub::UnknownStub* stub(Stub(interfaceId));
 
-        if (index != _stubs.end()) {
+        if (stub != nullptr) {
             uint32_t methodId(message->Parameters().MethodId());
-            REPORT_DURATION_WARNING({ index->second->Handle(methodId, channel, message); },  WarningReporting::TooLongInvokeRPC, interfaceId, methodId);
+            REPORT_DURATION_WARNING({ stub->Handle(methodId, channel, message); },  WarningReporting::TooLongInvokeRPC, interfaceId, methodId);
         } else {
             // Oops this is an unknown interface, Do not think this could happen.
             TRACE_L1("Unknown interface. %d", interfaceId);
@@ -200,17 +251,19 @@ namespace RPC {
 
             // If not there, look in the administration...
             if (result == false) {
-                _adminLock.Lock();
-
-                ReferenceMap::const_iterator index(_channelReferenceMap.find(channel->Id()));
                 const Core::IUnknown* unknown = Convert(reinterpret_cast<void*>(impl), id);
+                const Shard& shard(Select(channel->Id()));
+
+                shard.Lock();
+
+                ReferenceMap::const_iterator index(shard.References().find(channel->Id()));
 
-                result = ((index != _channelReferenceMap.end()) &&
+                result = ((index != shard.References().end()) &&
                             (std::find_if(index->second.begin(), index->second.end(), [&](const RecoverySet& element) {
                                     return ((element.Unknown() == unknown) && (element.Id() == id));
                             }) != index->second.end()));
 
-                _adminLock.Unlock();
+                shard.Unlock();
 
                 if (result == true) {
                     TRACE_L3("Validated instance 0x%08" PRId64 " by administration", impl);
@@ -227,11 +280,13 @@ namespace RPC {
     {
         ProxyStub::UnknownProxy* result = nullptr;
 
-        _adminLock.Lock();
+        Shard& shard(Select(channel->Id()));
 
-        ChannelMap::iterator index(_channelProxyMap.find(channel->Id()));
+        shard.Lock();
 
-        if (index != _channelProxyMap.end()) {
+        ChannelMap::iterator index(shard.Proxies().find(channel->Id()));
+
+        if (index != shard.Proxies().end()) {
             Proxies::iterator entry(index->second.second.begin());
             while ((entry != index->second.second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
                 entry++;
@@ -244,7 +299,7 @@ namespace RPC {
             }
         }
 
-        _adminLock.Unlock();
+        shard.Unlock();
 
         return (result);
     }
@@ -255,82 +310,81 @@ namespace RPC {
 
         interface = nullptr;
 
-        if (impl) {
+        if ((impl) && (channel.IsValid() == true)) {
 
-            _adminLock.Lock();
+            uint32_t channelId(channel->Id());
+            Shard& shard(Select(channelId));
 
-            if (channel.IsValid() == true) {
+            shard.Lock();
 
-                uint32_t channelId(channel->Id());
-                ChannelMap::iterator index(_channelProxyMap.find(channelId));
+            ChannelMap::iterator index(shard.Proxies().find(channelId));
 
-                if (index != _channelProxyMap.end()) {
-                    Proxies::iterator entry(index->second.second.begin());
-                    while ((entry != index->second.second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                        entry++;
-                    }
-                    if (entry != index->second.second.end()) {
-                        interface = (*entry)->Acquire(outbound, id);
-
-                        // The implementation could be found, but the current implemented proxy is not
-                        // for the given interface. If that cae, the interface == nullptr and we still
-                        // need to create a proxy for this specific interface.
-                        if (interface != nullptr) {
-                            result = (*entry);
-                        }
+            if (index != shard.Proxies().end()) {
+                Proxies::iterator entry(index->second.second.begin());
+                while ((entry != index->second.second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
+                    entry++;
+                }
+                if (entry != index->second.second.end()) {
+                    interface = (*entry)->Acquire(outbound, id);
+
+                    // The implementation could be found, but the current implemented proxy is not
+                    // for the given interface. If that cae, the interface == nullptr and we still
+                    // need to create a proxy for this specific interface.
+                    if (interface != nullptr) {
+                        result = (*entry);
                     }
                 }
+            }
 
-                if (result == nullptr) {
-                    Factories::iterator factory(_proxy.find(id));
+            if (result == nullptr) {
+                IMetadata* factory(Factory(id));
 
-                    if (factory != _proxy.end()) {
+                if (factory != nullptr) {
 
-                        result = factory->second->CreateProxy(channel, impl, outbound);
+                    result = factory->CreateProxy(channel, impl, outbound);
 
-                        ASSERT(result != nullptr);
+                    ASSERT(result != nullptr);
 
-                        // Register it as it is remotely registered :-)
-                        ChannelMap::iterator channelIndex(_channelProxyMap.find(channelId));
+                    // Register it as it is remotely registered :-)
+                    ChannelMap::iterator channelIndex(shard.Proxies().find(channelId));
 
-                        if (channelIndex != _channelProxyMap.end()) {
-                            channelIndex->second.second.push_back(result);
-                        }
-                        else {
-                            Proxies baseList;
-                            baseList.emplace_back(result);
-                            _channelProxyMap.emplace(std::piecewise_construct,
-                                std::forward_as_tuple(channelId),
-                                std::forward_as_tuple(std::pair<string, Proxies>(channel->Origin(), baseList)));
-                        }
+                    if (channelIndex != shard.Proxies().end()) {
+                        channelIndex->second.second.push_back(result);
+                    }
+                    else {
+                        Proxies baseList;
+                        baseList.emplace_back(result);
+                        shard.Proxies().emplace(std::piecewise_construct,
+                            std::forward_as_tuple(channelId),
+                            std::forward_as_tuple(std::pair<string, Proxies>(channel->Origin(), baseList)));
+                    }
 
-                        // This will increment the reference count to 2 (one in the ChannelProxyMap and one in the QueryInterface ).
-                        interface = result->QueryInterface(id);
-                        ASSERT(interface != nullptr);
+                    // This will increment the reference count to 2 (one in the ChannelProxyMap and one in the QueryInterface ).
+                    interface = result->QueryInterface(id);
+                    ASSERT(interface != nullptr);
 
-                    } else {
-                        TRACE_L1("Failed to find a Proxy for %d.", id);
-                    }
+                } else {
+                    TRACE_L1("Failed to find a Proxy for %d.", id);
                 }
             }
 
-            _adminLock.Unlock();
+            shard.Unlock();
         }
 
         return (result);
     }
 
-    // Locked by the Callee and the channel has been checked that it exists.. (IsValid)
-    void Administrator::RegisterUnknown(const Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* reference, const uint32_t id)
+    // The shard is locked by the Callee and the channel has been checked that it exists.. (IsValid)
+    void Administrator::RegisterUnknown(Shard& shard, const Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* reference, const uint32_t id)
     {
         ASSERT(reference != nullptr);
         ASSERT(channel.IsValid() == true);
 
         uint32_t channelId(channel->Id());
-        ReferenceMap::iterator index = _channelReferenceMap.find(channelId);
+        ReferenceMap::iterator index = shard.References().find(channelId);
 
-        if (index == _channelReferenceMap.end()) {
-            auto result = _channelReferenceMap.emplace(std::piecewise_construct,
+        if (index == shard.References().end()) {
+            auto result = shard.References().emplace(std::piecewise_construct,
                 std::forward_as_tuple(channelId),
                 std::forward_as_tuple());
             result.first->second.emplace_back(id, reference);
@@ -369,14 +423,14 @@ namespace RPC {
         }
     }
 
-    // Locked by the Callee and the channel has been checked that it exists.. (IsValid)
-    void Administrator::UnregisterUnknown(const Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount) {
+    // The shard is locked by the Callee and the channel has been checked that it exists.. (IsValid)
+    void Administrator::UnregisterUnknown(Shard& shard, const Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount) {
         ASSERT(source != nullptr);
         ASSERT(channel.IsValid() == true);
 
-        ReferenceMap::iterator index(_channelReferenceMap.find(channel->Id()));
+        ReferenceMap::iterator index(shard.References().find(channel->Id()));
 
-        if (index != _channelReferenceMap.end()) {
+        if (index != shard.References().end()) {
             std::list< RecoverySet >::iterator element(index->second.begin());
 
             while ( (element != index->second.end()) && ((element->Id() != interfaceId) || (element->Unknown() != source)) ) {
@@ -389,7 +443,7 @@ namespace RPC {
                 if (element->Decrement(dropCount) == false) {
                     index->second.erase(element);
                     if (index->second.size() == 0) {
-                        _channelReferenceMap.erase(index);
+                        shard.References().erase(index);
                         TRACE_L3("Unregistered interface %p(%u).", source, interfaceId);
                     }
                 }
@@ -403,49 +457,36 @@ namespace RPC {
 
     Core::IUnknown* Administrator::Convert(void* rawImplementation, const uint32_t id)
     {
-        Stubs::const_iterator index (_stubs.find(id));
-        return(index != _stubs.end() ? index->second->Convert(rawImplementation) : nullptr);
+        ProxyStub::UnknownStub* stub(Stub(id));
+        return(stub != nullptr ? stub->Convert(rawImplementation) : nullptr);
     }
 
     const Core::IUnknown* Administrator::Convert(void* rawImplementation, const uint32_t id) const
     {
-        Stubs::const_iterator index (_stubs.find(id));
-        return(index != _stubs.end() ? index->second->Convert(rawImplementation) : nullptr);
+        ProxyStub::UnknownStub* stub(Stub(id));
+        return(stub != nullptr ? stub->Convert(rawImplementation) : nullptr);
     }
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, Danglings& pendingProxies)
     {
-        _adminLock.Lock();
-
         uint32_t channelId(channel->Id());
-        ReferenceMap::iterator remotes(_channelReferenceMap.find(channelId));
-
-        if (remotes != _channelReferenceMap.end()) {
-            std::list<RecoverySet>::iterator loop(remotes->second.begin());
-            while (loop != remotes->second.end()) {
+        Shard& shard(Select(channelId));
+        std::list<RecoverySet> remotes;
 
-                Core::IUnknown* iface = loop->Unknown();
-                ASSERT(iface != nullptr);
+        shard.Lock();
 
-                if ((_delegatedReleases == true) && (iface != nullptr) && (loop->IsComposit() == false)) {
-
-                    uint32_t result;
-
-                    // We will release on behalf of the other side :-)
-                    do {
-                        result = iface->Release();
-                    } while ((loop->Decrement(1)) && (result == Core::ERROR_NONE));
-                }
+        ReferenceMap::iterator references(shard.References().find(channelId));
 
-                ASSERT (loop->Flushed() == true);
-                loop++;
-            }
-            _channelReferenceMap.erase(remotes);
+        if (references != shard.References().end()) {
+            remotes.splice(remotes.end(), references->second);
+            shard.References().erase(references);
         }
 
-        ChannelMap::iterator index(_channelProxyMap.find(channelId));
+        ChannelMap::iterator index(shard.Proxies().find(channelId));
+
+        if (index != shard.Proxies().end()) {
+            _danglingLock.Lock();
 
-        if (index != _channelProxyMap.end()) {
             for (auto entry : index->second.second) {
                 if (entry->Invalidate() == true) {
                     // This is actually for the pendingProxies to be reported
@@ -455,7 +496,7 @@ namespace RPC {
                     //       be properly released, once it is reported!
                     pendingProxies.emplace_back(std::pair<uint32_t,Core::IUnknown*>(entry->InterfaceId(), entry->Parent()));
                 }
-                // The _channelProxyMap does have a reference for each Proxy it
+                // The channel proxy map does have a reference for each Proxy it
                 // holds, so it is safe to just move the vector from the map to
                 // the _danglingProxies. This is to keep the Proxies we created
                 // registered untill, really the last reference is dropped. Till
@@ -463,10 +504,35 @@ namespace RPC {
                 // leak that should be investigated!!!
                 _danglingProxies.emplace_back(entry);
             }
-            _channelProxyMap.erase(index);
+
+            _danglingLock.Unlock();
+
+            shard.Proxies().erase(index);
         }
 
-        _adminLock.Unlock();
+        shard.Unlock();
+
+        // Releasing the objects might destruct proxies on other channels, so this is
+        // done after the shard of this channel has been released.
+        std::list<RecoverySet>::iterator loop(remotes.begin());
+        while (loop != remotes.end()) {
+
+            Core::IUnknown* iface = loop->Unknown();
+            ASSERT(iface != nullptr);
+
+            if ((_delegatedReleases == true) && (iface != nullptr) && (loop->IsComposit() == false)) {
+
+                uint32_t result;
+
+                // We will release on behalf of the other side :-)
+                do {
+                    result = iface->Release();
+                } while ((loop->Decrement(1)) && (result == Core::ERROR_NONE));
+            }
+
+            ASSERT (loop->Flushed() == true);
+            loop++;
+        }
     }
 
     /* static */ Administrator& Job::_administrator= Administrator::Instance();
@@ -133,6 +133,65 @@ namespace RPC {
         using Factories = std::unordered_map<uint32_t, IMetadata*>;
         using Danglings = std::vector<std::pair<uint32_t, Core::IUnknown*>>;
 
+    private:
+        // Number of shards the channel administration is spread over. The shard is selected by the channel id,
+        // so calls on different channels do not contend on the same lock.
+        static constexpr uint8_t ChannelShards = 16;
+
+        class Shard {
+        public:
+            Shard(Shard&&) = delete;
+            Shard(const Shard&) = delete;
+            Shard& operator=(Shard&&) = delete;
+            Shard& operator=(const Shard&) = delete;
+
+            Shard()
+                : _lock()
+                , _proxies()
+                , _references()
+            {
+            }
+            ~Shard() = default;
+
+        public:
+            inline void Lock() const
+            {
+                _lock.Lock();
+            }
+            inline void Unlock() const
+            {
+                _lock.Unlock();
+            }
+            inline ChannelMap& Proxies()
+            {
+                return (_proxies);
+            }
+            inline const ChannelMap& Proxies() const
+            {
+                return (_proxies);
+            }
+            inline ReferenceMap& References()
+            {
+                return (_references);
+            }
+            inline const ReferenceMap& References() const
+            {
+                return (_references);
+            }
+
+        private:
+            mutable Core::CriticalSection _lock;
+            ChannelMap _proxies;
+            ReferenceMap _references;
+        };
+
+        // The stubs and proxy factories only change if a proxy-stub library is loaded or unloaded. Readers work
+        // on a snapshot of these tables, writers replace the snapshot if any reader might still be using it.
+        struct Interfaces {
+            Stubs stubs;
+            Factories proxies;
+        };
+
     public:
         Administrator(Administrator&&) = delete;
         Administrator(const Administrator&) = delete;
@@ -154,79 +213,100 @@ namespace RPC {
         template<typename ACTION>
         bool Allocations(const string& linkId, ACTION&& action) const {
             bool found = false;
-            _adminLock.Lock();
             if (linkId.empty() == true) {
-                for (const auto& proxy : _channelProxyMap) {
-                    action(proxy.second.first, proxy.second.second);
+                for (const Shard& shard : _shards) {
+                    shard.Lock();
+                    for (const auto& proxy : shard.Proxies()) {
+                        action(proxy.second.first, proxy.second.second);
+                    }
+                    shard.Unlock();
                 }
+                _danglingLock.Lock();
                 action(DanglingId, _danglingProxies);
+                _danglingLock.Unlock();
                 found = true;
             } 
             else if (linkId == DanglingId) {
+                _danglingLock.Lock();
                 action(DanglingId, _danglingProxies);
+                _danglingLock.Unlock();
                 found = true;
             }
             else {
-                ChannelMap::const_iterator index(_channelProxyMap.begin());
-                while ((found == false) && (index != _channelProxyMap.end())) {
-                    ASSERT(index->second.second.size() != 0);
-
-                    if (index->second.first != linkId) {
-                        index++;
-                    }
-                    else {
-                        found = true;
-                        action(index->second.first, index->second.second);
+                uint8_t teller = 0;
+                while ((found == false) && (teller < ChannelShards)) {
+                    const Shard& shard(_shards[teller]);
+
+                    shard.Lock();
+
+                    ChannelMap::const_iterator index(shard.Proxies().begin());
+                    while ((found == false) && (index != shard.Proxies().end())) {
+                        ASSERT(index->second.second.size() != 0);
+
+                        if (index->second.first != linkId) {
+                            index++;
+                        }
+                        else {
+                            found = true;
+                            action(index->second.first, index->second.second);
+                        }
                     }
+
+                    shard.Unlock();
+
+                    teller++;
                 }
             }
-            _adminLock.Unlock();
             return found;
         }
 
         template <typename ACTUALINTERFACE, typename PROXY, typename STUB>
         void Announce()
         {
-            _adminLock.Lock();
+            _interfaceLock.Lock();
+
+            Interfaces& tables(Writable());
 
 #ifdef __DEBUG__
-            if (_stubs.find(ACTUALINTERFACE::ID) != _stubs.end()) {
+            if (tables.stubs.find(ACTUALINTERFACE::ID) != tables.stubs.end()) {
                 TRACE_L1("Interface (stub) %d, gets registered multiple times !!!", ACTUALINTERFACE::ID);
             }
-            else if (_proxy.find(ACTUALINTERFACE::ID) != _proxy.end()) {
+            else if (tables.proxies.find(ACTUALINTERFACE::ID) != tables.proxies.end()) {
                 TRACE_L1("Interface (proxy) %d, gets registered multiple times !!!", ACTUALINTERFACE::ID);
             }
 #endif
-            _stubs.insert(std::pair<uint32_t, ProxyStub::UnknownStub*>(ACTUALINTERFACE::ID, new STUB()));
-            _proxy.insert(std::pair<uint32_t, IMetadata*>(ACTUALINTERFACE::ID, new ProxyType<PROXY>()));
+            tables.stubs.insert(std::pair<uint32_t, ProxyStub::UnknownStub*>(ACTUALINTERFACE::ID, new STUB()));
+            tables.proxies.insert(std::pair<uint32_t, IMetadata*>(ACTUALINTERFACE::ID, new ProxyType<PROXY>()));
 
-            _adminLock.Unlock();
+            _interfaceLock.Unlock();
         }
 
         template <typename ACTUALINTERFACE>
         void Recall()
         {
-            _adminLock.Lock();
+            _interfaceLock.Lock();
+
+            Interfaces& tables(Writable());
 
-            Stubs::iterator stub(_stubs.find(ACTUALINTERFACE::ID));
-            if (stub != _stubs.end()) {
+            Stubs::iterator stub(tables.stubs.find(ACTUALINTERFACE::ID));
+            if (stub != tables.stubs.end()) {
 PUSH_WARNING(DISABLE_WARNING_DELETE_INCOMPLETE)
                 delete stub->second;
 POP_WARNING()
-                _stubs.erase(ACTUALINTERFACE::ID);
+                tables.stubs.erase(stub);
             } else {
                 TRACE_L1("Failed to find a Stub for %d.", ACTUALINTERFACE::ID);
             }
 
-            Factories::iterator proxy(_proxy.find(ACTUALINTERFACE::ID));
-            if (proxy != _proxy.end()) {
+            Factories::iterator proxy(tables.proxies.find(ACTUALINTERFACE::ID));
+            if (proxy != tables.proxies.end()) {
                 delete proxy->second;
-                _proxy.erase(ACTUALINTERFACE::ID);
+                tables.proxies.erase(proxy);
             } else {
                 TRACE_L1("Failed to find a Proxy for %d.", ACTUALINTERFACE::ID);
             }
 
-            _adminLock.Unlock();
+            _interfaceLock.Unlock();
         }
 
         Core::ProxyType<InvokeMessage> Message()
@@ -285,12 +365,13 @@ POP_WARNING()
             Core::IUnknown* converted = Convert(const_cast<void*>(source), id);
 
             if (converted != nullptr) {
-                _adminLock.Lock();
                 if (channel.IsValid() == true) {
-                    RegisterUnknown(channel, converted, id);
+                    Shard& shard(Select(channel->Id()));
+                    shard.Lock();
+                    RegisterUnknown(shard, channel, converted, id);
+                    shard.Unlock();
                     result = true;
                 }
-                _adminLock.Unlock();
             }
             else {
                 TRACE_L1("Failed to find a Stub for interface 0x%08x!", id);
@@ -300,13 +381,12 @@ POP_WARNING()
         }
         void UnregisterInterface(const Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount)
         {
-            _adminLock.Lock();
-
             if (channel.IsValid() == true) {
-                UnregisterUnknown(channel, source, interfaceId, dropCount);
+                Shard& shard(Select(channel->Id()));
+                shard.Lock();
+                UnregisterUnknown(shard, channel, source, interfaceId, dropCount);
+                shard.Unlock();
             }
-
-            _adminLock.Unlock();
         }
         bool UnregisterUnknownProxy(const ProxyStub::UnknownProxy& proxy, uint32_t channelId);
 
@@ -316,17 +396,33 @@ POP_WARNING()
         // ----------------------------------------------------------------------------------------------------
         Core::IUnknown* Convert(void* rawImplementation, const uint32_t id);
         const Core::IUnknown* Convert(void* rawImplementation, const uint32_t id) const;
-        void RegisterUnknown(const Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* source, const uint32_t id);
-        void UnregisterUnknown(const Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount);
+        void RegisterUnknown(Shard& shard, const Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* source, const uint32_t id);
+        void UnregisterUnknown(Shard& shard, const Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount);
+
+        inline Shard& Select(const uint32_t channelId)
+        {
+            return (_shards[channelId % ChannelShards]);
+        }
+        inline const Shard& Select(const uint32_t channelId) const
+        {
+            return (_shards[channelId % ChannelShards]);
+        }
+
+        // Lock free lookups in the current snapshot of the stub and proxy tables.
+        ProxyStub::UnknownStub* Stub(const uint32_t id) const;
+        IMetadata* Factory(const uint32_t id) const;
+        const Interfaces& Snapshot() const;
+        // Should be called with the _interfaceLock taken.
+        Interfaces& Writable();
 
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
-        mutable Core::CriticalSection _adminLock;
-        Stubs _stubs;
-        Factories _proxy;
+        mutable Core::CriticalSection _interfaceLock;
+        std::shared_ptr<Interfaces> _interfaces;
+        std::atomic<uint32_t> _version;
         Core::ProxyPoolType<InvokeMessage> _factory;
-        ChannelMap _channelProxyMap;
-        ReferenceMap _channelReferenceMap;
+        Shard _shards[ChannelShards];
+        mutable Core::CriticalSection _danglingLock;
         Proxies _danglingProxies;
 
         // Delegated release, if enabled, will release references held by connections 
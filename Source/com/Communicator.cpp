@@ -568,6 +568,10 @@ namespace RPC {
         BaseClass::StateChange();
 
         if (BaseClass::Source().IsOpen()) {
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            OfferSharedRing();
+#endif
+
             TRACE_L1("Invoking the Announce message to the server. %d", __LINE__);
             uint32_t result = Invoke<RPC::AnnounceMessage>(Core::ProxyType<RPC::AnnounceMessage>(_announceMessage), this);
 
@@ -617,10 +621,43 @@ namespace RPC {
             }
         }
 
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+        if (_sharedRing.empty() == false) {
+            if ((announceMessage->Response().IsSet() == true) && (announceMessage->Response().SharedRing() == _sharedRing)) {
+                BaseClass::Established();
+            } else {
+                BaseClass::Detach();
+            }
+        }
+#endif
+
         // Set event so WaitForCompletion() can continue.
         _announceEvent.SetEvent();
     }
 
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+    // Create a pair of shared memory rings next to the socket and offer them in the
+    // announce message. The server reports in its response if it attached to them.
+    void CommunicatorClient::OfferSharedRing()
+    {
+        static std::atomic<uint32_t> instances(0);
+
+        const Core::NodeId& remoteNode(BaseClass::Source().RemoteNode());
+
+        _sharedRing.clear();
+
+        if (remoteNode.Type() == Core::NodeId::TYPE_DOMAIN) {
+            const string name(remoteNode.HostName() + '.' + Core::NumberType<uint32_t>(Core::ProcessInfo().Id()).Text() + '.' + Core::NumberType<uint32_t>(instances++).Text());
+
+            if (BaseClass::Attach(name, true) == Core::ERROR_NONE) {
+                _sharedRing = name;
+            }
+        }
+
+        _announceMessage.Parameters().SharedRing(_sharedRing);
+    }
+#endif
+
     //We may eliminate the following statement when switched to C++17 compiler
     constexpr uint32_t RPC::ProcessShutdown::DestructionStackSize;
 
@@ -1569,6 +1569,13 @@ namespace RPC {
 
                         message->Response().Set(instance_cast<void*>(result), proxyChannel->Extension().ExchangeId(), _parent.ProxyStubPath(), jsonDefaultMessagingSettings, jsonDefaultWarningReportingSettings);
 
+                        #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+                        const string sharedRing(message->Parameters().SharedRing());
+
+                        // From here on, our side of the channel can use the rings offered, report it so the client does the same.
+                        message->Response().SharedRing(((sharedRing.empty() == false) && (_parent.AttachSharedRing(channel, sharedRing) == true)) ? sharedRing : string());
+                        #endif
+
                         // We are done, report completion
                         channel.ReportResponse(data);
                     }
@@ -1591,7 +1598,11 @@ namespace RPC {
                 const string& proxyStubPath)
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
-                , _connections(processes) {
+                , _connections(processes)
+                #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+                , _sharedRingPrefix(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() + '.' : string())
+                #endif
+            {
                 BaseClass::Register(InvokeMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandler>::Create()));
                 BaseClass::Register(AnnounceMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<AnnounceHandler>::Create(*this)));
             }
@@ -1602,7 +1613,11 @@ namespace RPC {
                 const Core::ProxyType<Core::IIPCServer>& handler)
                 : BaseClass(remoteNode, CommunicationBufferSize)
                 , _proxyStubPath(proxyStubPath)
-                , _connections(processes) {
+                , _connections(processes)
+                #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+                , _sharedRingPrefix(remoteNode.Type() == Core::NodeId::TYPE_DOMAIN ? remoteNode.HostName() + '.' : string())
+                #endif
+            {
                 BaseClass::Register(InvokeMessage::Id(), handler);
                 BaseClass::Register(AnnounceMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<AnnounceHandler>::Create(*this)));
             }
@@ -1624,10 +1639,24 @@ POP_WARNING()
                 // We are in business, register the process with this channel.
                 return (_connections.Announce(channel, info, response));
             }
+            #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            // Only attach to rings the client created next to our own socket.
+            bool AttachSharedRing(Core::IPCChannel& channel, const string& name) const
+            {
+                return ((_sharedRingPrefix.empty() == false) &&
+                        (name.length() > _sharedRingPrefix.length()) &&
+                        (name.compare(0, _sharedRingPrefix.length(), _sharedRingPrefix) == 0) &&
+                        (name.find('/', _sharedRingPrefix.length()) == string::npos) &&
+                        (channel.Attach(name, false) == Core::ERROR_NONE));
+            }
+            #endif
 
         private:
             const string _proxyStubPath;
             RemoteConnectionMap& _connections;
+            #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            const string _sharedRingPrefix;
+            #endif
         };
 
     protected:
@@ -2050,10 +2079,18 @@ POP_WARNING()
     protected:
         void StateChange() override;
 
+    private:
+        #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+        void OfferSharedRing();
+        #endif
+
     private:
         Core::ProxyObject<RPC::AnnounceMessage> _announceMessage;
         Core::Event _announceEvent;
         uint32_t _connectionId;
+        #if defined(__CORE_COMRPC_SHARED_MEMORY__)
+        string _sharedRing;
+        #endif
     };
 
     using EnvironmentIterator = IteratorType<IEnvironmentIterator>;
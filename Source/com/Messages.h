@@ -50,15 +50,15 @@ namespace RPC {
             friend class Output;
             friend class ObjectInterface;
 
-            uint16_t Serialize(const uint32_t offset, uint8_t stream[], const uint16_t maxLength) const
+            uint32_t Serialize(const uint32_t offset, uint8_t stream[], const uint32_t maxLength) const
             {
-                uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
+                uint32_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
 
                 ::memcpy(stream, &(operator[](offset)), copiedBytes);
 
                 return (copiedBytes);
             }
-            uint16_t Deserialize(const uint32_t offset, const uint8_t stream[], const uint16_t maxLength)
+            uint32_t Deserialize(const uint32_t offset, const uint8_t stream[], const uint32_t maxLength)
             {
                 Size(offset + maxLength);
 
@@ -128,11 +128,11 @@ namespace RPC {
             {
                 return (Frame::Reader(_data, (sizeof(Core::instance_id) + sizeof(uint32_t) + sizeof(uint8_t))));
             }
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
                 return (_data.Serialize(offset, stream, maxLength));
             }
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
             {
                 return (_data.Deserialize(offset, stream, maxLength));
             }
@@ -180,11 +180,11 @@ namespace RPC {
             {
                 return (static_cast<uint32_t>(_data.Size()));
             }
-            inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            inline uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
                 return (_data.Serialize(offset, stream, maxLength));
             }
-            inline uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            inline uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
             {
                 return (_data.Deserialize(offset, stream, maxLength));
             }
@@ -271,6 +271,18 @@ namespace RPC {
                 const uint16_t classNameLength = _data.SetText(STRINGS_OFFSET, className);
                 _data.SetText((STRINGS_OFFSET + classNameLength), callsign);
             }
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            uint16_t SharedRingOffset() const
+            {
+                string value;
+
+                uint16_t length = STRINGS_OFFSET;
+                length += _data.GetText(length, value); // skip className
+                length += _data.GetText(length, value); // skip callsign
+
+                return (length);
+            }
+#endif
 
         private:
             type Type() const
@@ -340,6 +352,26 @@ namespace RPC {
             {
                 return GetText(STRINGS_OFFSET);
             }
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            // Name of the shared memory rings the announcer created for this channel, if any. It is
+            // appended after the callsign, so a peer that does not know about it, never reads it.
+            string SharedRing() const
+            {
+                string value;
+
+                const uint16_t offset = SharedRingOffset();
+
+                if (_data.Size() >= (offset + sizeof(uint16_t))) {
+                    _data.GetText(offset, value);
+                }
+
+                return (value);
+            }
+            void SharedRing(const string& name)
+            {
+                _data.SetText(SharedRingOffset(), name);
+            }
+#endif
 
         public:
             void Clear()
@@ -350,11 +382,11 @@ namespace RPC {
             {
                 return (_data.Size());
             }
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
                 return(_data.Serialize(offset, stream, maxLength));
             }
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t length, const uint32_t offset)
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t length, const uint32_t offset)
             {
                 return(_data.Deserialize(offset, stream, length));
             }
@@ -439,6 +471,37 @@ namespace RPC {
 
                 return (value);
             }
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            // Name of the shared memory rings the server attached to, empty if it did not.
+            string SharedRing() const
+            {
+                string value;
+
+                uint16_t length = sizeof(Core::instance_id) + sizeof(uint32_t) + sizeof(Output::mode); // skip implementation and sequence number
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip messaging categories
+                length += _data.GetText(length, value);  // skip warning reporting categories
+
+                value.clear();
+
+                if (_data.Size() >= (length + sizeof(uint16_t))) {
+                    _data.GetText(length, value);
+                }
+
+                return (value);
+            }
+            void SharedRing(const string& name)
+            {
+                string value;
+
+                uint16_t length = sizeof(Core::instance_id) + sizeof(uint32_t) + sizeof(Output::mode); // skip implementation and sequence number
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip messaging categories
+                length += _data.GetText(length, value);  // skip warning reporting categories
+
+                _data.SetText(length, name);
+            }
+#endif
             Core::instance_id Implementation() const
             {
                 Core::instance_id result = 0;
@@ -453,11 +516,11 @@ namespace RPC {
             {
                 return (_data.Size());
             }
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
                 return (_data.Serialize(offset, stream, maxLength));
             }
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
             {
                 return (_data.Deserialize(offset, stream, maxLength));
             }
@@ -21,6 +21,16 @@
 #include "ProcessInfo.h"
 #include "Thread.h"
 
+#ifdef __POSIX__
+#include <sys/mman.h>
+
+#ifdef __LINUX__
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
 namespace Thunder {
 namespace Core {
 
@@ -31,15 +41,46 @@ namespace Core {
             return (numToRound + multiple - 1) & -multiple;
         }
 
+        // A mirrored buffer keeps its data page aligned and a whole number of pages large, so
+        // it can be mapped twice. Only supported on POSIX, elsewhere the request is ignored.
+        bool Mirrorable(const bool mirrored)
+        {
+#ifdef __POSIX__
+            return (mirrored);
+#else
+            return (false);
+#endif
+        }
+
+        uint32_t DataOffset(const bool mirrored)
+        {
+#ifdef __POSIX__
+            return (mirrored == true ? RoundUp(sizeof(CyclicBuffer::control), getpagesize()) : sizeof(CyclicBuffer::control));
+#else
+            return (sizeof(CyclicBuffer::control));
+#endif
+        }
+
+        uint32_t DataSize(const uint32_t bufferSize, const bool mirrored)
+        {
+#ifdef __POSIX__
+            return (mirrored == true ? RoundUp(bufferSize, getpagesize()) : bufferSize);
+#else
+            return (bufferSize);
+#endif
+        }
     }
 
-    CyclicBuffer::CyclicBuffer(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite)
+    CyclicBuffer::CyclicBuffer(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite, const bool mirrored)
         : _buffer(
               fileName,
               (bufferSize == 0 ? (mode & (~File::CREATE)) : (mode | File::CREATE)),
-              (bufferSize == 0 ? 0 : (bufferSize + sizeof(const control))))
+              (bufferSize == 0 ? 0 : (DataSize(bufferSize, Mirrorable(mirrored)) + DataOffset(Mirrorable(mirrored)))))
         , _realBuffer(nullptr)
+        , _mirror(nullptr)
         , _alert(false)
+        , _spanTail(0)
+        , _spanNext(0)
         , _administration(nullptr)
     {
         ASSERT((mode & Core::File::USER_WRITE) != 0);
@@ -52,7 +93,6 @@ namespace Core {
 
         if (_buffer.IsValid() == true) {
             _administration = reinterpret_cast<struct control*>(_buffer.Buffer());
-            _realBuffer = (&(_buffer.Buffer()[sizeof(struct control)]));
 
             if (bufferSize != 0) {
 
@@ -91,9 +131,11 @@ namespace Core {
                 std::atomic_init(&(_administration->_head), static_cast<uint32_t>(0));
                 std::atomic_init(&(_administration->_tail), static_cast<uint32_t>(0));
                 std::atomic_init(&(_administration->_agents), static_cast<uint32_t>(0));
-                std::atomic_init(&(_administration->_state), static_cast<uint16_t>(state::UNLOCKED /* state::EMPTY */ | (overwrite ? state::OVERWRITE : 0)));
+                std::atomic_init(&(_administration->_sequence), static_cast<uint32_t>(0));
+                std::atomic_init(&(_administration->_sleepers), static_cast<uint32_t>(0));
+                std::atomic_init(&(_administration->_state), static_cast<uint16_t>(state::UNLOCKED /* state::EMPTY */ | (overwrite ? state::OVERWRITE : 0) | (Mirrorable(mirrored) ? state::MIRRORED : 0)));
                 _administration->_lockPID = 0;
-                _administration->_size = static_cast<uint32_t>(_buffer.Size() - sizeof(struct control));
+                _administration->_size = static_cast<uint32_t>(_buffer.Size() - DataOffset(Mirrorable(mirrored)));
 
                 _administration->_reserved = 0;
                 _administration->_reservedWritten = 0;
@@ -107,13 +149,18 @@ namespace Core {
                     _administration->_roundCountModulo = _administration->_roundCountModulo >> 1;
                 }
             }
+
+            Map();
         }
     }
 
     CyclicBuffer::CyclicBuffer(Core::DataElementFile& buffer, const bool initiator, const uint32_t offset, const uint32_t bufferSize, const bool overwrite)
         : _buffer(buffer)
         , _realBuffer(nullptr)
+        , _mirror(nullptr)
         , _alert(false)
+        , _spanTail(0)
+        , _spanNext(0)
         , _administration(nullptr)
     {
         // Adapt the offset to a system aligned pointer value :-)
@@ -178,6 +225,8 @@ namespace Core {
                 std::atomic_init(&(_administration->_head), static_cast<uint32_t>(0));
                 std::atomic_init(&(_administration->_tail), static_cast<uint32_t>(0));
                 std::atomic_init(&(_administration->_agents), static_cast<uint32_t>(0));
+                std::atomic_init(&(_administration->_sequence), static_cast<uint32_t>(0));
+                std::atomic_init(&(_administration->_sleepers), static_cast<uint32_t>(0));
                 std::atomic_init(&(_administration->_state), static_cast<uint16_t>(state::UNLOCKED /* state::EMPTY */ | (overwrite ? state::OVERWRITE : 0)));
                 _administration->_lockPID = 0;
                 _administration->_size = static_cast<uint32_t>(actual_bufferSize - sizeof(struct control));
@@ -199,6 +248,7 @@ namespace Core {
 
     CyclicBuffer::~CyclicBuffer()
     {
+        Unmap();
     }
 
     bool CyclicBuffer::Open()
@@ -208,8 +258,8 @@ namespace Core {
         if (loaded == false) {
             loaded = _buffer.Load();
             if (loaded == true) {
-                _realBuffer = (&(_buffer.Buffer()[sizeof(struct control)]));
                 _administration = reinterpret_cast<struct control*>(_buffer.Buffer());
+                Map();
             }
         }
 
@@ -218,12 +268,56 @@ namespace Core {
 
     void CyclicBuffer::Close()
     {
+        Unmap();
         VARIABLE_IS_NOT_USED bool result = _buffer.Destroy();
         ASSERT(result);
         _realBuffer = nullptr;
         _administration = nullptr;
     }
 
+    void CyclicBuffer::Map()
+    {
+        const bool mirrored = ((_administration->_state.load() & state::MIRRORED) != 0);
+
+        // Whoever created the buffer decided on the layout, map it accordingly.
+        _realBuffer = &(_buffer.Buffer()[DataOffset(mirrored)]);
+
+#ifdef __POSIX__
+        if ((mirrored == true) && (_mirror == nullptr)) {
+            const size_t size = _administration->_size;
+
+            // Reserve room for two copies first, then put the data in both halves.
+            uint8_t* area = static_cast<uint8_t*>(::mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+            if (area != MAP_FAILED) {
+                // A cyclic buffer is always opened for writing, see the constructor.
+                File::Handle handle = _buffer.Storage().DuplicateHandle();
+
+                if ((::mmap(area, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, handle, DataOffset(mirrored)) == area) && (::mmap(&area[size], size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, handle, DataOffset(mirrored)) == &area[size])) {
+                    _mirror = area;
+                    _realBuffer = area;
+                } else {
+                    // Just works as a plain cyclic buffer, be it with some more copying.
+                    TRACE_L1("Could not mirror the cyclic buffer %s, error: %d", _buffer.Name().c_str(), errno);
+                    ::munmap(area, 2 * size);
+                }
+
+                ::close(handle);
+            }
+        }
+#endif
+    }
+
+    void CyclicBuffer::Unmap()
+    {
+#ifdef __POSIX__
+        if (_mirror != nullptr) {
+            ::munmap(_mirror, 2 * static_cast<size_t>(_administration->_size));
+            _mirror = nullptr;
+        }
+#endif
+    }
+
     void CyclicBuffer::AdminLock()
     {
 #ifdef __POSIX__
@@ -336,6 +430,138 @@ namespace Core {
         Reevaluate();
 
         AdminUnlock();
+
+        _administration->_sequence++;
+
+        Wake();
+    }
+
+    void CyclicBuffer::Wake()
+    {
+#ifdef __LINUX__
+        // Not a private futex, the sleepers can be in other processes.
+        ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&(_administration->_sequence)), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    uint32_t CyclicBuffer::Wait(const uint32_t waitTime)
+    {
+        ASSERT(IsValid() == true);
+
+#ifdef __LINUX__
+        uint32_t result = Await(0, waitTime);
+#else
+        uint32_t result = Lock(true, waitTime);
+
+        if (result == Core::ERROR_NONE) {
+            Unlock();
+        }
+#endif
+
+        return (result);
+    }
+
+    uint32_t CyclicBuffer::WaitForRoom(const uint32_t required, const uint32_t waitTime)
+    {
+        ASSERT(IsValid() == true);
+        ASSERT((required > 0) && (required < Size()));
+
+#ifdef __LINUX__
+        uint32_t result = Await(required, waitTime);
+#else
+        // No futex to sleep on, the readers do not signal a moving tail, so poll.
+        uint32_t result = Core::ERROR_NONE;
+        const uint64_t deadline = (waitTime == Core::infinite ? static_cast<uint64_t>(~0) : Core::Time::Now().Add(waitTime).Ticks());
+
+        while ((result == Core::ERROR_NONE) && (required >= Free())) {
+            if (_alert.exchange(false) == true) {
+                result = Core::ERROR_ASYNC_ABORTED;
+            } else if (Core::Time::Now().Ticks() >= deadline) {
+                result = Core::ERROR_TIMEDOUT;
+            } else {
+                SleepMs(1);
+            }
+        }
+#endif
+
+        return (result);
+    }
+
+#ifdef __LINUX__
+    bool CyclicBuffer::Awaited(const uint32_t room) const
+    {
+        return (room == 0 ? (Used() > 0) : (Free() > room));
+    }
+
+    uint32_t CyclicBuffer::Await(const uint32_t room, const uint32_t waitTime)
+    {
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex must be a plain 32 bits word");
+
+        uint32_t result = Core::ERROR_NONE;
+
+        struct timespec deadline;
+        ::clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += (waitTime / 1000);
+        deadline.tv_nsec += ((waitTime % 1000) * 1000000);
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+
+        // Announce the sleeper before looking at the buffer, whoever moves the head or the tail
+        // after that, sees it and makes the wake up call.
+        _administration->_sleepers++;
+
+        while ((result == Core::ERROR_NONE) && (Awaited(room) == false)) {
+            // Read the sequence before looking at the buffer (again), if the head or tail moves
+            // after this, the futex will not put us to sleep.
+            const uint32_t sequence = _administration->_sequence.load();
+
+            // Alert() may run on another thread, without the admin lock held here, so consume it in one go.
+            if (_alert.exchange(false) == true) {
+                result = Core::ERROR_ASYNC_ABORTED;
+            } else if (Awaited(room) == false) {
+                struct timespec timeLeft;
+                struct timespec* timeout = nullptr;
+
+                if (waitTime != Core::infinite) {
+                    struct timespec now;
+                    ::clock_gettime(CLOCK_MONOTONIC, &now);
+
+                    timeLeft.tv_sec = deadline.tv_sec - now.tv_sec;
+                    timeLeft.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+                    if (timeLeft.tv_nsec < 0) {
+                        timeLeft.tv_sec--;
+                        timeLeft.tv_nsec += 1000000000;
+                    }
+                    timeout = &timeLeft;
+                }
+
+                if ((timeout != nullptr) && (timeLeft.tv_sec < 0)) {
+                    result = Core::ERROR_TIMEDOUT;
+                } else if ((::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&(_administration->_sequence)), FUTEX_WAIT, sequence, timeout, nullptr, 0) != 0) && (errno == ETIMEDOUT)) {
+                    result = Core::ERROR_TIMEDOUT;
+                }
+            }
+        }
+
+        _administration->_sleepers--;
+
+        if ((result == Core::ERROR_TIMEDOUT) && (Awaited(room) == true)) {
+            result = Core::ERROR_NONE;
+        }
+
+        return (result);
+    }
+#endif
+
+    void CyclicBuffer::Released()
+    {
+        // Writers waiting in WaitForRoom sleep on the same futex as the readers.
+        if (_administration->_sleepers.load() > 0) {
+            _administration->_sequence++;
+            Wake();
+        }
     }
 
     uint32_t CyclicBuffer::Read(uint8_t buffer[], const uint32_t length, bool partialRead)
@@ -399,10 +625,15 @@ namespace Core {
                         } else {
                             const uint32_t part1 = _administration->_size - offset;
                             newOffset = result - part1;
-                            ::memcpy(buffer, _realBuffer + offset, std::min(part1, bufferLength));
 
-                            if (part1 < bufferLength) {
-                                ::memcpy(buffer + part1, _realBuffer, bufferLength - part1);
+                            if (_mirror != nullptr) {
+                                ::memcpy(buffer, _realBuffer + offset, bufferLength);
+                            } else {
+                                ::memcpy(buffer, _realBuffer + offset, std::min(part1, bufferLength));
+
+                                if (part1 < bufferLength) {
+                                    ::memcpy(buffer + part1, _realBuffer, bufferLength - part1);
+                                }
                             }
                         }
 
@@ -417,6 +648,10 @@ namespace Core {
             }
         }
 
+        if (foundData == true) {
+            Released();
+        }
+
          return (result);
     }
 
@@ -468,7 +703,7 @@ namespace Core {
 
         // Perform actual copy.
         uint32_t writeEnd = (writeStart + length) % _administration->_size;
-        if (writeEnd >= writeStart) {
+        if ((writeEnd >= writeStart) || (_mirror != nullptr)) {
             // Easy case: one pass.
             memcpy(_realBuffer + writeStart, buffer, length);
         } else {
@@ -481,29 +716,45 @@ namespace Core {
         }
 
         if (shouldMoveHead) {
-            bool startingEmpty = (Used() == 0);
-            _administration->_head = writeEnd;
+            Advance(tail, writeEnd);
+        }
 
-            if (startingEmpty) {
-                // Was empty before, tell observers about new data.
-                AdminLock();
+            return length;
+        }
 
-                Reevaluate();
-                DataAvailable();
+    void CyclicBuffer::Advance(const uint32_t tail, const uint32_t head)
+    {
+        bool startingEmpty = (Used() == 0);
+        _administration->_head = head;
 
-                AdminUnlock();
-            } else {
-                //The tail moved during write which could mean the reader read everything from the buffer
-                //and won't be notified about new data coming in, because the writer thinks it is not empty.
-                //Make sure the used size (based on the new tail position) is greater than 0
-                if ((tail != _administration->_tail) && (Used() > 0)) {
-                    DataAvailable();
-                }
-            }
+        // Readers sleeping in Wait() only need a syscall to wake them, if there are any.
+        _administration->_sequence++;
+
+        if (_administration->_sleepers.load() > 0) {
+            Wake();
         }
 
-            return length;
+        if (startingEmpty) {
+            // Was empty before, tell observers about new data.
+            // This is the one spot a writer still takes the admin lock, and only on the empty
+            // to non-empty edge. Lock(true) checks Used() under that lock, before it registers
+            // as an agent, and DataAvailable() overrides expect to run under it. Skipping it when
+            // no agent is registered would race with that check and lose the wakeup.
+            AdminLock();
+
+            Reevaluate();
+            DataAvailable();
+
+            AdminUnlock();
+        } else {
+            //The tail moved during write which could mean the reader read everything from the buffer
+            //and won't be notified about new data coming in, because the writer thinks it is not empty.
+            //Make sure the used size (based on the new tail position) is greater than 0
+            if ((tail != _administration->_tail) && (Used() > 0)) {
+                DataAvailable();
+            }
         }
+    }
 
     void CyclicBuffer::AssureFreeSpace(uint32_t required)
     {
@@ -530,39 +781,161 @@ namespace Core {
         }
     }
 
-    uint32_t CyclicBuffer::Reserve(const uint32_t length)
+    bool CyclicBuffer::Claim(const uint32_t length)
     {
-        pid_t processId;
+        bool result = false;
         pid_t expectedProcessId = 0;
 
 #ifdef __WINDOWS__
-        processId = GetCurrentProcessId();
+        const pid_t processId = GetCurrentProcessId();
 #else
-        processId = ::getpid();
+        const pid_t processId = ::getpid();
 #endif
 
+        // Maximum write size is _administration->_size-1, to differentiate from empty situation.
+        if ((length < Size()) && (((_administration->_state.load() & state::OVERWRITE) != 0) || (length < Free()))) {
+            if (atomic_compare_exchange_strong(&(_administration->_reservedPID), &expectedProcessId, processId) == true) {
+                AssureFreeSpace(length);
+                INTERNAL_ASSERT(length <= Free());
+
+                _administration->_reserved = length;
+                _administration->_reservedWritten = 0;
+
+                result = true;
+            }
+        }
+
+        return (result);
+    }
+
+    uint32_t CyclicBuffer::Reserve(const uint32_t length)
+    {
         if ((length >= Size()) || (((_administration->_state.load() & state::OVERWRITE) == 0) && (length >= Free())))
             return Core::ERROR_INVALID_INPUT_LENGTH;
 
-        bool noOtherReservation = atomic_compare_exchange_strong(&(_administration->_reservedPID), &expectedProcessId, processId);
+        bool noOtherReservation = Claim(length);
         INTERNAL_ASSERT(noOtherReservation);
 
         if (!noOtherReservation)
             return Core::ERROR_ILLEGAL_STATE;
 
-        uint32_t actualLength = length;
-        if (length >= _administration->_size) {
-            // Maximum write size is _administration->_size-1, to differentiate from empty situation.
-            actualLength = _administration->_size - 1;
+        return length;
+    }
+
+    uint8_t* CyclicBuffer::ReserveSpan(const uint32_t length)
+    {
+        uint8_t* result = nullptr;
+
+        // Check if it is contiguous before claiming, in overwrite mode claiming makes room.
+        const bool contiguous = ((_mirror != nullptr) || ((_administration->_head + length) <= _administration->_size));
+
+        // Not through Reserve(), its error codes can not be told apart from a reserved length.
+        if ((contiguous == true) && (length > 0) && (Claim(length) == true)) {
+            // With the reservation taken, no other writer moves the head.
+            const uint32_t head = _administration->_head;
+
+            if ((_mirror != nullptr) || ((head + length) <= _administration->_size)) {
+                result = &(_realBuffer[head]);
+            } else {
+                _administration->_reservedPID = 0;
+            }
+        }
+
+        return (result);
+    }
+
+    uint32_t CyclicBuffer::CommitSpan()
+    {
+        uint32_t length = 0;
+
+#ifdef __WINDOWS__
+        const pid_t processId = GetCurrentProcessId();
+#else
+        const pid_t processId = ::getpid();
+#endif
+
+        // Nothing to commit, if this process holds no reservation.
+        if (_administration->_reservedPID == processId) {
+            uint32_t tail = _administration->_tail;
+            length = _administration->_reserved - _administration->_reservedWritten;
+
+            // The data is in place already, all that is left is moving the head.
+            _administration->_reservedWritten = _administration->_reserved;
+            _administration->_reservedPID = 0;
+
+            Advance(tail, (_administration->_head + _administration->_reserved) % _administration->_size);
         }
 
-        AssureFreeSpace(actualLength);
-        INTERNAL_ASSERT(actualLength <= Free());
+        return (length);
+    }
+
+    const uint8_t* CyclicBuffer::ReadSpan(uint32_t& length)
+    {
+        ASSERT(IsValid() == true);
+
+        const uint8_t* result = nullptr;
+        bool retry = true;
+
+        length = 0;
+
+        while (retry == true) {
+            uint32_t oldTail = _administration->_tail;
+            uint32_t offset = oldTail & _administration->_tailIndexMask;
+            uint32_t used = Used(_administration->_head, offset);
+
+            retry = false;
 
-        _administration->_reserved = actualLength;
-        _administration->_reservedWritten = 0;
+            if (used > 0) {
+                Cursor cursor(*this, oldTail, used);
+                uint32_t size = GetReadSize(cursor);
 
-        return actualLength;
+                if (oldTail != _administration->_tail) {
+                    // The writer moved the tail, the size can not be trusted.
+                    retry = true;
+                } else if (size != 0) {
+                    ASSERT(size <= used);
+
+                    offset += cursor.Offset();
+
+                    // A size prefix might have wrapped already.
+                    const uint32_t start = offset % _administration->_size;
+
+                    if ((_mirror != nullptr) || ((start + size) <= _administration->_size)) {
+                        uint32_t roundCount = oldTail / (1 + _administration->_tailIndexMask);
+                        uint32_t end = offset + size;
+
+                        if (end >= _administration->_size) {
+                            end -= _administration->_size;
+
+                            // Add one round, but prevent overflow.
+                            roundCount = (roundCount + 1) % _administration->_roundCountModulo;
+                        }
+
+                        _spanTail = oldTail;
+                        _spanNext = end + roundCount * (1 + _administration->_tailIndexMask);
+
+                        length = size;
+                        result = &(_realBuffer[start]);
+                    }
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    bool CyclicBuffer::ReleaseSpan()
+    {
+        uint32_t expected = _spanTail;
+
+        // If the tail is not where it was, the span was overwritten (or read by someone else).
+        const bool result = _administration->_tail.compare_exchange_strong(expected, _spanNext);
+
+        if (result == true) {
+            Released();
+        }
+
+        return (result);
     }
 
     uint32_t CyclicBuffer::Lock(const bool dataPresent, const uint32_t waitTime)
@@ -596,8 +969,7 @@ namespace Core {
 
                 AdminLock();
 
-                if (_alert == true) {
-                    _alert = false;
+                if (_alert.exchange(false) == true) {
                     result = Core::ERROR_ASYNC_ABORTED;
                 }
             }
@@ -662,13 +1034,13 @@ namespace Core {
 
             uint32_t readEnd = tail + result;
 
-            if (readEnd < _administration->_size) {
+            if ((readEnd < _administration->_size) || (_mirror != nullptr)) {
                 // Can be done in one pass.
                 memcpy(buffer, _realBuffer + tail, result);
             } else {
                 // Needs to be done in two passes.
                 uint32_t firstLength = _administration->_size - tail;
-                uint32_t secondLength = length - firstLength;
+                uint32_t secondLength = result - firstLength;
 
                 memcpy(buffer, _realBuffer + tail, firstLength);
                 memcpy(buffer + firstLength, _realBuffer, secondLength);
@@ -41,13 +41,15 @@ namespace Core {
     // This class allows to share data over process boundaries. Private access can be arranged by taking a lock.
     // The lock is also Process Wide.
     // Whoever holds the lock, can privately read or write from the buffer.
+    // A mirrored buffer maps its data twice, back to back, so every record in it is contiguous
+    // in memory and can be written or parsed in place (see ReserveSpan and ReadSpan).
     class EXTERNAL CyclicBuffer {
     public:
         CyclicBuffer() = delete;
         CyclicBuffer(const CyclicBuffer&) = delete;
         CyclicBuffer& operator=(const CyclicBuffer&) = delete;
 
-        CyclicBuffer(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite);
+        CyclicBuffer(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite, const bool mirrored = false);
         CyclicBuffer(Core::DataElementFile& buffer, const bool initiator, const uint32_t offset, const uint32_t bufferSize, const bool overwrite);
         virtual ~CyclicBuffer();
 
@@ -69,11 +71,15 @@ namespace Core {
                 startIndex += _Offset;
                 startIndex %= _Parent._administration->_size;
 
-                uint8_t* bytePtr = reinterpret_cast<uint8_t*>(&buffer);
+                if ((_Parent._mirror != nullptr) || ((startIndex + sizeof(buffer)) <= _Parent._administration->_size)) {
+                    ::memcpy(&buffer, &(_Parent._realBuffer[startIndex]), sizeof(buffer));
+                } else {
+                    uint8_t* bytePtr = reinterpret_cast<uint8_t*>(&buffer);
 
-                for (uint32_t i = 0; i < sizeof(buffer); i++) {
-                    uint32_t index = (startIndex + i) % _Parent._administration->_size;
-                    bytePtr[i] = _Parent._realBuffer[index];
+                    for (uint32_t i = 0; i < sizeof(buffer); i++) {
+                        uint32_t index = (startIndex + i) % _Parent._administration->_size;
+                        bytePtr[i] = _Parent._realBuffer[index];
+                    }
                 }
             }
 
@@ -191,6 +197,10 @@ namespace Core {
         {
             return (_administration != nullptr);
         }
+        inline bool IsMirrored() const
+        {
+            return (_mirror != nullptr);
+        }
         inline const File& Storage() const
         {
             return (_buffer.Storage());
@@ -229,6 +239,17 @@ namespace Core {
         uint32_t Lock(bool dataPresent = false, const uint32_t waitTime = Core::infinite);
         uint32_t Unlock();
 
+        // THREAD SAFE
+        // Block till there is data in the buffer, without taking the lock. On Linux the
+        // reader sleeps on a futex in the shared administration and a writer only makes
+        // the wake up call if someone is actually sleeping. Alert() aborts the wait.
+        uint32_t Wait(const uint32_t waitTime = Core::infinite);
+
+        // THREAD SAFE
+        // Block till more than "required" bytes are free, without taking the lock. Only of use
+        // if the buffer does not overwrite, then the readers make the room. Alert() aborts the wait.
+        uint32_t WaitForRoom(const uint32_t required, const uint32_t waitTime);
+
         // Extract data from the cyclic buffer. Peek, is nondestructive. The cyclic
         // tail pointer is not progressed.
         uint32_t Peek(uint8_t buffer[], const uint32_t length) const;
@@ -246,16 +267,33 @@ namespace Core {
         //    readers seeing incomplete data.
         uint32_t Reserve(const uint32_t length);
 
+        // Zero copy writing. Reserves "length" bytes and hands out where they go in the buffer,
+        // CommitSpan makes them available to the readers. Unless the buffer is mirrored, a
+        // span that would wrap is not handed out (nullptr), use Reserve/Write instead. Nor is
+        // one that does not fit or while another reservation is pending. CommitSpan returns the
+        // number of bytes committed, 0 if this process holds no reservation.
+        uint8_t* ReserveSpan(const uint32_t length);
+        uint32_t CommitSpan();
+
+        // Zero copy reading. Hands out the next entry (as sized by GetReadSize) in place, the
+        // tail only moves on ReleaseSpan. In overwrite mode the writer might claim the entry
+        // meanwhile, if ReleaseSpan fails, whatever was taken from the span must be dropped.
+        // Unless the buffer is mirrored, a wrapping entry is not handed out, use Read instead.
+        const uint8_t* ReadSpan(uint32_t& length);
+        bool ReleaseSpan();
+
         virtual void DataAvailable();
 
     protected:
         inline bool Unlink()
         {
+            Unmap();
             _administration = nullptr;
             return (_buffer.Unlink());
         }
         inline bool Destroy()
         {
+            Unmap();
             _administration = nullptr;
             return (_buffer.Destroy());
         }
@@ -281,17 +319,37 @@ namespace Core {
         void Reevaluate();
         uint32_t SignalLock(const uint32_t waitTime);
 
+        // Moves the head after a write, and wakes up whoever waits for data.
+        void Advance(const uint32_t tail, const uint32_t head);
+        void Wake();
+        // The tail moved, wakes up the writers waiting for room.
+        void Released();
+#ifdef __LINUX__
+        bool Awaited(const uint32_t room) const;
+        uint32_t Await(const uint32_t room, const uint32_t waitTime);
+#endif
+        bool Claim(const uint32_t length);
+
+        void Map();
+        void Unmap();
+
     private:
         enum state {
             UNLOCKED = 0x00,
             LOCKED = 0x01,
             OVERWRITE = 0x02,
-            OVERWRITTEN = 0x04
+            OVERWRITTEN = 0x04,
+            MIRRORED = 0x08
         };
 
         Core::DataElementFile _buffer;
         uint8_t* _realBuffer;
-        bool _alert;
+        uint8_t* _mirror;
+        std::atomic<bool> _alert;
+
+        // The entry handed out by ReadSpan.
+        uint32_t _spanTail;
+        uint32_t _spanNext;
 
 // Synchronisation over Process boundaries
 #ifdef __WINDOWS__
@@ -314,6 +372,10 @@ namespace Core {
             uint32_t _tailIndexMask; // Bitmask of index in buffer, rest is round count.
             uint32_t _roundCountModulo; // Value with which to mod round count to prevent overflow.
             std::atomic<uint32_t> _agents;
+            std::atomic<uint32_t> _sequence; // Bumped on every move of the head, the futex readers sleep on.
+            // Readers sleeping on the sequence. Only a hint for the writers: a reader that dies while asleep
+            // leaves it raised, which costs every later move of the head a needless wake, but never a lost one.
+            std::atomic<uint32_t> _sleepers;
             std::atomic<uint16_t> _state;
             uint32_t _size;
             pid_t _lockPID;
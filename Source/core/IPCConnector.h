@@ -20,13 +20,17 @@
 #ifndef __IPCCONNECTOR_H_
 #define __IPCCONNECTOR_H_
 
+#include "CyclicBuffer.h"
+#include "DoorBell.h"
 #include "Factory.h"
 #include "IAction.h"
 #include "Link.h"
 #include "Module.h"
 #include "Portability.h"
 #include "SocketPort.h"
+#include "Thread.h"
 #include "TypeTraits.h"
+#include "WorkerPool.h"
 
 namespace Thunder {
 
@@ -39,6 +43,16 @@ namespace Core {
         typedef IMessage BaseElement;
         typedef uint32_t Identifier;
 
+        // Every message on the wire starts with a header of variable length encoded
+        // numbers: the length, the label and, if pipelining is enabled, the sequence
+        // number that ties a response to its request.
+#ifdef __CORE_IPC_PIPELINING__
+        static constexpr uint8_t HeaderSize = 12;
+#else
+        static constexpr uint8_t HeaderSize = 8;
+#endif
+        static constexpr uint32_t MaxSequence = 0x1FFFFFFF;
+
         class Serializer {
         public:
             Serializer(const Serializer&) = delete;
@@ -82,7 +96,10 @@ namespace Core {
 
                 while ((_current != nullptr) && (result < maxLength)) {
                     if (_offset < 4) {
-                        uint32_t length = _length + CommandSize();
+                        uint32_t length = _length + EncodedSize(_current->Label());
+#ifdef __CORE_IPC_PIPELINING__
+                        length += EncodedSize(_current->Sequence());
+#endif
 
                         // Write the length. Continue as long as the top bt is active..
                         while ((_offset < 4) && (result < maxLength)) {
@@ -111,16 +128,31 @@ namespace Core {
                         }
                     }
 
+#ifdef __CORE_IPC_PIPELINING__
+                    // Write the sequence, Same structure as length..
+                    while ((_offset < 12) && (result < maxLength)) {
+                        uint32_t value = _current->Sequence() >> (7 * (_offset - 8));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+
+                        if (value >= 0x80) {
+                            _offset++;
+                        } else {
+                            _offset = 12;
+                        }
+                    }
+#endif
+
                     if (result < maxLength) {
                         // Write the command, Same structure as length..
-                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 8);
+                        uint16_t handled = static_cast<uint16_t>(_current->Serialize(&stream[result], maxLength - result, _offset - IMessage::HeaderSize));
 
                         result += handled;
                         _offset += handled;
 
-                        ASSERT_VERBOSE((_offset - 8) <= _length, "%d <= %d", (_offset - 8), _length);
+                        ASSERT_VERBOSE((_offset - IMessage::HeaderSize) <= _length, "%d <= %d", (_offset - IMessage::HeaderSize), _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - IMessage::HeaderSize) == _length) {
                             const IMessage* ready = _current;
                             _current = nullptr;
 
@@ -135,9 +167,9 @@ namespace Core {
             virtual void Serialized(const IMessage& element) = 0;
 
         private:
-            uint32_t CommandSize() const
+            static uint32_t EncodedSize(const uint32_t value)
             {
-                return (_current->Label() > 0x1FFFFF ? 4 : (_current->Label() > 0xCFFF ? 3 : (_current->Label() > 0x7F ? 2 : 1)));
+                return (value > 0x1FFFFF ? 4 : (value > 0x3FFF ? 3 : (value > 0x7F ? 2 : 1)));
             }
 
         private:
@@ -155,6 +187,7 @@ namespace Core {
                 : _length(0)
                 , _offset(0)
                 , _label(0)
+                , _sequence(0)
                 , _current(nullptr)
             {
             }
@@ -162,14 +195,14 @@ namespace Core {
 
         public:
             virtual void Deserialized(IMessage& element) = 0;
-            virtual IMessage* Element(const uint32_t& label) = 0;
+            virtual IMessage* Element(const uint32_t& label, const uint32_t sequence) = 0;
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
             {
                 uint16_t result = 0;
 
                 while (result < maxLength) {
-					if ((_current == nullptr) && (_offset < 8)) {
+					if ((_current == nullptr) && (_offset < IMessage::HeaderSize)) {
                         // We have nothing, start by getting the length/command
                         while ((_offset < 4) && (result < maxLength)) {
                             _length |= ((stream[result] & (_offset == 3 ? 0xFF : 0x7F)) << (7 * _offset));
@@ -192,33 +225,47 @@ namespace Core {
                             }
                         }
 
-                        if (_offset == 8) {
-                            _current = Element(_label);
+#ifdef __CORE_IPC_PIPELINING__
+                        while ((_offset >= 8) && (_offset < 12) && (result < maxLength)) {
+                            _sequence |= ((stream[result] & (_offset == 11 ? 0xFF : 0x7F)) << (7 * (_offset - 8)));
+                            _length--;
+
+                            if ((stream[result++] & 0x80) != 0) {
+                                _offset++;
+                            } else {
+                                _offset = 12;
+                            }
+                        }
+#endif
+
+                        if (_offset == IMessage::HeaderSize) {
+                            _current = Element(_label, _sequence);
                             _label = 0;
+                            _sequence = 0;
                         }
                     }
 
-                    if (_offset >= 8) {
+                    if (_offset >= IMessage::HeaderSize) {
 
-                        ASSERT((_offset - 8) <= _length);
+                        ASSERT((_offset - IMessage::HeaderSize) <= _length);
 
-                        if ((_offset - 8) < _length) {
+                        if ((_offset - IMessage::HeaderSize) < _length) {
 
                             // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                            uint32_t tmp = _length - (_offset - 8);
+                            uint32_t tmp = _length - (_offset - IMessage::HeaderSize);
                             uint16_t handled(static_cast<uint32_t>(maxLength - result) > tmp ? static_cast<uint16_t>(tmp) : (maxLength - result));
 
                             if (_current != nullptr) {
-                                handled = _current->Deserialize(&stream[result], handled, _offset - 8);
+                                handled = static_cast<uint16_t>(_current->Deserialize(&stream[result], handled, _offset - IMessage::HeaderSize));
                             }
 
                             _offset += handled;
                             result += handled;
                         }
 
-                        ASSERT((_offset - 8) <= _length);
+                        ASSERT((_offset - IMessage::HeaderSize) <= _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - IMessage::HeaderSize) == _length) {
                             if (_current != nullptr) {
                                 IMessage* ready = _current;
                                 _current = nullptr;
@@ -236,6 +283,7 @@ namespace Core {
             uint32_t _length;
             uint32_t _offset;
             uint32_t _label;
+            uint32_t _sequence;
             IMessage* _current;
         };
 
@@ -243,15 +291,18 @@ namespace Core {
         virtual ~IMessage() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
         virtual uint32_t Length() const = 0;
-        virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
-        virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
+        virtual uint32_t Serialize(uint8_t[] /* stream*/, const uint32_t /* maxLength */, const uint32_t offset) const = 0;
+        virtual uint32_t Deserialize(const uint8_t[] /* stream*/, const uint32_t /* maxLength */, const uint32_t offset) = 0;
     };
 
     struct EXTERNAL IIPC {
         virtual ~IIPC() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
+        virtual void Sequence(const uint32_t sequence) = 0;
         virtual ProxyType<IMessage> IParameters() = 0;
         virtual ProxyType<IMessage> IResponse() = 0;
     };
@@ -307,15 +358,19 @@ namespace Core {
             {
                 return (REALIDENTIFIER);
             }
+            uint32_t Sequence() const override
+            {
+                return (_parent.Sequence());
+            }
             uint32_t Length() const override
             {
                 return (_Length());
             }
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const override
             {
                 return (_Serialize(stream, maxLength, offset));
             }
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset) override
             {
                 return _Deserialize(stream, maxLength, offset);
             }
@@ -358,20 +413,41 @@ namespace Core {
                 return (sizeof(PACKAGE));
             }
 
+            // Packages may offer a Serialize/Deserialize pair taking a 32 bits length,
+            // or the older pair taking a 16 bits length. The latter is still supported
+            // and gets fed in windows of at most 64KB.
             IS_MEMBER_AVAILABLE(Serialize, hasSerialize);
 
             template <typename SUBJECT= PACKAGE>
-            typename Core::TypeTraits::enable_if<hasSerialize<const SUBJECT, uint16_t, uint8_t[], const uint16_t, const uint32_t>::value, uint16_t>::type
-            _Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            typename Core::TypeTraits::enable_if<hasSerialize<const SUBJECT, uint32_t, uint8_t[], const uint32_t, const uint32_t>::value, uint32_t>::type
+            _Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
                 return (_package.Serialize(stream, maxLength, offset));
             }
 
             template <typename SUBJECT= PACKAGE>
-            typename Core::TypeTraits::enable_if<!hasSerialize<const SUBJECT, uint16_t, uint8_t[], const uint16_t, const uint32_t>::value, uint16_t>::type
-            _Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            typename Core::TypeTraits::enable_if<hasSerialize<const SUBJECT, uint16_t, uint8_t[], const uint16_t, const uint32_t>::value, uint32_t>::type
+            _Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
+                uint16_t handled;
+
+                do {
+                    const uint16_t window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+
+                    handled = _package.Serialize(&(stream[result]), window, offset + result);
+                    result += handled;
+
+                } while ((handled == 0xFFFF) && (result < maxLength));
+
+                return (result);
+            }
+
+            template <typename SUBJECT= PACKAGE>
+            typename Core::TypeTraits::enable_if<!hasSerialize<const SUBJECT, uint32_t, uint8_t[], const uint32_t, const uint32_t>::value && !hasSerialize<const SUBJECT, uint16_t, uint8_t[], const uint16_t, const uint32_t>::value, uint32_t>::type
+            _Serialize(uint8_t stream[], const uint32_t maxLength, const uint32_t offset) const
+            {
+                uint32_t result = 0;
                 uint32_t packageLength = _Length();
 
                 if (offset < packageLength) {
@@ -384,20 +460,38 @@ namespace Core {
             IS_MEMBER_AVAILABLE(Deserialize, hasDeserialize);
 
             template <typename SUBJECT=PACKAGE>
-            typename Core::TypeTraits::enable_if<hasDeserialize<SUBJECT, uint16_t, const uint8_t[], const uint16_t, const uint32_t>::value, uint16_t>::type
-            _Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            typename Core::TypeTraits::enable_if<hasDeserialize<SUBJECT, uint32_t, const uint8_t[], const uint32_t, const uint32_t>::value, uint32_t>::type
+            _Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
             {
                 return (_package.Deserialize(stream, maxLength, offset));
             }
 
             template <typename SUBJECT=PACKAGE>
-            typename Core::TypeTraits::enable_if<!hasDeserialize<SUBJECT, uint16_t, const uint8_t[], const uint16_t, const uint32_t>::value, uint16_t>::type
-            _Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            typename Core::TypeTraits::enable_if<hasDeserialize<SUBJECT, uint16_t, const uint8_t[], const uint16_t, const uint32_t>::value, uint32_t>::type
+            _Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
+                uint16_t handled;
+
+                do {
+                    const uint16_t window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+
+                    handled = _package.Deserialize(&(stream[result]), window, offset + result);
+                    result += handled;
+
+                } while ((handled == 0xFFFF) && (result < maxLength));
+
+                return (result);
+            }
+
+            template <typename SUBJECT=PACKAGE>
+            typename Core::TypeTraits::enable_if<!hasDeserialize<SUBJECT, uint32_t, const uint8_t[], const uint32_t, const uint32_t>::value && !hasDeserialize<SUBJECT, uint16_t, const uint8_t[], const uint16_t, const uint32_t>::value, uint32_t>::type
+            _Deserialize(const uint8_t stream[], const uint32_t maxLength, const uint32_t offset)
+            {
+                uint32_t result = 0;
 
                 if (offset < sizeof(SUBJECT)) {
-                    result = (maxLength > static_cast<uint16_t>(sizeof(SUBJECT) - offset) ? static_cast<uint16_t>(sizeof(SUBJECT) - offset) : maxLength);
+                    result = (maxLength > static_cast<uint32_t>(sizeof(SUBJECT) - offset) ? static_cast<uint32_t>(sizeof(SUBJECT) - offset) : maxLength);
                     ::memcpy(&(reinterpret_cast<uint8_t*>(&_package)[offset]), stream, result);
                 }
                 return (result);
@@ -419,11 +513,13 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         IPCMessageType()
             : _parameters(*this)
             , _response(*this)
+            , _sequence(0)
         {
         }
         IPCMessageType(const PARAMETERS& info)
             : _parameters(*this, info)
             , _response(*this)
+            , _sequence(0)
         {
         }
 POP_WARNING()
@@ -453,6 +549,14 @@ POP_WARNING()
         {
             return (IDENTIFIER);
         }
+        uint32_t Sequence() const override
+        {
+            return (_sequence);
+        }
+        void Sequence(const uint32_t sequence) override
+        {
+            _sequence = sequence;
+        }
         ProxyType<IMessage> IParameters() override
         {
             return (ProxyType<IMessage>(_parameters, _parameters));
@@ -465,19 +569,62 @@ POP_WARNING()
     private:
         ParameterType _parameters;
         ResponseType _response;
+        uint32_t _sequence;
     };
 
     class EXTERNAL IPCChannel {
     public:
+        // Size of each of the two rings of the shared memory path.
+        static constexpr uint32_t SharedRingSize = 64 * 1024;
+
         class EXTERNAL IPCFactory {
         private:
             friend IPCChannel;
 
+            class Outbound {
+            public:
+                Outbound() = delete;
+                Outbound& operator=(const Outbound&) = delete;
+
+                Outbound(const Core::ProxyType<IIPC>& message, IDispatchType<IIPC>* callback)
+                    : _message(message)
+                    , _callback(callback)
+                {
+                }
+                Outbound(const Outbound& copy)
+                    : _message(copy._message)
+                    , _callback(copy._callback)
+                {
+                }
+                ~Outbound() = default;
+
+            public:
+                Core::ProxyType<IIPC>& Message()
+                {
+                    return (_message);
+                }
+                // Report the completion (or abort) of the call, only once.
+                void Dispatch()
+                {
+                    if (_callback != nullptr) {
+                        IDispatchType<IIPC>* callback = _callback;
+                        _callback = nullptr;
+                        callback->Dispatch(*_message);
+                    }
+                }
+
+            private:
+                Core::ProxyType<IIPC> _message;
+                IDispatchType<IIPC>* _callback;
+            };
+
+            using OutboundMap = std::map<uint32_t, Outbound>;
+
             IPCFactory()
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory()
                 , _handlers()
             {
@@ -497,7 +644,7 @@ POP_WARNING()
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory(factory)
                 , _handlers()
             {
@@ -553,37 +700,35 @@ POP_WARNING()
 
             bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+                bool result = (_outbound.empty() == false);
+                _lock.Unlock();
+
+                return (result);
             }
 
-            ProxyType<IMessage> Element(const uint32_t& identifier)
+            ProxyType<IMessage> Element(const uint32_t& identifier, const uint32_t sequence)
             {
                 ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
-
-                _lock.Lock();
 
                 if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
-                    } else {
-                        TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
-                    }
+                    result = Response(identifier, sequence);
                 } else {
-                    ASSERT(_inbound.IsValid() == false);
-
-                    ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
+                    ProxyType<IIPC> rpcCall(Inbound(identifier, sequence));
 
                     if (rpcCall.IsValid() == true) {
+                        _lock.Lock();
+
+                        ASSERT(_inbound.IsValid() == false);
+
                         _inbound = rpcCall;
+
+                        _lock.Unlock();
+
                         result = rpcCall->IParameters();
-                    } else {
-                        TRACE_L1("No RPC method definition for ID [%d].\n", searchIdentifier);
                     }
                 }
 
-                _lock.Unlock();
-
                 return (result);
             }
 
@@ -595,10 +740,8 @@ POP_WARNING()
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
-
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
+                if (_outbound.empty() == false) {
+                    _outbound.clear();
                     result = true;
                 }
                 if (_inbound.IsValid() == true) {
@@ -615,62 +758,161 @@ POP_WARNING()
             {
                 ProxyType<IIPCServer> procedure;
 
+                if (Completed(rhs) == false) {
+
+                    _lock.Lock();
+
+                    // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
+                    if (_inbound.IsValid() == true) {
+                        inbound = _inbound;
+                        _inbound.Release();
+                    } else {
+                        ASSERT(false && "Received something that is neither an inbound nor on outbound!!!");
+                    }
+
+                    _lock.Unlock();
+
+                    if (inbound.IsValid() == true) {
+                        procedure = Handler(inbound->Label());
+                    }
+                }
+
+                return (procedure);
+            }
+
+            // The building blocks of the above, for messages that do not come in through the
+            // deserializer of the socket and thus do not use its inbound slot.
+            ProxyType<IIPC> Inbound(const uint32_t identifier, const uint32_t sequence)
+            {
+                ASSERT((identifier & 0x01) == 0);
+
                 _lock.Lock();
 
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                ProxyType<IIPC> rpcCall(_factory->Element(identifier >> 1));
 
-                    ASSERT(_callback != nullptr);
+                _lock.Unlock();
+
+                if (rpcCall.IsValid() == true) {
+                    // The response must carry the sequence of the request.
+                    rpcCall->Sequence(sequence);
+                } else {
+                    TRACE_L1("No RPC method definition for ID [%d].\n", (identifier >> 1));
+                }
+
+                return (rpcCall);
+            }
+            ProxyType<IMessage> Response(const uint32_t identifier, const uint32_t sequence)
+            {
+                ASSERT((identifier & 0x01) != 0);
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                ProxyType<IMessage> result;
+                uint32_t searchIdentifier(identifier >> 1);
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                _lock.Lock();
+
+                OutboundMap::iterator index(_outbound.find(sequence));
+
+                if ((index != _outbound.end()) && (index->second.Message()->Label() == searchIdentifier)) {
+                    result = index->second.Message()->IResponse();
+                } else {
+                    TRACE_L1("Unexpected response message for ID [%d], sequence [%d].\n", searchIdentifier, sequence);
                 }
-                // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
-                else if (_inbound.IsValid() == true) {
 
-                    std::map<uint32_t, ProxyType<IIPCServer>>::iterator index(_handlers.find(_inbound->Label()));
+                _lock.Unlock();
 
-					ASSERT(index != _handlers.end());
+                return (result);
+            }
+            ProxyType<IIPCServer> Handler(const uint32_t label) const
+            {
+                ProxyType<IIPCServer> procedure;
 
-                    if (index != _handlers.end()) {
-                        procedure = (*index).second;
-                        inbound = _inbound;
-                    } else {
-                        TRACE_L1("No handler defined to handle the incoming frames. [%d]", _inbound->Label());
-                    }
+                _lock.Lock();
 
-                    _inbound.Release();
+                std::map<uint32_t, ProxyType<IIPCServer>>::const_iterator index(_handlers.find(label));
+
+                ASSERT(index != _handlers.end());
+
+                if (index != _handlers.end()) {
+                    procedure = (*index).second;
                 } else {
-                    ASSERT(false && "Received something that is neither an inbound nor on outbound!!!");
+                    TRACE_L1("No handler defined to handle the incoming frames. [%d]", label);
                 }
 
                 _lock.Unlock();
 
                 return (procedure);
             }
+            // Returns true if this was the response to one of our outstanding calls.
+            bool Completed(const Core::ProxyType<IMessage>& response)
+            {
+                _lock.Lock();
 
-            void SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
+                OutboundMap::iterator outbound(_outbound.find(response->Sequence()));
+                bool result = ((outbound != _outbound.end()) && (outbound->second.Message()->IResponse() == response));
+
+                if (result == true) {
+
+                    Outbound handledObject(outbound->second);
+
+                    _outbound.erase(outbound);
+                    handledObject.Dispatch();
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Returns the sequence number that identifies this call on the channel.
+            uint32_t SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
             {
                 _lock.Lock();
 
                 ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
 
-                _outbound = outbound;
-                _callback = callback;
+#ifdef __CORE_IPC_PIPELINING__
+                _sequence = (_sequence == IMessage::MaxSequence ? 1 : _sequence + 1);
+#endif
+                // Without pipelining the sequence is not on the wire and stays 0, one call at a time.
+                const uint32_t sequence = _sequence;
+
+                ASSERT(_outbound.find(sequence) == _outbound.end());
+
+                outbound->Sequence(sequence);
+                _outbound.erase(sequence);
+                _outbound.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(sequence),
+                    std::forward_as_tuple(outbound, callback));
+
+                _lock.Unlock();
+
+                return (sequence);
+            }
+
+            // Forget about a call, returns true if it had not been completed.
+            bool Revoke(const uint32_t sequence)
+            {
+                _lock.Lock();
+
+                OutboundMap::iterator index(_outbound.find(sequence));
+                bool result = (index != _outbound.end());
+
+                if (result == true) {
+                    _outbound.erase(index);
+                }
 
                 _lock.Unlock();
+
+                return (result);
             }
 
             void Abort()
             {
                 _lock.Lock();
 
-                if (_callback != nullptr) {
-                    _callback->Dispatch(*_outbound);
-                    _callback = nullptr;
+                // Calls stay registered, so whoever is waiting can see they were not completed.
+                for (std::pair<const uint32_t, Outbound>& entry : _outbound) {
+                    entry.second.Dispatch();
                 }
 
                 _lock.Unlock();
@@ -679,16 +921,278 @@ POP_WARNING()
         private:
             mutable CriticalSection _lock;
             Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            OutboundMap _outbound;
+            uint32_t _sequence;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
         };
 
+    private:
+        // Next to the socket, messages can be exchanged through a pair of shared memory rings.
+        // Each side writes in its own ring, the other side has a thread waiting on that ring that
+        // picks up the message and handles it like the socket would. Once a side writes in its
+        // ring, it sends everything through it, so no message can overtake another one. The only
+        // exception is the thread reading the ring: it must keep on reading to let the other side
+        // make progress, so it never waits for the ring and takes the socket if it is not free.
+        class SharedPath : public Thread {
+        private:
+            class Buffer : public CyclicBuffer {
+            public:
+                Buffer() = delete;
+                Buffer(const Buffer&) = delete;
+                Buffer& operator=(const Buffer&) = delete;
+
+                Buffer(const string& fileName, const bool initiator, const uint32_t size)
+                    : CyclicBuffer(fileName, File::USER_READ | File::USER_WRITE | File::GROUP_READ | File::GROUP_WRITE | File::SHAREABLE, (initiator == true ? size : 0), false)
+                    , _initiator(initiator)
+                {
+                }
+                ~Buffer() override
+                {
+                    // Who created the ring, cleans it up.
+                    if (_initiator == true) {
+                        CyclicBuffer::Unlink();
+                    }
+                }
+
+            private:
+                uint32_t GetOverwriteSize(Cursor& cursor) override
+                {
+                    while (cursor.Offset() < cursor.Size()) {
+                        uint32_t entrySize = 0;
+                        cursor.Peek(entrySize);
+                        cursor.Forward(entrySize);
+                    }
+
+                    return (cursor.Offset());
+                }
+                uint32_t GetReadSize(Cursor& cursor) override
+                {
+                    // Just read one entry.
+                    uint32_t entrySize = 0;
+                    cursor.Peek(entrySize);
+                    cursor.Forward(sizeof(entrySize));
+
+                    return (entrySize > sizeof(entrySize) ? entrySize - sizeof(entrySize) : 0);
+                }
+
+            private:
+                const bool _initiator;
+            };
+            class Reaper : public Core::IDispatch {
+            public:
+                Reaper() = delete;
+                Reaper(const Reaper&) = delete;
+                Reaper& operator=(const Reaper&) = delete;
+
+                Reaper(SharedPath* path)
+                    : _path(path)
+                {
+                }
+                ~Reaper() override = default;
+
+            public:
+                void Dispatch() override
+                {
+                    delete _path;
+                }
+
+            private:
+                SharedPath* _path;
+            };
+
+        public:
+            // Every entry in the ring: [length][label][sequence][message length][offset][part of the message]
+            static constexpr uint32_t EntryHeaderSize = (5 * sizeof(uint32_t));
+            // How long a writer waits for the reader on the other side to make room in the ring.
+            static constexpr uint32_t RoomWaitTime = 1000;
+
+            SharedPath() = delete;
+            SharedPath(const SharedPath&) = delete;
+            SharedPath& operator=(const SharedPath&) = delete;
+
+            SharedPath(IPCChannel& parent, const string& name, const bool initiator, const uint32_t size)
+                : Thread(Thread::DefaultStackSize(), _T("IPCSharedPath"))
+                , _parent(parent)
+                , _outbound(name + (initiator == true ? _T(".0") : _T(".1")), initiator, size)
+                , _inbound(name + (initiator == true ? _T(".1") : _T(".0")), initiator, size)
+                , _writer(false)
+                , _aborted(false)
+                , _frame()
+                , _message()
+            {
+                if ((_outbound.IsValid() == true) && (_inbound.IsValid() == true)) {
+                    _frame.resize(_inbound.Size());
+                    Thread::Run();
+                }
+            }
+            ~SharedPath() override
+            {
+                ASSERT(Thread::ThreadId() != Thread::Id());
+
+                Thread::Stop();
+                _inbound.Alert();
+                Thread::Wait(Thread::BLOCKED | Thread::STOPPED, Core::infinite);
+            }
+
+        public:
+            bool IsValid() const
+            {
+                return (_frame.empty() == false);
+            }
+            bool IsReader() const
+            {
+                return (Thread::ThreadId() == Thread::Id());
+            }
+            // The reader can not wait for itself to end, it stops reading right away and someone
+            // else cleans up.
+            void Retire()
+            {
+                ASSERT(IsReader() == true);
+
+                Thread::Stop();
+
+                ASSERT(Core::IWorkerPool::IsAvailable() == true);
+
+                if (Core::IWorkerPool::IsAvailable() == true) {
+                    Core::IWorkerPool::Instance().Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<Reaper>::Create(this)));
+                }
+            }
+            // Wakes up the writers waiting for the ring, they give up from now on.
+            void Abort()
+            {
+                _aborted = true;
+                _outbound.Alert();
+            }
+            // A message that does not fit in the ring goes in parts, the reader puts them together
+            // again. Returns ERROR_UNAVAILABLE if the ring is not free for the reader thread, the
+            // message should go over the socket then.
+            uint32_t Submit(const IMessage& message)
+            {
+                const uint32_t length = message.Length();
+                const uint32_t part = (_outbound.Size() / 2) - EntryHeaderSize;
+                const bool reader = IsReader();
+                uint32_t result = _writer.Lock(reader == true ? 0 : RoomWaitTime);
+
+                if (result != Core::ERROR_NONE) {
+                    result = (reader == true ? Core::ERROR_UNAVAILABLE : Core::ERROR_TIMEDOUT);
+                } else {
+                    if (_aborted == true) {
+                        result = Core::ERROR_ASYNC_ABORTED;
+                    } else if ((reader == true) && (((length / part) + 1) * EntryHeaderSize + length >= _outbound.Free())) {
+                        result = Core::ERROR_UNAVAILABLE;
+                    } else {
+                        result = Write(message, length, part);
+                    }
+
+                    _writer.Unlock();
+                }
+
+                return (result);
+            }
+
+        private:
+            uint32_t Write(const IMessage& message, const uint32_t length, const uint32_t part)
+            {
+                uint32_t result = Core::ERROR_NONE;
+                uint32_t offset = 0;
+
+                do {
+                    const uint32_t chunk = std::min(length - offset, part);
+                    const uint32_t entrySize = EntryHeaderSize + chunk;
+
+                    // The ring does not overwrite, the reader on the other side makes room as it goes.
+                    if (entrySize >= _outbound.Free()) {
+                        result = _outbound.WaitForRoom(entrySize, RoomWaitTime);
+                    }
+
+                    if (result == Core::ERROR_NONE) {
+                        // A message cut short is dropped by the reader, once the next one starts at offset 0.
+                        const uint32_t header[5] = { entrySize, message.Label(), message.Sequence(), length, offset };
+                        uint8_t buffer[512];
+                        const uint32_t end = offset + chunk;
+
+                        _outbound.Reserve(entrySize);
+                        _outbound.Write(reinterpret_cast<const uint8_t*>(header), sizeof(header));
+
+                        while (offset < end) {
+                            const uint32_t loaded = message.Serialize(buffer, std::min(static_cast<uint32_t>(sizeof(buffer)), end - offset), offset);
+
+                            ASSERT(loaded != 0);
+
+                            _outbound.Write(buffer, loaded);
+                            offset += loaded;
+                        }
+                    }
+                } while ((result == Core::ERROR_NONE) && (offset < length));
+
+                return (result);
+            }
+            uint32_t Worker() override
+            {
+                // The writer only makes the wake up call if we are actually waiting, so there is
+                // no need to keep polling the ring after it was drained.
+                if (_inbound.Wait(Core::infinite) == Core::ERROR_NONE) {
+                    Drain();
+                }
+
+                return (0);
+            }
+            // Handle all that is in the ring.
+            void Drain()
+            {
+                uint32_t length;
+
+                while ((Thread::IsRunning() == true) && ((length = _inbound.Read(_frame.data(), static_cast<uint32_t>(_frame.size()))) != 0)) {
+                    uint32_t header[4];
+
+                    ASSERT(length >= sizeof(header));
+
+                    ::memcpy(header, _frame.data(), sizeof(header));
+
+                    const uint8_t* part = &(_frame[sizeof(header)]);
+                    const uint32_t partLength = length - sizeof(header);
+
+                    if (header[3] == 0) {
+                        // Whatever was still being put together, the writer gave up on.
+                        _message.clear();
+                    }
+
+                    if (header[3] != _message.size()) {
+                        // Part of a message of which the start was dropped.
+                    } else if ((_message.empty() == true) && (partLength == header[2])) {
+                        _parent.Received(header[0], header[1], part, partLength);
+                    } else {
+                        _message.insert(_message.end(), part, part + partLength);
+
+                        if (_message.size() >= header[2]) {
+                            ASSERT(_message.size() == header[2]);
+
+                            _parent.Received(header[0], header[1], _message.data(), static_cast<uint32_t>(_message.size()));
+                            _message.clear();
+                        }
+                    }
+                }
+            }
+
+        private:
+            IPCChannel& _parent;
+            Buffer _outbound;
+            Buffer _inbound;
+            BinarySemaphore _writer;
+            std::atomic<bool> _aborted;
+            std::vector<uint8_t> _frame;
+            std::vector<uint8_t> _message;
+        };
+
     protected:
         IPCChannel()
             : _administration()
             , _customData(nullptr)
+            , _sharedLock()
+            , _shared(nullptr)
+            , _established(false)
+            , _writers(0)
         {
         }
 
@@ -705,9 +1209,17 @@ POP_WARNING()
         IPCChannel(Core::ProxyType<FactoryType<IIPC, uint32_t>>& factory)
             : _administration(factory)
             , _customData(nullptr)
+            , _sharedLock()
+            , _shared(nullptr)
+            , _established(false)
+            , _writers(0)
         {
         }
-        virtual ~IPCChannel() = default;
+        virtual ~IPCChannel()
+        {
+            // The implementation should have detached before its parts are gone.
+            ASSERT(_shared == nullptr);
+        }
 
     public:
         void Register(const uint32_t id, const ProxyType<IIPCServer>& handler)
@@ -748,19 +1260,171 @@ POP_WARNING()
             _customData = data;
         }
 
+        // Exchange the messages through a pair of shared memory rings next to the socket. The
+        // initiator creates the rings, but only starts sending through them once the other side
+        // attached as well, which must be reported through Established().
+        uint32_t Attach(const string& name, const bool initiator, const uint32_t size = SharedRingSize)
+        {
+            uint32_t result = Core::ERROR_ALREADY_CONNECTED;
+
+            _sharedLock.Lock();
+
+            if (_shared == nullptr) {
+                SharedPath* path = new SharedPath(*this, name, initiator, size);
+
+                if (path->IsValid() == false) {
+                    delete path;
+                    result = Core::ERROR_OPENING_FAILED;
+                } else {
+                    _shared = path;
+                    _established = (initiator == false);
+                    result = Core::ERROR_NONE;
+                }
+            }
+
+            _sharedLock.Unlock();
+
+            return (result);
+        }
+        void Established()
+        {
+            _sharedLock.Lock();
+
+            ASSERT(_shared != nullptr);
+
+            _established = (_shared != nullptr);
+
+            _sharedLock.Unlock();
+        }
+        void Detach()
+        {
+            _sharedLock.Lock();
+
+            SharedPath* path = _shared;
+            _shared = nullptr;
+            _established = false;
+
+            if (path != nullptr) {
+                path->Abort();
+
+                // Writers do not hold the lock while they wait for the ring, let them bail out first.
+                while (_writers != 0) {
+                    _sharedLock.Unlock();
+                    SleepMs(1);
+                    _sharedLock.Lock();
+                }
+            }
+
+            _sharedLock.Unlock();
+
+            if (path != nullptr) {
+                if (path->IsReader() == false) {
+                    delete path;
+                } else {
+                    // Detached from within a message that came in through the rings.
+                    path->Retire();
+                }
+            }
+        }
+        bool IsShared() const
+        {
+            _sharedLock.Lock();
+
+            bool result = _established;
+
+            _sharedLock.Unlock();
+
+            return (result);
+        }
+
         virtual uint32_t Id() const = 0;
         virtual string Origin() const = 0;
         virtual uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound) = 0;
 
+    protected:
+        // Returns ERROR_UNAVAILABLE if the message has to go over the socket.
+        uint32_t SubmitShared(const IMessage& message)
+        {
+            uint32_t result = Core::ERROR_UNAVAILABLE;
+            SharedPath* path = nullptr;
+
+            _sharedLock.Lock();
+
+            if (_established == true) {
+                path = _shared;
+                _writers++;
+            }
+
+            _sharedLock.Unlock();
+
+            if (path != nullptr) {
+                // Waiting for room in the ring, should not hold up the other writers nor a Detach.
+                result = path->Submit(message);
+
+                _sharedLock.Lock();
+                _writers--;
+                _sharedLock.Unlock();
+            }
+
+            return (result);
+        }
+
     private:
         virtual uint32_t Execute(const ProxyType<IIPC>& command, IDispatchType<IIPC>* completed) = 0;
         virtual uint32_t Execute(const ProxyType<IIPC>& command, const uint32_t waitTime) = 0;
 
+        // A complete message came in through the shared memory path.
+        void Received(const uint32_t label, const uint32_t sequence, const uint8_t data[], const uint32_t length)
+        {
+            if ((label & 0x01) != 0) {
+                ProxyType<IMessage> response(_administration.Response(label, sequence));
+
+                if (response.IsValid() == true) {
+                    Load(*response, data, length);
+                    _administration.Completed(response);
+                }
+            } else {
+                ProxyType<IIPC> inbound(_administration.Inbound(label, sequence));
+
+                if (inbound.IsValid() == true) {
+                    ProxyType<IMessage> parameters(inbound->IParameters());
+
+                    Load(*parameters, data, length);
+
+                    ProxyType<IIPCServer> handler(_administration.Handler(inbound->Label()));
+
+                    if (handler.IsValid() == true) {
+                        handler->Procedure(*this, inbound);
+                    }
+                }
+            }
+        }
+        static void Load(IMessage& message, const uint8_t data[], const uint32_t length)
+        {
+            uint32_t offset = 0;
+
+            while (offset < length) {
+                const uint32_t handled = message.Deserialize(&(data[offset]), length - offset, offset);
+
+                ASSERT(handled != 0);
+
+                if (handled == 0) {
+                    break;
+                }
+
+                offset += handled;
+            }
+        }
+
     protected:
         IPCFactory _administration;
 
     private:
         const void* _customData;
+        mutable CriticalSection _sharedLock;
+        SharedPath* _shared;
+        bool _established;
+        uint32_t _writers;
     };
 
     template <typename ACTUALSOURCE, typename EXTENSION>
@@ -785,12 +1449,12 @@ POP_WARNING()
             ~IPCLink() override = default;
 
         public:
-            bool SendResponse(Core::ProxyType<IIPC>& inbound)
+            uint32_t SendResponse(Core::ProxyType<IIPC>& inbound)
             {
                 ASSERT(inbound.IsValid() == true);
 
                 // This is an inbound call, Report what we have processed !!!
-                return (BaseClass::Submit(inbound->IResponse()));
+                return (_parent.Submit(inbound->IResponse()));
             }
 
             // Notification of a INBOUND element received.
@@ -816,6 +1480,7 @@ POP_WARNING()
             {
                 if (_parent.Source().IsOpen() == false) {
                     // Whatever s hapening, Flush what we were doing..
+                    _parent.Detach();
                     _factory.Abort();
                 }
 
@@ -840,16 +1505,16 @@ POP_WARNING()
             ~IPCTrigger() override = default;
 
         public:
-            uint32_t Wait(const uint32_t waitTime)
+            uint32_t Wait(const uint32_t sequence, const uint32_t waitTime)
             {
                 uint32_t result = Core::ERROR_NONE;
 
                 // Now we wait for ever, to get a signal that we are done :-)
                 if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.Flush();
+                    _administration.Revoke(sequence);
 
                     result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.Flush() == true) {
+                } else if (_administration.Revoke(sequence) == true) {
                     result = Core::ERROR_ASYNC_FAILED;
                 }
 
@@ -886,7 +1551,10 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         }
 POP_WARNING()
 
-        ~IPCChannelType() override = default;
+        ~IPCChannelType() override
+        {
+            IPCChannel::Detach();
+        }
 
     public:
         EXTENSION& Extension()
@@ -919,9 +1587,13 @@ POP_WARNING()
         uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound) override
         {
             // We got the event, start the invoke, wait for the event to be set again..
-            _link.SendResponse(inbound);
+            const uint32_t result = _link.SendResponse(inbound);
 
-            return (Core::ERROR_NONE);
+            if (result != Core::ERROR_NONE) {
+                TRACE_L1("Could not send the response for label %d, error: %d", inbound->Label(), result);
+            }
+
+            return (result);
         }
         virtual void StateChange()
         {
@@ -984,20 +1656,25 @@ POP_WARNING()
 
             _serialize.Lock();
 
+#ifndef __CORE_IPC_PIPELINING__
             if (_administration.InProgress() == true) {
                 success = Core::ERROR_INPROGRESS;
             }
-            else {
+            else
+#endif
+            {
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
-                _administration.SetOutbound(command, completed);
+                const uint32_t sequence = _administration.SetOutbound(command, completed);
 
                 if (_link.IsOpen() == true) {
-                    _link.Submit(command->IParameters());
+                    success = Submit(command->IParameters());
 
-                    success = Core::ERROR_NONE;
+                    if (success != Core::ERROR_NONE) {
+                        _administration.Revoke(sequence);
+                    }
                 } else {
-                    _administration.Flush();
+                    _administration.Revoke(sequence);
 
                     success = Core::ERROR_CONNECTION_CLOSED;
                 }
@@ -1011,26 +1688,35 @@ POP_WARNING()
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
 
+#ifndef __CORE_IPC_PIPELINING__
+            // Without sequence numbers on the wire, only one call can be outstanding.
             _serialize.Lock();
+#endif
 
             IPCTrigger sink(_administration);
 
             // We need to accept a CONST object to avoid an additional object creation
             // proxy casted objects.
-            _administration.SetOutbound(command, &sink);
+            const uint32_t sequence = _administration.SetOutbound(command, &sink);
 
             if (_link.IsOpen() == true) {
-                _link.Submit(command->IParameters());
+                success = Submit(command->IParameters());
 
-                success = sink.Wait(waitTime);
+                if (success == Core::ERROR_NONE) {
+                    success = sink.Wait(sequence, waitTime);
+                } else {
+                    _administration.Revoke(sequence);
+                }
             }
             else {
-                _administration.Flush();
+                _administration.Revoke(sequence);
 
                 success = Core::ERROR_CONNECTION_CLOSED;
             }
 
+#ifndef __CORE_IPC_PIPELINING__
             _serialize.Unlock();
+#endif
 
             return (success);
         }
@@ -1038,6 +1724,16 @@ POP_WARNING()
         {
             procedure->Procedure(*this, message);
         }
+        uint32_t Submit(const ProxyType<IMessage>& message)
+        {
+            uint32_t result = IPCChannel::SubmitShared(*message);
+
+            if (result == Core::ERROR_UNAVAILABLE) {
+                result = (_link.Submit(message) == true ? Core::ERROR_NONE : Core::ERROR_WRITE_ERROR);
+            }
+
+            return (result);
+        }
 
     private:
         CriticalSection _serialize;
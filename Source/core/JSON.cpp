@@ -18,9 +18,17 @@
  */
 
 #include "JSON.h"
+#include "Sync.h"
+#include <atomic>
 #include <iomanip>
 #include <sstream>
 
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Thunder {
 namespace Core {
     namespace JSON {
@@ -37,10 +45,268 @@ namespace Core {
         }
 
 
+        namespace {
+
+            typedef uint32_t (*Scanner)(const char text[], const uint32_t length);
+
+            // ESCAPE selects the characters a quoted string needs to escape on serialization,
+            // otherwise the characters that end a literal run on deserialization.
+            template <const bool ESCAPE>
+            inline bool IsSpecial(const uint8_t current)
+            {
+                return ((current <= 0x1F) || (current == '\"') || (current == '\\') || ((ESCAPE == true) && ((current >= 0x7F)
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                    || (current == '/')
+#endif
+                )));
+            }
+
+            template <const bool ESCAPE>
+            uint32_t ScanScalar(const char text[], const uint32_t length)
+            {
+                uint32_t index = 0;
+
+                while ((index < length) && (IsSpecial<ESCAPE>(static_cast<uint8_t>(text[index])) == false)) {
+                    index++;
+                }
+
+                return (index);
+            }
+
+#if defined(__SSE2__)
+            template <const bool ESCAPE>
+            uint32_t ScanSSE2(const char text[], const uint32_t length)
+            {
+                const __m128i quote = _mm_set1_epi8('\"');
+                const __m128i backslash = _mm_set1_epi8('\\');
+                const __m128i control = _mm_set1_epi8(0x1F);
+                const __m128i high = _mm_set1_epi8(0x7F);
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                const __m128i solidus = _mm_set1_epi8('/');
+#endif
+
+                uint32_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(text[index])));
+
+                    __m128i special = _mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, backslash));
+                    special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_max_epu8(block, control), control));
+
+                    if (ESCAPE == true) {
+                        special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_max_epu8(block, high), block));
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                        special = _mm_or_si128(special, _mm_cmpeq_epi8(block, solidus));
+#endif
+                    }
+
+                    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+
+                    if (mask != 0) {
+                        return (index + __builtin_ctz(mask));
+                    }
+
+                    index += 16;
+                }
+
+                return (index + ScanScalar<ESCAPE>(&(text[index]), length - index));
+            }
+
+            template <const bool ESCAPE>
+            __attribute__((target("avx2"))) uint32_t ScanAVX2(const char text[], const uint32_t length)
+            {
+                const __m256i quote = _mm256_set1_epi8('\"');
+                const __m256i backslash = _mm256_set1_epi8('\\');
+                const __m256i control = _mm256_set1_epi8(0x1F);
+                const __m256i high = _mm256_set1_epi8(0x7F);
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                const __m256i solidus = _mm256_set1_epi8('/');
+#endif
+
+                uint32_t index = 0;
+
+                while ((index + 32) <= length) {
+                    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&(text[index])));
+
+                    __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, backslash));
+                    special = _mm256_or_si256(special, _mm256_cmpeq_epi8(_mm256_max_epu8(block, control), control));
+
+                    if (ESCAPE == true) {
+                        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(_mm256_max_epu8(block, high), block));
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(block, solidus));
+#endif
+                    }
+
+                    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+
+                    if (mask != 0) {
+                        return (index + __builtin_ctz(mask));
+                    }
+
+                    index += 32;
+                }
+
+                // The tail is shorter than 32 bytes, let SSE2 take a 16 byte step if it can.
+                return (index + ScanSSE2<ESCAPE>(&(text[index]), length - index));
+            }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+            template <const bool ESCAPE>
+            uint32_t ScanNEON(const char text[], const uint32_t length)
+            {
+                const uint8x16_t quote = vdupq_n_u8('\"');
+                const uint8x16_t backslash = vdupq_n_u8('\\');
+                const uint8x16_t control = vdupq_n_u8(0x1F);
+                const uint8x16_t high = vdupq_n_u8(0x7F);
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                const uint8x16_t solidus = vdupq_n_u8('/');
+#endif
+
+                uint32_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(&(text[index])));
+
+                    uint8x16_t special = vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, backslash));
+                    special = vorrq_u8(special, vcleq_u8(block, control));
+
+                    if (ESCAPE == true) {
+                        special = vorrq_u8(special, vcgeq_u8(block, high));
+#ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
+                        special = vorrq_u8(special, vceqq_u8(block, solidus));
+#endif
+                    }
+
+                    if (vmaxvq_u8(special) != 0) {
+                        // The scalar loop pinpoints it within this block.
+                        break;
+                    }
+
+                    index += 16;
+                }
+
+                return (index + ScanScalar<ESCAPE>(&(text[index]), length - index));
+            }
+#endif
+
+            template <const bool ESCAPE>
+            Scanner SelectScanner()
+            {
+#if defined(__SSE2__)
+                __builtin_cpu_init();
+
+                return (__builtin_cpu_supports("avx2") ? ScanAVX2<ESCAPE> : ScanSSE2<ESCAPE>);
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+                return (ScanNEON<ESCAPE>);
+#else
+                return (ScanScalar<ESCAPE>);
+#endif
+            }
+        }
+
+        /* static */ uint32_t String::UnescapedLength(const char text[], const uint32_t length)
+        {
+            static const Scanner scanner = SelectScanner<true>();
+
+            return (scanner(text, length));
+        }
+
+        /* static */ uint32_t String::LiteralLength(const char stream[], const uint32_t length)
+        {
+            static const Scanner scanner = SelectScanner<false>();
+
+            return (scanner(stream, length));
+        }
+
         /* static */ char IElement::NullTag[5] = { 'n', 'u', 'l', 'l', '\0' };
         /* static */ char IElement::TrueTag[5] = { 't', 'r', 'u', 'e', '\0' };
         /* static */ char IElement::FalseTag[6] = { 'f', 'a', 'l', 's', 'e', '\0' };
 
+        void Container::Bind()
+        {
+            const FieldIndex* index = Index(typeid(*this), _data);
+            bool matches = ((index != nullptr) && (index->size() == _data.size()));
+
+            if (matches == true) {
+                FieldIndex::const_iterator entry = index->begin();
+
+                while ((matches == true) && (entry != index->end())) {
+                    matches = (strcmp(entry->first.c_str(), _data[entry->second].first) == 0);
+                    entry++;
+                }
+            }
+
+            if (matches == true) {
+                _index = index;
+                _indexing = indexing::BOUND;
+            }
+            else {
+                _indexing = indexing::LINEAR;
+            }
+        }
+
+        /* static */ const Container::FieldIndex* Container::Index(const std::type_info& type, const JSONElementList& fields)
+        {
+            struct Entry {
+                size_t Type;
+                FieldIndex Fields;
+            };
+
+            // Keyed on the hash, the type_info itself may live in a library that gets
+            // unloaded. Types sharing a hash share the index of the first one seen, the
+            // others do not match it during Bind() and use a linear search.
+            // Every container binds on its first lookup, so this is an open addressed
+            // table of atomic pointers: looking up a type takes no lock. An entry, once
+            // published, is never changed or removed, it lives as long as the process,
+            // which bounds the table to one entry per Container type ever bound. It does
+            // not grow: once all slots are taken, nullptr is returned for any new type,
+            // and Bind() leaves those containers on the linear search.
+            static constexpr uint32_t Slots = 1024;
+            static std::atomic<const Entry*> table[Slots];
+
+            const size_t hash = type.hash_code();
+            const FieldIndex* result = nullptr;
+            Entry* created = nullptr;
+            uint32_t probe = 0;
+
+            while ((result == nullptr) && (probe < Slots)) {
+                std::atomic<const Entry*>& slot(table[(hash + probe) % Slots]);
+                const Entry* entry = slot.load(std::memory_order_acquire);
+
+                if ((entry == nullptr) && (created == nullptr)) {
+                    created = new Entry { hash, FieldIndex() };
+
+                    if (fields.size() <= 0xFFFF) {
+                        created->Fields.reserve(fields.size());
+
+                        for (uint16_t position = 0; position < fields.size(); position++) {
+                            created->Fields.emplace_back(string(fields[position].first), position);
+                        }
+
+                        // Stable, so on duplicate labels the first one added is found, like the linear search does.
+                        std::stable_sort(created->Fields.begin(), created->Fields.end(),
+                            [](const FieldIndex::value_type& lhs, const FieldIndex::value_type& rhs) { return (lhs.first < rhs.first); });
+                    }
+                }
+
+                if ((entry == nullptr) && (slot.compare_exchange_strong(entry, created, std::memory_order_acq_rel) == true)) {
+                    result = &(created->Fields);
+                    created = nullptr;
+                }
+                else if (entry->Type == hash) {
+                    // Found it, or another thread was just ahead of us with the same type.
+                    result = &(entry->Fields);
+                }
+                else {
+                    probe++;
+                }
+            }
+
+            delete created;
+
+            return (result);
+        }
+
 #ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
 
         string Variant::GetDebugString(const TCHAR name[], int indent, int arrayIndex) const
@@ -20,7 +20,9 @@
 #ifndef __JSON_H
 #define __JSON_H
 
+#include <algorithm>
 #include <map>
+#include <typeinfo>
 #include <vector>
 
 #include "Enumerate.h"
@@ -90,25 +92,37 @@ namespace Core {
 
             virtual ~IElement() = default;
 
+            // Initial room handed to Serialize when writing into a string or buffer. The
+            // room doubles on every pass, so big objects take a few large passes.
+            static constexpr uint32_t SerializeChunkSize = 1024;
+
             template <typename INSTANCEOBJECT>
             static bool ToString(const INSTANCEOBJECT& realObject, string& text)
             {
-                char buffer[1024];
-                uint16_t loaded;
+                uint32_t room = SerializeChunkSize;
+                uint32_t filled = 0;
+                uint32_t loaded;
                 uint32_t offset = 0;
 
                 text.clear();
 
-                // Serialize object
+                // Serialize object, straight into the string
                 do {
-                    loaded = static_cast<const IElement&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    text.resize(filled + room);
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    loaded = static_cast<const IElement&>(realObject).Serialize(&(text[filled]), room, offset);
 
-                    text += string(buffer, loaded);
+                    ASSERT(loaded <= room);
 
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                    filled += loaded;
+
+                    if (room < (static_cast<uint32_t>(~0) >> 1)) {
+                        room <<= 1;
+                    }
+
+                } while ((offset != 0) && (loaded != 0));
+
+                text.resize(filled);
 
                 return (offset == 0);
             }
@@ -131,10 +145,11 @@ namespace Core {
 
                 while ( (handled < size) && (error.IsSet() == false) ) {
 
-                    uint16_t payload = static_cast<uint16_t>(std::min((size - handled) + 1, static_cast<uint32_t>(0xFFFF)));
+                    // Include the terminating '\0', it tells the parser that the text ends here.
+                    uint32_t payload = (size - handled) + 1;
 
                     // Deserialize object
-                    uint16_t loaded = static_cast<IElement&>(realObject).Deserialize(&(text.c_str()[handled]), payload, offset, error);
+                    uint32_t loaded = static_cast<IElement&>(realObject).Deserialize(&(text.c_str()[handled]), payload, offset, error);
 
                     ASSERT(loaded <= payload);
                     DEBUG_VARIABLE(loaded);
@@ -182,12 +197,12 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     char buffer[1024];
-                    uint16_t loaded;
+                    uint32_t loaded;
                     uint32_t offset = 0;
 
                     // Serialize object
                     do {
-                        loaded = static_cast<const IElement&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                        loaded = static_cast<const IElement&>(realObject).Serialize(buffer, static_cast<uint32_t>(sizeof(buffer)), offset);
 
                         ASSERT(loaded <= sizeof(buffer));
 
@@ -225,7 +240,7 @@ namespace Core {
                         if (readBytes == 0) {
                             loaded = ~0;
                         } else {
-                            loaded = static_cast<IElement&>(realObject).Deserialize(buffer, sizeof(buffer), offset, error);
+                            loaded = static_cast<IElement&>(realObject).Deserialize(buffer, static_cast<uint32_t>(sizeof(buffer)), offset, error);
 
                             ASSERT(loaded <= readBytes);
 
@@ -270,11 +285,66 @@ namespace Core {
             virtual void Clear() = 0;
             virtual bool IsSet() const = 0;
             virtual bool IsNull() const = 0;
-            virtual uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const = 0;
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset)
+
+            // Implement the Serialize/Deserialize taking 32 bits lengths. The ones taking 16 bits lengths are
+            // deprecated, if those are the ones implemented, they are fed in windows of at most 64KB.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+            virtual uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const
+            {
+                const void* outer = Windowing();
+                uint32_t result = 0;
+                uint16_t window;
+                uint16_t loaded;
+
+                Windowing() = this;
+
+                do {
+                    window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                    loaded = Serialize(&(stream[result]), window, offset);
+                    result += loaded;
+                } while ((loaded == window) && (result < maxLength) && (offset != 0));
+
+                Windowing() = outer;
+
+                return (result);
+            }
+            virtual uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
+            {
+                const void* outer = Windowing();
+                uint32_t result = 0;
+                uint16_t window;
+                uint16_t loaded;
+
+                Windowing() = this;
+
+                do {
+                    window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                    loaded = Deserialize(&(stream[result]), window, offset, error);
+                    result += loaded;
+                } while ((loaded == window) && (result < maxLength) && (offset != 0) && (error.IsSet() == false));
+
+                Windowing() = outer;
+
+                return (result);
+            }
+            DEPRECATED virtual uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const
+            {
+                // Fed by the 32 bits variant of this very element, then neither of the two is implemented.
+                ASSERT(Windowing() != this);
+
+                return (Windowing() == this ? 0 : static_cast<uint16_t>(Serialize(stream, static_cast<uint32_t>(maxLength), offset)));
+            }
+            DEPRECATED virtual uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
+            {
+                ASSERT(Windowing() != this);
+
+                return (Windowing() == this ? 0 : static_cast<uint16_t>(Deserialize(stream, static_cast<uint32_t>(maxLength), offset, error)));
+            }
+POP_WARNING()
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset)
             {
                 Core::OptionalType<Error> error;
-                uint16_t loaded = Deserialize(stream, maxLength, offset, error);
+                uint32_t loaded = Deserialize(stream, maxLength, offset, error);
 
                 if (error.IsSet() == true) {
                     Clear();
@@ -284,7 +354,15 @@ namespace Core {
 
                 return loaded;
             }
-            virtual uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) = 0;
+
+        private:
+            // The element the 32 bits variant is feeding in windows, on this thread. If the 16 bits
+            // variant is reached for that same element, the cycle between the two must be broken.
+            static const void*& Windowing()
+            {
+                static thread_local const void* element = nullptr;
+                return (element);
+            }
         };
 
         struct EXTERNAL IMessagePack {
@@ -295,21 +373,28 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool ToBuffer(std::vector<uint8_t>& stream, const INSTANCEOBJECT& realObject)
             {
-                uint8_t buffer[1024];
-                uint16_t loaded;
+                uint32_t room = IElement::SerializeChunkSize;
+                uint32_t filled = 0;
+                uint32_t loaded;
                 uint32_t offset = 0;
 
                 stream.clear();
-                // Serialize object
+                // Serialize object, straight into the buffer
                 do {
-                    loaded = static_cast<const IMessagePack&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    stream.resize(filled + room);
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    loaded = static_cast<const IMessagePack&>(realObject).Serialize(&(stream[filled]), room, offset);
+
+                    ASSERT(loaded <= room);
+
+                    filled += loaded;
+
+                    if (room < (static_cast<uint32_t>(~0) >> 1)) {
+                        room <<= 1;
+                    }
+                } while ((offset != 0) && (loaded != 0));
 
-                    stream.reserve(stream.size() + loaded);
-                    stream.insert(stream.end(), buffer, buffer + loaded);
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                stream.resize(filled);
 
                 return (offset == 0);
             }
@@ -323,13 +408,14 @@ namespace Core {
                 realObject.Clear();
 
                 while (size != handled) {
-                        uint16_t partial = static_cast<uint16_t>(std::min(size - handled, static_cast<uint32_t>(0xFFFF)));
-
                         // Deserialize object
-                        uint16_t loaded = static_cast<IMessagePack&>(realObject).Deserialize(&(stream[handled]), partial, offset);
+                        uint32_t loaded = static_cast<IMessagePack&>(realObject).Deserialize(&(stream[handled]), size - handled, offset);
+
+                        ASSERT(loaded <= (size - handled));
 
-                        ASSERT(loaded <= partial);
-                        DEBUG_VARIABLE(loaded);
+                        if (loaded == 0) {
+                            break;
+                        }
                         handled += loaded;
                 }
 
@@ -348,12 +434,12 @@ namespace Core {
                 if (fileObject.IsOpen()) {
 
                     uint8_t buffer[1024];
-                    uint16_t loaded;
+                    uint32_t loaded;
                     uint32_t offset = 0;
 
                     // Serialize object
                     do {
-                        loaded = static_cast<const IMessagePack&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                        loaded = static_cast<const IMessagePack&>(realObject).Serialize(buffer, static_cast<uint32_t>(sizeof(buffer)), offset);
 
                         ASSERT(loaded <= sizeof(buffer));
 
@@ -387,7 +473,7 @@ namespace Core {
                         if (readBytes == 0) {
                             loaded = ~0;
                         } else {
-                            loaded = static_cast<IMessagePack&>(realObject).Deserialize(buffer, sizeof(buffer), offset);
+                            loaded = static_cast<IMessagePack&>(realObject).Deserialize(buffer, static_cast<uint32_t>(sizeof(buffer)), offset);
 
                             ASSERT(loaded <= readBytes);
 
@@ -432,8 +518,68 @@ namespace Core {
             virtual void Clear() = 0;
             virtual bool IsSet() const = 0;
             virtual bool IsNull() const = 0;
-            virtual uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const = 0;
-            virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) = 0;
+
+            // Like on the IElement, the variants taking a 16 bits length are deprecated.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+            virtual uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const
+            {
+                const void* outer = Windowing();
+                uint32_t result = 0;
+                uint16_t window;
+                uint16_t loaded;
+
+                Windowing() = this;
+
+                do {
+                    window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                    loaded = Serialize(&(stream[result]), window, offset);
+                    result += loaded;
+                } while ((loaded == window) && (result < maxLength) && (offset != 0));
+
+                Windowing() = outer;
+
+                return (result);
+            }
+            virtual uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset)
+            {
+                const void* outer = Windowing();
+                uint32_t result = 0;
+                uint16_t window;
+                uint16_t loaded;
+
+                Windowing() = this;
+
+                do {
+                    window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                    loaded = Deserialize(&(stream[result]), window, offset);
+                    result += loaded;
+                } while ((loaded == window) && (result < maxLength) && (offset != 0));
+
+                Windowing() = outer;
+
+                return (result);
+            }
+            DEPRECATED virtual uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const
+            {
+                ASSERT(Windowing() != this);
+
+                return (Windowing() == this ? 0 : static_cast<uint16_t>(Serialize(stream, static_cast<uint32_t>(maxLength), offset)));
+            }
+            DEPRECATED virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset)
+            {
+                ASSERT(Windowing() != this);
+
+                return (Windowing() == this ? 0 : static_cast<uint16_t>(Deserialize(stream, static_cast<uint32_t>(maxLength), offset)));
+            }
+POP_WARNING()
+
+        private:
+            // See IElement::Windowing().
+            static const void*& Windowing()
+            {
+                static thread_local const void* element = nullptr;
+                return (element);
+            }
         };
 
         enum class ValueValidity : int8_t {
@@ -443,7 +589,7 @@ namespace Core {
             VALID
         };
 
-        static ValueValidity IsNullValue(const char stream[], const uint16_t maxLength, uint32_t& offset, uint16_t& loaded)
+        static ValueValidity IsNullValue(const char stream[], const uint32_t maxLength, uint32_t& offset, uint32_t& loaded)
         {
             ValueValidity validity = ValueValidity::INVALID;
             const size_t nullTagLen = strlen(IElement::NullTag);
@@ -586,9 +732,9 @@ namespace Core {
 
             // IElement iface:
             // If this should be serialized/deserialized, it is indicated by a MinSize > 0)
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -649,9 +795,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 // Peamble investigation, determine the right flags..
                 while ((offset < 4) && (loaded < maxLength)) {
@@ -813,7 +959,7 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if ((_set & UNDEFINED) != 0) {
                     stream[0] = IMessagePack::NullValue;
@@ -822,7 +968,7 @@ namespace Core {
                 return (Convert(stream, maxLength, offset, TemplateIntToType<SIGNED>()));
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
                 uint8_t loaded = 0;
                 if (offset == 0) {
@@ -861,10 +1007,10 @@ namespace Core {
             }
 
         private:
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint32_t& offset, const TYPE serialize) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TYPE serialize) const
             {
                 uint8_t parsed = 4;
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 TYPE divider = 1;
                 TYPE value = (serialize / BASETYPE);
 
@@ -896,17 +1042,17 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, _value));
             }
 
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 return (Convert(stream, maxLength, offset, ::abs(_value)));
             }
 
-            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
+            uint32_t Convert(uint8_t stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
                 uint8_t bytes = (_value <= 0x7F ? 0 : _value < 0xFF ? 1 : _value < 0xFFFF ? 2 : _value < 0xFFFFFFFF ? 4 : 8);
@@ -949,7 +1095,7 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            uint32_t Convert(uint8_t stream[], const uint32_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
             {
                 uint8_t loaded = 0;
                 uint8_t bytes = (((_value < 16) && (_value > -15)) ? 0 : ((_value < 128) && (_value > -127)) ? 1 : ((_value < 32767) && (_value > -32766)) ? 2 : ((_value < 2147483647) && (_value > -2147483646)) ? 4 : 8);
@@ -1145,9 +1291,9 @@ namespace Core {
 
             // IElement iface:
             // If this should be serialized/deserialized, it is indicated by a MinSize > 0)
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -1156,7 +1302,7 @@ namespace Core {
                     std::isnan(_value))
                 {
                     ASSERT(offset < (sizeof(IElement::NullTag) - 1));
-                    loaded = std::min(static_cast<uint16_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
+                    loaded = std::min(static_cast<uint32_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
                     ::memcpy(stream, &(IElement::NullTag[offset]), loaded);
                     offset = (((offset + loaded) == (sizeof(IElement::NullTag) - 1)) ? 0 : offset + loaded);
                 }
@@ -1168,9 +1314,9 @@ namespace Core {
                 return loaded;
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _value = 0;
@@ -1235,7 +1381,7 @@ namespace Core {
             // IMessagePack iface:
             // Refer to https://github.com/msgpack/msgpack/blob/master/spec.md#float-format-family
             // for MessagePack format for float.
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if ((_set & UNDEFINED) != 0 ||
                     std::isinf(_value) ||
@@ -1245,7 +1391,7 @@ namespace Core {
                     return (1);
                 }
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 uint8_t bytes = std::is_same<float,TYPE>::value ? 4 : 8;
 
                 if (offset == 0) {
@@ -1271,9 +1417,9 @@ namespace Core {
                 return loaded;
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 int bytes = 0;
                 if (offset == 0) {
                     // First byte depicts a lot. Find out what we need to read
@@ -1305,9 +1451,9 @@ namespace Core {
             }
 
         private:
-            uint16_t Convert(char stream[], const uint16_t maxLength, uint32_t& offset) const
+            uint32_t Convert(char stream[], const uint32_t maxLength, uint32_t& offset) const
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (_strValue.empty() == true) {
                     char str[16];
@@ -1448,9 +1594,9 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if ((_value & NullBit) != 0) {
                     while ((loaded < maxLength) && (offset < 4)) {
                         stream[loaded++] = NullTag[offset++];
@@ -1476,9 +1622,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>&) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>&) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 static constexpr char trueBuffer[] = "true";
                 static constexpr char falseBuffer[] = "false";
 
@@ -1529,7 +1675,7 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t VARIABLE_IS_NOT_USED maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t VARIABLE_IS_NOT_USED maxLength, uint32_t& offset) const override
             {
                 ASSERT (maxLength >= 1);
 
@@ -1543,7 +1689,7 @@ namespace Core {
                 return (1);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t VARIABLE_IS_NOT_USED maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t VARIABLE_IS_NOT_USED maxLength, uint32_t& offset) override
             {
                 ASSERT (maxLength >= 1);
 
@@ -1643,6 +1789,16 @@ namespace Core {
                 return (*this);
             }
 
+#ifndef _UNICODE
+            String& operator=(string&& RHS)
+            {
+                _value = std::move(RHS);
+                _flagsAndCounters |= SetBit;
+
+                return (*this);
+            }
+#endif
+
             String& operator=(const Core::OptionalType<string>& RHS)
             {
                 if (RHS.IsSet() == true) {
@@ -1810,9 +1966,9 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 ASSERT(maxLength > 0);
 
@@ -1830,6 +1986,23 @@ namespace Core {
                     uint32_t length = static_cast<uint32_t>(_value.length()) - (offset - 1);
 
                     while ((result < maxLength) && (length > 0)) {
+                        if ((_flagsAndCounters & SpecialSequenceBit) == 0) {
+                            // Copy everything up to the next character to escape in one go.
+                            uint32_t run = std::min(maxLength - result, length);
+
+                            if (isQuoted == true) {
+                                run = UnescapedLength(&(_value[offset - 1]), run);
+                            }
+
+                            if (run > 0) {
+                                ::memcpy(&(stream[result]), &(_value[offset - 1]), run);
+                                result += run;
+                                length -= run;
+                                offset += run;
+                                continue;
+                            }
+                        }
+
                         const uint16_t current = static_cast<uint16_t>((_value[offset - 1]) & 0xFF);
 
                         // See if this is a printable character
@@ -1947,10 +2120,10 @@ namespace Core {
 
                 return (result);
             }
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
                 bool finished = false;
-                uint16_t result = 0;
+                uint32_t result = 0;
                 ASSERT(maxLength > 0);
 
                 if (offset == 0) {
@@ -1967,6 +2140,39 @@ namespace Core {
                 // Might be that the last character we added was a
                 while ((result < maxLength) && (finished == false)) {
 
+                    if ((_flagsAndCounters & QuoteFoundBit) == 0) {
+                        // Opaque content is taken as is. Characters that can not change the scope,
+                        // the quoted area or the end of the value are copied in one go.
+                        const uint32_t start = result;
+
+                        if ((_flagsAndCounters & QuotedAreaBit) != 0) {
+                            while ((result < maxLength) && (stream[result] != '\"')) {
+                                result++;
+                            }
+                        }
+                        else {
+                            while ((result < maxLength) && (IsOpaqueFiller(stream[result]) == true)) {
+                                result++;
+                            }
+                        }
+
+                        if (result != start) {
+                            _value.append(&(stream[start]), result - start);
+                            continue;
+                        }
+                    }
+                    else if ((_flagsAndCounters & SpecialSequenceBit) == 0) {
+                        // Plain characters in a quoted string are taken as is, up to the next quote,
+                        // escape or control character.
+                        const uint32_t run = LiteralLength(&(stream[result]), maxLength - result);
+
+                        if (run > 0) {
+                            _value.append(&(stream[result]), run);
+                            result += run;
+                            continue;
+                        }
+                    }
+
                     TCHAR current = stream[result];
 
                     // What are we deserializing a string, or an opaque JSON object!!!
@@ -2120,9 +2326,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     if ((_flagsAndCounters & NullBit) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
@@ -2149,9 +2355,9 @@ namespace Core {
                         offset++;
                     }
 
-                    uint16_t copied = 0;
+                    uint32_t copied = 0;
                     while ((loaded < maxLength) && (offset != 0)) {
-                        copied = static_cast<uint16_t>(_value.copy(reinterpret_cast<char*>(&stream[loaded]), (maxLength - loaded), offset - (_storage & 0x0F)));
+                        copied = static_cast<uint32_t>(_value.copy(reinterpret_cast<char*>(&stream[loaded]), (maxLength - loaded), offset - (_storage & 0x0F)));
                         offset += copied;
                         loaded += copied;
                         if ((_storage & 0x0F) != 0) {
@@ -2168,9 +2374,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     _value.clear();
                     if (stream[loaded] == IMessagePack::NullValue) {
@@ -2214,6 +2420,15 @@ namespace Core {
             }
 
         private:
+            // Length of the leading part of text that can be copied as is into a quoted string.
+            static uint32_t UnescapedLength(const char text[], const uint32_t length);
+            // Length of the leading part of a quoted string without a quote, escape or control character.
+            static uint32_t LiteralLength(const char stream[], const uint32_t length);
+
+            static bool IsOpaqueFiller(const TCHAR current) {
+                return ((current != '{') && (current != '}') && (current != '[') && (current != ']') && (current != '\"') &&
+                        (current != ',') && (current != '\0') && (::isspace(static_cast<uint8_t>(current)) == 0));
+            }
             bool IsEscaped(const string& value) const {
                 // This code determines if a lot of back slashes to esscape the backslash
                 // Is odd or even, so does it escape the last character..
@@ -2379,13 +2594,13 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 static const TCHAR base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
                                                     "abcdefghijklmnopqrstuvwxyz"
                                                     "0123456789+/";
 
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0;
@@ -2439,9 +2654,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     _state = 0xFF;
@@ -2563,9 +2778,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
@@ -2595,9 +2810,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 if (offset == 0) {
                     _state = 0;
                     _length = 0;
@@ -2778,7 +2993,7 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
@@ -2790,9 +3005,9 @@ namespace Core {
                 return (static_cast<const IElement&>(_parser).Serialize(stream, maxLength, offset));
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
+                uint32_t result = static_cast<IElement&>(_parser).Deserialize(stream, maxLength, offset, error);
 
                 if (offset == 0) {
 
@@ -2820,9 +3035,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if ((_state & UNDEFINED) != 0) {
@@ -2835,9 +3050,9 @@ namespace Core {
                 return (loaded == 0 ? static_cast<const IMessagePack&>(_package).Serialize(stream, maxLength, offset) : loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 if ((offset == 0) && (stream[0] == IMessagePack::NullValue)) {
                     _state = UNDEFINED;
@@ -2865,7 +3080,12 @@ namespace Core {
             mutable NumberType<uint32_t, FALSE, BASE_HEXADECIMAL> _package;
         };
 
-        template <typename ELEMENT>
+        // By default the elements are kept in a std::list, so every element is a separate
+        // allocation but never moves. Arrays of plain values (NumberType, Boolean, String, ...)
+        // can pick a std::vector (see VectorType) for contiguous storage instead. Adding an
+        // element to such an array invalidates the references to and iterators over the
+        // previous ones. Use a std::deque if the elements must keep their address.
+        template <typename ELEMENT, typename CONTAINER = std::list<ELEMENT>>
         class ArrayType : public IElement, public IMessagePack {
         private:
             enum modus : uint8_t {
@@ -2886,7 +3106,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class ConstIteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef CONTAINER ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -3017,7 +3237,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class IteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef CONTAINER ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -3163,7 +3383,7 @@ namespace Core {
             {
             }
 
-            ArrayType(ArrayType<ELEMENT>&& move) noexcept
+            ArrayType(ArrayType<ELEMENT, CONTAINER>&& move) noexcept
                 : _state(std::move(move._state))
                 , _count(std::move(move._count))
                 , _data(std::move(move._data))
@@ -3171,7 +3391,7 @@ namespace Core {
             {
             }
 
-            ArrayType(const ArrayType<ELEMENT>& copy)
+            ArrayType(const ArrayType<ELEMENT, CONTAINER>& copy)
                 : _state(copy._state)
                 , _count(copy._count)
                 , _data(copy._data)
@@ -3181,7 +3401,7 @@ namespace Core {
 
             ~ArrayType() override = default;
 
-            ArrayType<ELEMENT>& operator=(ArrayType<ELEMENT>&& move) noexcept
+            ArrayType<ELEMENT, CONTAINER>& operator=(ArrayType<ELEMENT, CONTAINER>&& move) noexcept
             {
                 _state = std::move(move._state);
                 _data = std::move(move._data);
@@ -3191,7 +3411,7 @@ namespace Core {
                 return (*this);
             }
 
-            ArrayType<ELEMENT>& operator=(const ArrayType<ELEMENT>& RHS)
+            ArrayType<ELEMENT, CONTAINER>& operator=(const ArrayType<ELEMENT, CONTAINER>& RHS)
             {
                 _state = RHS._state;
                 _data = RHS._data;
@@ -3275,15 +3495,9 @@ namespace Core {
 
             ELEMENT& operator[](const uint32_t index)
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
+                typename CONTAINER::iterator locator = std::next(_data.begin(), index);
 
                 ASSERT(locator != _data.end());
 
@@ -3292,15 +3506,9 @@ namespace Core {
 
             const ELEMENT& operator[](const uint32_t index) const
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::const_iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
+                typename CONTAINER::const_iterator locator = std::next(_data.begin(), index);
 
                 ASSERT(locator != _data.end());
 
@@ -3329,14 +3537,14 @@ namespace Core {
                 return (result);
             }
 
-            inline ArrayType<ELEMENT>& operator=(const string& RHS)
+            inline ArrayType<ELEMENT, CONTAINER>& operator=(const string& RHS)
             {
                 FromString(RHS);
                 return (*this);
             }
 
             template<typename ENUM, typename std::enable_if<std::is_same<ELEMENT, EnumType<ENUM>>::value, int>::type = 0>
-            inline ArrayType<ELEMENT>& operator=(const ENUM& RHS)
+            inline ArrayType<ELEMENT, CONTAINER>& operator=(const ENUM& RHS)
             {
                 using T = typename std::underlying_type<ENUM>::type;
                 T value(static_cast<T>(RHS));
@@ -3357,7 +3565,7 @@ namespace Core {
             }
 
             template<typename ENUM>
-            ArrayType<ELEMENT>& operator=(const Core::OptionalType<ENUM>& RHS)
+            ArrayType<ELEMENT, CONTAINER>& operator=(const Core::OptionalType<ENUM>& RHS)
             {
                 if (RHS.IsSet() == true) {
                     operator=(RHS.Value());
@@ -3388,13 +3596,13 @@ namespace Core {
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if ((_state & modus::UNDEFINED) != 0) {
                     ASSERT(offset < (sizeof(IElement::NullTag) - 1));
-                    loaded = std::min(static_cast<uint16_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
+                    loaded = std::min(static_cast<uint32_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
                     ::memcpy(stream, &(IElement::NullTag[offset]), loaded);
                 }
                 else {
@@ -3432,9 +3640,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
                     while ((loaded < maxLength) && ::isspace(static_cast<uint8_t>(stream[loaded]))) {
@@ -3517,9 +3725,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if ((_state & modus::UNDEFINED) != 0) {
                     if (offset == 0) {
@@ -3563,9 +3771,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
@@ -3573,6 +3781,7 @@ namespace Core {
                         loaded = 1;
                     } else if ((stream[0] & 0xF0) == 0x90) {
                         _count = (stream[0] & 0x0F);
+                        Reserve(_data, _count);
                         offset = PARSE;
                     } else if (stream[0] & 0xDC) {
                         offset = 1;
@@ -3585,6 +3794,7 @@ namespace Core {
                         offset = 2;
                     } else if (offset == 2) {
                         _count = (_count << 8) | stream[loaded++];
+                        Reserve(_data, _count);
                         offset = PARSE;
                     }
                 }
@@ -3609,13 +3819,27 @@ namespace Core {
                 return (loaded);
             }
 
+        private:
+            // The element count is known upfront in MessagePack, grow contiguous storage only once.
+            template <typename STORAGE>
+            static void Reserve(STORAGE&, const uint16_t)
+            {
+            }
+            static void Reserve(std::vector<ELEMENT>& data, const uint16_t count)
+            {
+                data.reserve(data.size() + count);
+            }
+
         private:
             uint8_t _state;
             uint16_t _count;
-            std::list<ELEMENT> _data;
+            CONTAINER _data;
             mutable IteratorType<ELEMENT> _iterator;
         };
 
+        template <typename ELEMENT>
+        using VectorType = ArrayType<ELEMENT, std::vector<ELEMENT>>;
+
         class EXTERNAL Container : public IElement, public IMessagePack {
         private:
             enum modus : uint8_t {
@@ -3635,7 +3859,18 @@ namespace Core {
             static constexpr uint16_t PARSE = 7;
 
             typedef std::pair<const TCHAR*, IElement*> JSONLabelValue;
-            typedef std::list<JSONLabelValue> JSONElementList;
+            typedef std::vector<JSONLabelValue> JSONElementList;
+
+            // Labels sorted alphabetically, with the position of the element in the
+            // JSONElementList. One index is built per derived type and shared by all
+            // its instances.
+            typedef std::vector<std::pair<string, uint16_t>> FieldIndex;
+
+            enum class indexing : uint8_t {
+                UNBOUND,
+                BOUND,
+                LINEAR
+            };
 
             class Iterator {
             private:
@@ -3656,7 +3891,7 @@ namespace Core {
                 Iterator(Container& parent, JSONElementList& container)
                     : _parent(parent)
                     , _container(container)
-                    , _iterator(container.begin())
+                    , _position(0)
                     , _state(AT_BEGINNING)
                 {
                 }
@@ -3666,7 +3901,7 @@ namespace Core {
             public:
                 void Reset()
                 {
-                    _iterator = _container.begin();
+                    _position = 0;
                     _state = AT_BEGINNING;
                 }
 
@@ -3674,10 +3909,10 @@ namespace Core {
                 {
                     if (_state != AT_END) {
                         if (_state != AT_BEGINNING) {
-                            _iterator++;
+                            _position++;
                         }
 
-                        _state = (_iterator != _container.end() ? AT_ELEMENT : AT_END);
+                        _state = (_position < _container.size() ? AT_ELEMENT : AT_END);
                     }
                     return (_state == AT_ELEMENT);
                 }
@@ -3686,21 +3921,22 @@ namespace Core {
                 {
                     ASSERT(_state == AT_ELEMENT);
 
-                    return (*_iterator).first;
+                    return (_container[_position].first);
                 }
 
                 IElement* Element()
                 {
                     ASSERT(_state == AT_ELEMENT);
-                    ASSERT((*_iterator).second != nullptr);
+                    ASSERT(_container[_position].second != nullptr);
 
-                    return ((*_iterator).second);
+                    return (_container[_position].second);
                 }
 
             private:
                 Container& _parent;
                 JSONElementList& _container;
-                JSONElementList::iterator _iterator;
+                // A position, not an iterator, the element list may grow while iterating.
+                JSONElementList::size_type _position;
                 State _state;
             };
 
@@ -3714,8 +3950,10 @@ namespace Core {
                 : _state(0)
                 , _count(0)
                 , _data()
-                , _iterator()
+                , _position(0)
                 , _fieldName(true)
+                , _index(nullptr)
+                , _indexing(indexing::UNBOUND)
             {
                 ::memset(&_current, 0, sizeof(_current));
             }
@@ -3794,6 +4032,7 @@ namespace Core {
             void Add(const TCHAR label[], IElement* element)
             {
                 _data.push_back(JSONLabelValue(label, element));
+                Unbind();
             }
 
             void Remove(const TCHAR label[])
@@ -3806,27 +4045,28 @@ namespace Core {
 
                 if (index != _data.end()) {
                     _data.erase(index);
+                    Unbind();
                 }
             }
 
             // IElement iface:
-            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if ((_state & UNDEFINED) != 0) {
                     ASSERT(offset < (sizeof(IElement::NullTag) - 1));
-                    loaded = std::min(static_cast<uint16_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
+                    loaded = std::min(static_cast<uint32_t>((sizeof(IElement::NullTag) - 1) - offset), maxLength);
                     ::memcpy(stream, &(IElement::NullTag[offset]), loaded);
                 }
                 else {
                     if (offset == FIND_MARKER) {
-                        _iterator = _data.begin();
+                        _position = 0;
                         stream[loaded++] = '{';
 
-                        offset = (_iterator == _data.end() ? ~0 : ((_iterator->second->IsSet() == false) && (FindNext() == false)) ? ~0 : BEGIN_MARKER);
+                        offset = (_position == _data.size() ? ~0 : ((_data[_position].second->IsSet() == false) && (FindNext() == false)) ? ~0 : BEGIN_MARKER);
                         if (offset == BEGIN_MARKER) {
-                            _fieldName = string(_iterator->first);
+                            _fieldName = string(_data[_position].first);
                             _current.json = &_fieldName;
                             offset = PARSE;
                         }
@@ -3842,12 +4082,12 @@ namespace Core {
                         } else if (offset == BEGIN_MARKER) {
                             if (_current.json == &_fieldName) {
                                 stream[loaded++] = ':';
-                                _current.json = _iterator->second;
+                                _current.json = _data[_position].second;
                                 offset = PARSE;
                             } else {
                                 if (FindNext() != false) {
                                     stream[loaded++] = ',';
-                                    _fieldName = string(_iterator->first);
+                                    _fieldName = string(_data[_position].first);
                                     _current.json = &_fieldName;
                                     offset = PARSE;
                                 } else {
@@ -3870,9 +4110,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
                     while ((loaded < maxLength) && (::isspace(static_cast<uint8_t>(stream[loaded])))) {
@@ -4028,9 +4268,9 @@ namespace Core {
             }
 
             // IMessagePack iface:
-            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            uint32_t Serialize(uint8_t stream[], const uint32_t maxLength, uint32_t& offset) const override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if ((_state & UNDEFINED) != 0) {
                     if (offset == 0) {
@@ -4041,10 +4281,10 @@ namespace Core {
                 else {
                     uint16_t elementSize = Size();
                     if (offset == 0) {
-                        _iterator = _data.begin();
+                        _position = 0;
                         if (elementSize <= 15) {
                             stream[loaded++] = (0x80 | static_cast<uint8_t>(Size()));
-                            if (_iterator != _data.end()) {
+                            if (_position < _data.size()) {
                                 offset = PARSE;
                             }
                         } else {
@@ -4052,10 +4292,10 @@ namespace Core {
                             offset = 1;
                         }
                         if (offset != 0) {
-                            if ((_iterator->second->IsSet() == false) && (FindNext() == false)) {
+                            if ((_data[_position].second->IsSet() == false) && (FindNext() == false)) {
                                 offset = 0;
                             } else {
-                                _fieldName = string(_iterator->first);
+                                _fieldName = string(_data[_position].first);
                             }
                         }
                     }
@@ -4077,7 +4317,7 @@ namespace Core {
                             }
                             offset += PARSE;
                         } else {
-                            const IMessagePack* element = dynamic_cast<const IMessagePack*>(_iterator->second);
+                            const IMessagePack* element = dynamic_cast<const IMessagePack*>(_data[_position].second);
                             if (element != nullptr) {
                                 loaded += element->Serialize(&(stream[loaded]), maxLength - loaded, offset);
                                 if (offset == 0) {
@@ -4089,7 +4329,7 @@ namespace Core {
                             offset += PARSE;
                             if (offset == PARSE) {
                                 if (FindNext() != false) {
-                                    _fieldName = string(_iterator->first);
+                                    _fieldName = string(_data[_position].first);
                                 } else {
                                 offset = 0;
                                 _fieldName.Clear();
@@ -4102,9 +4342,9 @@ namespace Core {
                 return (loaded);
             }
 
-            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
+            uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength, uint32_t& offset) override
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (offset == 0) {
                     if (stream[0] == IMessagePack::NullValue) {
@@ -4164,23 +4404,40 @@ namespace Core {
             void Reset()
             {
                 _data.clear();
+                _index = nullptr;
+                _indexing = indexing::UNBOUND;
             }
 
             IElement* Find(const char label[])
             {
                 IElement* result = nullptr;
 
-                JSONElementList::iterator index = _data.begin();
+                if (_indexing == indexing::UNBOUND) {
+                    Bind();
+                }
 
-                while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
-                    index++;
+                if (_indexing == indexing::BOUND) {
+                    FieldIndex::const_iterator index = std::lower_bound(_index->begin(), _index->end(), label,
+                        [](const FieldIndex::value_type& entry, const char key[]) { return (strcmp(entry.first.c_str(), key) < 0); });
+
+                    if ((index != _index->end()) && (strcmp(index->first.c_str(), label) == 0)) {
+                        result = _data[index->second].second;
+                    }
                 }
+                else {
+                    JSONElementList::iterator index = _data.begin();
 
-                if (index != _data.end()) {
-                    result = index->second;
+                    while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
+                        index++;
+                    }
+
+                    if (index != _data.end()) {
+                        result = index->second;
+                    }
                 }
-                else if (Request(label) == true) {
-                    index = _data.end();
+
+                if ((result == nullptr) && (Request(label) == true)) {
+                    JSONElementList::iterator index = _data.end();
 
                     while ((result == nullptr) && (index != _data.begin())) {
                         index--;
@@ -4194,11 +4451,11 @@ namespace Core {
 
             bool FindNext() const
             {
-                _iterator++;
-                while ((_iterator != _data.end()) && (_iterator->second->IsSet() == false)) {
-                    _iterator++;
+                _position++;
+                while ((_position < _data.size()) && (_data[_position].second->IsSet() == false)) {
+                    _position++;
                 }
-                return (_iterator != _data.end());
+                return (_position < _data.size());
             }
 
             uint16_t Size() const
@@ -4221,6 +4478,21 @@ namespace Core {
                 return (false);
             }
 
+        private:
+            // Once an instance is bound to the index of its type, its fields may not
+            // change anymore. If they do, fall back to a linear search.
+            void Unbind()
+            {
+                if (_indexing == indexing::BOUND) {
+                    _index = nullptr;
+                    _indexing = indexing::LINEAR;
+                }
+            }
+            void Bind();
+
+            // Returns nullptr if there is no room left for the index of this type.
+            static const FieldIndex* Index(const std::type_info& type, const JSONElementList& fields);
+
         private:
             uint8_t _state;
             uint16_t _count;
@@ -4229,8 +4501,12 @@ namespace Core {
                 mutable IMessagePack* pack;
             } _current;
             JSONElementList _data;
-            mutable JSONElementList::const_iterator _iterator;
+            // Serialization keeps a position rather than an iterator, a field Add()ed
+            // meanwhile reallocates the list, but leaves the positions as they were.
+            mutable JSONElementList::size_type _position;
             mutable String _fieldName;
+            const FieldIndex* _index;
+            indexing _indexing;
         };
 
 #ifndef __DISABLE_USE_COMPLEMENTARY_CODE_SET__
@@ -4532,17 +4808,17 @@ namespace Core {
 
         private:
             // IElement iface:
-            uint16_t Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override;
+            uint32_t Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error) override;
 
-            static uint16_t FindEndOfScope(const char stream[], uint16_t maxLength)
+            static uint32_t FindEndOfScope(const char stream[], uint32_t maxLength)
             {
                 ASSERT(maxLength > 0 && (stream[0] == '{' || stream[0] == '['));
                 char charOpen = stream[0];
                 char charClose = charOpen == '{' ? '}' : ']';
-                uint16_t stack = 1;
-                uint16_t endIndex = 0;
+                uint32_t stack = 1;
+                uint32_t endIndex = 0;
                 bool insideQuotes = false;
-                for (uint16_t i = 1; i < maxLength; ++i) {
+                for (uint32_t i = 1; i < maxLength; ++i) {
                     if ((stream[i] == '\"') && ((stream[i - 1] != '\\') || ((stream[i - 1] == '\\') && (stream[i - 2] == '\\')))) {
                         insideQuotes = !insideQuotes;
                     }
@@ -4973,9 +5249,9 @@ namespace Core {
             return (result);
         }
 
-        inline uint16_t Variant::Deserialize(const char stream[], const uint16_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
+        inline uint32_t Variant::Deserialize(const char stream[], const uint32_t maxLength, uint32_t& offset, Core::OptionalType<Error>& error)
         {
-            uint16_t result = String::Deserialize(stream, maxLength, offset, error);
+            uint32_t result = String::Deserialize(stream, maxLength, offset, error);
 
             // If we are complete, try to guess what it was that we received...
             if (offset == 0) {
@@ -5038,7 +5314,7 @@ namespace Core {
 
                     fillCount += size;
 
-                    loaded = static_cast<IElement&>(*receptor).Deserialize(_buffer, size, offset, error);
+                    loaded = static_cast<uint16_t>(static_cast<IElement&>(*receptor).Deserialize(_buffer, static_cast<uint32_t>(size), offset, error));
 
                     ASSERT(loaded <= size);
 
@@ -5055,7 +5331,7 @@ namespace Core {
                 // Serialize object
                 do {
 
-                    loaded = static_cast<Core::JSON::IElement&>(*receptor).Serialize(_buffer, SIZE, offset);
+                    loaded = static_cast<uint16_t>(static_cast<Core::JSON::IElement&>(*receptor).Serialize(_buffer, static_cast<uint32_t>(SIZE), offset));
 
                     ASSERT(loaded <= SIZE);
 
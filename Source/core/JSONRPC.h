@@ -583,6 +583,10 @@ POP_WARNING()
             Core::JSON::String JSONRPC;
             Core::JSON::DecUInt32 Id;
             Core::JSON::String Designator;
+            // The params and result are kept as unparsed JSON text. They can not be deserialized into the
+            // typed parameters of the handler while the envelope is read: the handler is resolved on a
+            // worker thread once the message is complete, and "method" may come after "params". The
+            // receive buffer is handed over in chunks, so a span into it does not outlive the parse either.
             Core::JSON::String Parameters;
             Core::JSON::String Result;
             Info Error;
@@ -126,9 +126,9 @@ namespace Core {
 
                 _current.Release();
             }
-            typename INBOUND::BaseElement* Element(const typename INBOUND::Identifier& id) override
+            typename INBOUND::BaseElement* Element(const typename INBOUND::Identifier& id, const uint32_t sequence) override
             {
-                _current = _pool.Element(id);
+                _current = _pool.Element(id, sequence);
 
 #ifdef __DEBUG__
                 if (_current.IsValid() == false) {
@@ -162,12 +162,12 @@ namespace Core {
 
         public:
             // Methods to extract and insert data into the socket buffers
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -268,15 +268,24 @@ POP_WARNING()
         {
             _channel.Trigger();
         }
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
-            // Serialize Response
-            return (_serializerImpl.Serialize(dataFrame, maxSendSize));
+            // Serialize Response, the serializer takes at most 64KB, the link comes back for the rest.
+            return (_serializerImpl.Serialize(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            // Deserialize Request
-            return (_deserialiserImpl.Deserialize(dataFrame, receivedSize));
+            // Deserialize Request, the deserializer takes at most 64KB at a time.
+            uint32_t result = 0;
+            uint16_t handled;
+
+            do {
+                handled = _deserialiserImpl.Deserialize(&(dataFrame[result]), static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF))));
+                result += handled;
+
+            } while ((handled != 0) && (result < receivedSize));
+
+            return (result);
         }
 
     private:
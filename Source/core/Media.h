@@ -104,11 +104,11 @@ namespace Core {
             {
                 _parent.Reevaluate();
             }
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -374,9 +374,9 @@ POP_WARNING()
             _receiveSignal.SetEvent();
         }
         // Methods to extract and insert data into the socket buffers
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -398,9 +398,9 @@ POP_WARNING()
 
             return (result);
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData)
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -19,6 +19,10 @@
 
 #include "Messaging.h"
 #include "Frame.h"
+#include "Number.h"
+#include "Sync.h"
+
+#include <deque>
 
 namespace Thunder {
 
@@ -26,24 +30,388 @@ namespace Core {
 
     namespace Messaging {
 
+        namespace {
+
+            class FormatAdministration {
+            public:
+                FormatAdministration(FormatAdministration&&) = delete;
+                FormatAdministration(const FormatAdministration&) = delete;
+                FormatAdministration& operator=(FormatAdministration&&) = delete;
+                FormatAdministration& operator=(const FormatAdministration&) = delete;
+
+                FormatAdministration()
+                    : _adminLock()
+                    , _formats()
+                    , _ids()
+                {
+                }
+                ~FormatAdministration() = default;
+
+                static FormatAdministration& Instance()
+                {
+                    static FormatAdministration singleton;
+                    return (singleton);
+                }
+
+            public:
+                // Returns the id and a stable copy of the format, so the caller can cache both.
+                uint32_t Register(const TCHAR format[], const string*& copy)
+                {
+                    uint32_t result;
+
+                    _adminLock.Lock();
+
+                    std::unordered_map<const TCHAR*, uint32_t>::iterator index(_ids.find(format));
+
+                    // The same address might be reused by another format if the library that held it got unloaded.
+                    if ((index != _ids.end()) && (_formats[index->second - 1] == format)) {
+                        result = index->second;
+                    }
+                    else {
+                        _formats.emplace_back(format);
+                        result = static_cast<uint32_t>(_formats.size());
+                        _ids[format] = result;
+                    }
+
+                    copy = &(_formats[result - 1]);
+
+                    _adminLock.Unlock();
+
+                    return (result);
+                }
+                bool Lookup(const uint32_t id, string& format) const
+                {
+                    bool result = false;
+
+                    _adminLock.Lock();
+
+                    if ((id > 0) && (id <= _formats.size())) {
+                        format = _formats[id - 1];
+                        result = true;
+                    }
+
+                    _adminLock.Unlock();
+
+                    return (result);
+                }
+
+            private:
+                mutable Core::CriticalSection _adminLock;
+                std::deque<string> _formats;
+                std::unordered_map<const TCHAR*, uint32_t> _ids;
+            };
+
+            class ArgumentReader {
+            public:
+                ArgumentReader() = delete;
+                ArgumentReader(ArgumentReader&&) = delete;
+                ArgumentReader(const ArgumentReader&) = delete;
+                ArgumentReader& operator=(ArgumentReader&&) = delete;
+                ArgumentReader& operator=(const ArgumentReader&) = delete;
+
+                ArgumentReader(const string& arguments)
+                    : _arguments(arguments)
+                    , _offset(0)
+                    , _type(0)
+                    , _value(0)
+                    , _real(0)
+                    , _text()
+                {
+                }
+                ~ArgumentReader() = default;
+
+            public:
+                bool Next()
+                {
+                    bool result = false;
+
+                    if (_offset < _arguments.length()) {
+                        _type = static_cast<uint8_t>(_arguments[_offset++]);
+
+                        switch (_type) {
+                        case Formats::argument::SIGNED:
+                        case Formats::argument::UNSIGNED:
+                        case Formats::argument::POINTER:
+                            result = Read(_value);
+                            _real = static_cast<double>(_type == Formats::argument::SIGNED ? static_cast<double>(static_cast<int64_t>(_value)) : static_cast<double>(_value));
+                            break;
+                        case Formats::argument::REAL:
+                            result = Read(_real);
+                            _value = static_cast<uint64_t>(static_cast<int64_t>(_real));
+                            break;
+                        case Formats::argument::TEXT: {
+                            uint16_t length;
+                            if (Read(length) == true) {
+                                if (length == static_cast<uint16_t>(~0)) {
+                                    _text = _T("(null)");
+                                    result = true;
+                                }
+                                else if ((_offset + length) <= _arguments.length()) {
+                                    _text.assign(&(_arguments[_offset]), length);
+                                    _offset += length;
+                                    result = true;
+                                }
+                            }
+                            _value = 0;
+                            _real = 0;
+                            break;
+                        }
+                        default:
+                            break;
+                        }
+
+                        if (result == false) {
+                            _offset = static_cast<uint32_t>(_arguments.length());
+                        }
+                    }
+
+                    return (result);
+                }
+                uint8_t Type() const {
+                    return (_type);
+                }
+                uint64_t Value() const {
+                    return (_value);
+                }
+                double Real() const {
+                    return (_real);
+                }
+                const string& Text() const {
+                    return (_text);
+                }
+
+            private:
+                template <typename TYPE>
+                bool Read(TYPE& value)
+                {
+                    bool result = false;
+
+                    if ((_offset + sizeof(TYPE)) <= _arguments.length()) {
+                        ::memcpy(&value, &(_arguments[_offset]), sizeof(TYPE));
+                        _offset += sizeof(TYPE);
+                        result = true;
+                    }
+
+                    return (result);
+                }
+
+            private:
+                const string& _arguments;
+                uint32_t _offset;
+                uint8_t _type;
+                uint64_t _value;
+                double _real;
+                string _text;
+            };
+
+            template <typename TYPE>
+            void Print(string& result, const string& specification, const TYPE value)
+            {
+                TCHAR buffer[128];
+                const int length = ::snprintf(buffer, sizeof(buffer), specification.c_str(), value);
+
+                if (length > 0) {
+                    if (static_cast<size_t>(length) < sizeof(buffer)) {
+                        result.append(buffer, length);
+                    }
+                    else {
+                        std::vector<TCHAR> large(length + 1);
+                        ::snprintf(large.data(), large.size(), specification.c_str(), value);
+                        result.append(large.data(), length);
+                    }
+                }
+            }
+        }
+
+        /* static */ uint32_t Formats::Register(const TCHAR format[])
+        {
+            // Registering happens on every message, keep the common case away from the shared lock.
+            static thread_local std::unordered_map<const TCHAR*, std::pair<uint32_t, const string*>> cache;
+
+            uint32_t result;
+            std::unordered_map<const TCHAR*, std::pair<uint32_t, const string*>>::iterator index(cache.find(format));
+
+            if ((index != cache.end()) && (::strcmp(index->second.second->c_str(), format) == 0)) {
+                result = index->second.first;
+            }
+            else {
+                const string* copy = nullptr;
+                result = FormatAdministration::Instance().Register(format, copy);
+                cache[format] = std::pair<uint32_t, const string*>(result, copy);
+            }
+
+            return (result);
+        }
+
+        /* static */ bool Formats::Lookup(const uint32_t id, string& format)
+        {
+            return (FormatAdministration::Instance().Lookup(id, format));
+        }
+
+        /* static */ void Formats::Render(string& result, const string& format, const string& arguments)
+        {
+            ArgumentReader reader(arguments);
+            string::size_type index = 0;
+
+            result.clear();
+
+            while (index < format.length()) {
+                string::size_type marker = format.find('%', index);
+
+                if (marker == string::npos) {
+                    result.append(format, index, string::npos);
+                    index = format.length();
+                }
+                else if ((marker + 1) < format.length() && (format[marker + 1] == '%')) {
+                    result.append(format, index, marker - index + 1);
+                    index = marker + 2;
+                }
+                else {
+                    result.append(format, index, marker - index);
+
+                    // Rebuild the specification, widths passed as an argument are filled in and the length
+                    // modifier is replaced by the one matching the way the argument was carried.
+                    string specification(1, '%');
+                    index = marker + 1;
+
+                    while ((index < format.length()) && (::strchr("-+ #0'", format[index]) != nullptr)) {
+                        specification += format[index++];
+                    }
+                    while ((index < format.length()) && ((::isdigit(format[index]) != 0) || (format[index] == '.') || (format[index] == '*'))) {
+                        if (format[index] == '*') {
+                            specification += (reader.Next() == true ? Core::NumberType<int32_t>(static_cast<int32_t>(reader.Value())).Text() : string());
+                        }
+                        else {
+                            specification += format[index];
+                        }
+                        index++;
+                    }
+                    while ((index < format.length()) && (::strchr("hlLqjzt", format[index]) != nullptr)) {
+                        index++;
+                    }
+
+                    if (index < format.length()) {
+                        const TCHAR conversion = format[index++];
+
+                        if (reader.Next() == false) {
+                            result += _T("<?>");
+                        }
+                        else {
+                            switch (conversion) {
+                            case 'd':
+                            case 'i':
+                                Print(result, specification + _T("lld"), static_cast<long long>(reader.Value()));
+                                break;
+                            case 'u':
+                            case 'o':
+                            case 'x':
+                            case 'X':
+                                Print(result, specification + _T("ll") + conversion, static_cast<unsigned long long>(reader.Value()));
+                                break;
+                            case 'c':
+                                Print(result, specification + conversion, static_cast<int>(reader.Value()));
+                                break;
+                            case 'e':
+                            case 'E':
+                            case 'f':
+                            case 'F':
+                            case 'g':
+                            case 'G':
+                            case 'a':
+                            case 'A':
+                                Print(result, specification + conversion, reader.Real());
+                                break;
+                            case 's':
+                                if (reader.Type() == Formats::argument::TEXT) {
+                                    Print(result, specification + conversion, reader.Text().c_str());
+                                }
+                                else {
+                                    result += _T("<?>");
+                                }
+                                break;
+                            case 'p':
+                                Print(result, specification + conversion, reinterpret_cast<const void*>(static_cast<uintptr_t>(reader.Value())));
+                                break;
+                            default:
+                                // %n and friends, nothing to show.
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
         uint16_t TextMessage::Serialize(uint8_t buffer[], const uint16_t bufferSize) const
         {
-            Core::FrameType<0> frame(buffer, bufferSize, bufferSize);
-            Core::FrameType<0>::Writer writer(frame, 0);
+            uint16_t result = 0;
+
+            if ((_format != 0) && (_local == true)) {
+                const uint32_t length = 1 + sizeof(_format) + static_cast<uint32_t>(_arguments.length());
+
+                if (length <= bufferSize) {
+                    // A leading empty string marks the binary form: [0][format id][arguments]
+                    buffer[0] = '\0';
+                    ::memcpy(&(buffer[1]), &_format, sizeof(_format));
+                    ::memcpy(&(buffer[1 + sizeof(_format)]), _arguments.data(), _arguments.length());
+                    result = static_cast<uint16_t>(length);
+                }
+            }
+
+            if (result == 0) {
+                const string& text(Data());
+
+                Core::FrameType<0> frame(buffer, bufferSize, bufferSize);
+                Core::FrameType<0>::Writer writer(frame, 0);
 
-            writer.NullTerminatedText(_text, bufferSize);
+                writer.NullTerminatedText(text, bufferSize);
 
-            return (std::min(bufferSize, static_cast<uint16_t>(_text.size() + 1)));
+                result = std::min(bufferSize, static_cast<uint16_t>(text.size() + 1));
+            }
+
+            return (result);
         }
 
         uint16_t TextMessage::Deserialize(const uint8_t buffer[], const uint16_t bufferSize)
         {
-            Core::FrameType<0> frame(const_cast<uint8_t*>(buffer), bufferSize, bufferSize);
-            Core::FrameType<0>::Reader reader(frame, 0);
+            uint16_t result;
+
+            if ((bufferSize >= (1 + sizeof(_format))) && (buffer[0] == '\0')) {
+                ::memcpy(&_format, &(buffer[1]), sizeof(_format));
+                _arguments.assign(reinterpret_cast<const char*>(&(buffer[1 + sizeof(_format)])), bufferSize - 1 - sizeof(_format));
+                _text.clear();
+                _local = false;
+                result = bufferSize;
+            }
+            else {
+                Core::FrameType<0> frame(const_cast<uint8_t*>(buffer), bufferSize, bufferSize);
+                Core::FrameType<0>::Reader reader(frame, 0);
+
+                _text = reader.NullTerminatedText();
+                _format = 0;
+                _arguments.clear();
+                _local = true;
+                result = static_cast<uint16_t>(_text.size() + 1);
+            }
+
+            return (result);
+        }
+
+        const string& TextMessage::Data() const
+        {
+            if (_format != 0) {
+                string format;
 
-            _text = reader.NullTerminatedText();
+                if (_local == false) {
+                    _text = _T("<unresolved format ") + Core::NumberType<uint32_t>(_format).Text() + _T(">");
+                }
+                else if (Formats::Lookup(_format, format) == true) {
+                    Formats::Render(_text, format, _arguments);
+                    _format = 0;
+                }
+            }
 
-            return (static_cast<uint16_t>(_text.size() + 1));
+            return (_text);
         }
     }
 }
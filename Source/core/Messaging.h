@@ -28,26 +28,170 @@ namespace Core {
 
     namespace Messaging {
 
+        /**
+        * @brief Format strings of messages that are rendered by the reader in stead of the writer. A format is
+        *        registered once per process and referred to by an id, the arguments travel in a compact binary
+        *        form next to it.
+        */
+        class EXTERNAL Formats {
+        public:
+            enum argument : uint8_t {
+                SIGNED   = 1,
+                UNSIGNED = 2,
+                REAL     = 3,
+                TEXT     = 4,
+                POINTER  = 5
+            };
+
+            // Only arguments that can be carried as a plain value (or a C string) can be rendered later.
+            template <typename... Args>
+            struct IsDeferrable : public std::true_type {
+            };
+
+            template <typename TYPE, typename... Args>
+            struct IsDeferrable<TYPE, Args...> : public std::integral_constant<bool,
+                ((std::is_arithmetic<TYPE>::value) || (std::is_enum<TYPE>::value) || (std::is_pointer<TYPE>::value)) && (IsDeferrable<Args...>::value)> {
+            };
+
+        public:
+            Formats() = delete;
+            Formats(Formats&&) = delete;
+            Formats(const Formats&) = delete;
+            Formats& operator=(Formats&&) = delete;
+            Formats& operator=(const Formats&) = delete;
+
+            static uint32_t Register(const TCHAR format[]);
+            static bool Lookup(const uint32_t id, string& format);
+            static void Render(string& result, const string& format, const string& arguments);
+
+            static void Pack(string&)
+            {
+            }
+            template <typename TYPE, typename... Args>
+            static void Pack(string& arguments, TYPE value, Args... args)
+            {
+                Append(arguments, value);
+                Pack(arguments, args...);
+            }
+
+        private:
+            template <typename TYPE>
+            static void Append(string& arguments, const argument type, const TYPE value)
+            {
+                arguments.push_back(static_cast<char>(type));
+                arguments.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+            template <typename TYPE, typename std::enable_if<(std::is_integral<TYPE>::value) && (std::is_signed<TYPE>::value), int>::type = 0>
+            static void Append(string& arguments, const TYPE value)
+            {
+                Append(arguments, argument::SIGNED, static_cast<int64_t>(value));
+            }
+            template <typename TYPE, typename std::enable_if<(std::is_integral<TYPE>::value) && (!std::is_signed<TYPE>::value), int>::type = 0>
+            static void Append(string& arguments, const TYPE value)
+            {
+                Append(arguments, argument::UNSIGNED, static_cast<uint64_t>(value));
+            }
+            template <typename TYPE, typename std::enable_if<std::is_enum<TYPE>::value, int>::type = 0>
+            static void Append(string& arguments, const TYPE value)
+            {
+                Append(arguments, argument::SIGNED, static_cast<int64_t>(value));
+            }
+            template <typename TYPE, typename std::enable_if<std::is_floating_point<TYPE>::value, int>::type = 0>
+            static void Append(string& arguments, const TYPE value)
+            {
+                Append(arguments, argument::REAL, static_cast<double>(value));
+            }
+            template <typename TYPE>
+            static void Append(string& arguments, const TYPE* value)
+            {
+                Append(arguments, argument::POINTER, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+            }
+            static void Append(string& arguments, const char* value)
+            {
+                const uint16_t length = (value == nullptr ? static_cast<uint16_t>(~0) : static_cast<uint16_t>(std::min(::strlen(value), static_cast<size_t>(0xFFFE))));
+
+                Append(arguments, argument::TEXT, length);
+
+                if (value != nullptr) {
+                    arguments.append(value, length);
+                }
+            }
+            static void Append(string& arguments, char* value)
+            {
+                Append(arguments, static_cast<const char*>(value));
+            }
+        };
+
+        /**
+        * @brief The state a category keeps when its text is not rendered on the spot but deferred to the reader.
+        *        The format only lives in the producing process. A reader that did not fetch it before that
+        *        process went away, e.g. after a crash, can no longer render these messages: they show up as
+        *        "<unresolved format id>", often the very messages leading up to the crash.
+        */
+        class EXTERNAL DeferredText {
+        protected:
+            DeferredText()
+                : _format(0)
+                , _arguments()
+            {
+            }
+            ~DeferredText() = default;
+
+        public:
+            uint32_t Format() const {
+                return (_format);
+            }
+            const string& Arguments() const {
+                return (_arguments);
+            }
+
+        protected:
+            template <typename... Args>
+            void Defer(const TCHAR formatter[], Args... args)
+            {
+                _format = Formats::Register(formatter);
+                Formats::Pack(_arguments, args...);
+            }
+
+        protected:
+            uint32_t _format;
+            string _arguments;
+        };
+
         template <const Core::Messaging::Metadata::type TYPE>
-        class BaseCategoryType {
+        class BaseCategoryType : public DeferredText {
         public:
             ~BaseCategoryType() = default;
             BaseCategoryType& operator=(const BaseCategoryType&) = delete;
 
             template<typename... Args>
             BaseCategoryType(const string& formatter, Args... args)
-                : _text()
+                : DeferredText()
+                , _text()
             {
                 Core::Format(_text, formatter.c_str(), args...);
             }
 
+#if defined(__CORE_DEFERRED_FORMATTING__) && !defined(_UNICODE)
+            // A literal format is not rendered here if all arguments can be carried as is.
+            template<typename... Args>
+            BaseCategoryType(const TCHAR formatter[], Args... args)
+                : DeferredText()
+                , _text()
+            {
+                Capture(typename Formats::IsDeferrable<Args...>::type(), formatter, args...);
+            }
+#endif
+
             BaseCategoryType(const string& text)
-                : _text(text)
+                : DeferredText()
+                , _text(text)
             {
             }
 
             BaseCategoryType()
-                : _text()
+                : DeferredText()
+                , _text()
             {
             }
 
@@ -57,31 +201,85 @@ namespace Core {
             static constexpr Core::Messaging::Metadata::type Type = TYPE;
 
             const char* Data() const {
+                if ((_format != 0) && (_text.empty() == true)) {
+                    string format;
+
+                    if (Formats::Lookup(_format, format) == true) {
+                        Formats::Render(_text, format, _arguments);
+                    }
+                }
+
                 return (_text.c_str());
             }
 
             uint16_t Length() const {
-                return (static_cast<uint16_t>(_text.length()));
+                return (static_cast<uint16_t>(::strlen(Data())));
             }
 
         protected:
             void Set(const string& text) {
+                _format = 0;
                 _text = text;
             }
 
         private:
-            string _text;
+            template<typename... Args>
+            void Capture(const std::true_type&, const TCHAR formatter[], Args... args)
+            {
+                DeferredText::Defer(formatter, args...);
+            }
+            template<typename... Args>
+            void Capture(const std::false_type&, const TCHAR formatter[], Args... args)
+            {
+                Core::Format(_text, formatter, args...);
+            }
+            void Capture(const std::true_type&, const TCHAR formatter[])
+            {
+                // Nothing to format, take it as is, just like the string version does.
+                _text = formatter;
+            }
+
+        private:
+            mutable string _text;
         };
 
         class EXTERNAL TextMessage : public Core::Messaging::IEvent {
         public:
-            TextMessage() = default;
+            TextMessage()
+                : _text()
+                , _format(0)
+                , _arguments()
+                , _local(true)
+            {
+            }
             TextMessage(const string& text)
                 : _text(text)
+                , _format(0)
+                , _arguments()
+                , _local(true)
             {
             }
             TextMessage(const uint16_t length, const TCHAR buffer[])
                 : _text(buffer, length)
+                , _format(0)
+                , _arguments()
+                , _local(true)
+            {
+            }
+            template <typename CATEGORY, typename std::enable_if<std::is_base_of<DeferredText, CATEGORY>::value, int>::type = 0>
+            explicit TextMessage(const CATEGORY& category)
+                : _text(category.Format() == 0 ? category.Data() : _T(""))
+                , _format(category.Format())
+                , _arguments(category.Arguments())
+                , _local(true)
+            {
+            }
+            template <typename CATEGORY, typename std::enable_if<(std::is_class<CATEGORY>::value) && (!std::is_base_of<DeferredText, CATEGORY>::value) && (!std::is_convertible<const CATEGORY&, string>::value), int>::type = 0>
+            explicit TextMessage(const CATEGORY& category)
+                : _text(category.Data())
+                , _format(0)
+                , _arguments()
+                , _local(true)
             {
             }
 
@@ -91,12 +289,25 @@ namespace Core {
             uint16_t Serialize(uint8_t buffer[], const uint16_t bufferSize) const override;
             uint16_t Deserialize(const uint8_t buffer[], const uint16_t bufferSize) override;
 
-            const string& Data() const override {
-                return (_text);
+            const string& Data() const override;
+
+            /**
+            * @brief Id of the format the reader still has to supply to render this message, 0 if there is none.
+            */
+            uint32_t Deferred() const {
+                return (_local == false ? _format : 0);
+            }
+            void Render(const string& format)
+            {
+                Formats::Render(_text, format, _arguments);
+                _format = 0;
             }
 
         private:
-            string _text;
+            mutable string _text;
+            mutable uint32_t _format;
+            string _arguments;
+            bool _local;
         };
 
     }
@@ -78,6 +78,10 @@ namespace Thunder {
 			inline uint32_t Position() const {
 				return (_byteCounter);
 			}
+			// Nothing is collected, flushed or passed on, the next byte starts a new token.
+			inline bool IsIdle() const {
+				return ((_buffer.empty() == true) && ((_state & (QUOTED | ESCAPED | FLUSH_LINE | EXTERNALPASS | PARSESTOP | WAS_QUOTED)) == 0));
+			}
 			inline void CollectWord()
 			{
 				_state = WORD_CAPTURE | (_state & (~(UPPERCASE | LOWERCASE | SPLITCHAR)));
@@ -0,0 +1,328 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Proxy.h"
+
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Thunder {
+namespace Core {
+
+    namespace {
+
+        // Every block starts with a header holding its size class. It is as large as the
+        // strictest fundamental alignment, so the blocks are aligned like malloc'ed ones.
+        constexpr size_t Header = alignof(std::max_align_t);
+        constexpr uint8_t Oversized = 0xFF;
+
+        // Blocks moved between the shared pool and a thread cache in one go.
+        constexpr uint16_t Batch = 32;
+        // Slabs are at least this large, or hold at least Batch blocks.
+        constexpr size_t SlabSize = 64 * 1024;
+
+        constexpr uint32_t ClassSize[ProxyAllocator::Classes] = {
+            32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144
+        };
+
+        inline uint8_t ClassOf(const size_t size)
+        {
+            uint8_t index = 0;
+
+            while ((index < ProxyAllocator::Classes) && (ClassSize[index] < size)) {
+                index++;
+            }
+
+            return (index < ProxyAllocator::Classes ? index : Oversized);
+        }
+
+        inline void*& Next(void* block)
+        {
+            return (*reinterpret_cast<void**>(block));
+        }
+
+        class Pool {
+        public:
+            Pool(Pool&&) = delete;
+            Pool(const Pool&) = delete;
+            Pool& operator=(Pool&&) = delete;
+            Pool& operator=(const Pool&) = delete;
+
+            Pool()
+                : _lock()
+                , _free(nullptr)
+                , _reserved(0)
+                , _available(0)
+                , _refills(0)
+            {
+            }
+            ~Pool() = default;
+
+        public:
+            // Hands out up to maxCount blocks as a linked list, carves a new slab if the pool ran dry.
+            uint16_t Take(const uint8_t index, void*& list, const uint16_t maxCount)
+            {
+                uint16_t count = 0;
+
+                _lock.Lock();
+
+                if (_free == nullptr) {
+                    Carve(index);
+                }
+
+                list = _free;
+
+                void* last = nullptr;
+
+                while ((_free != nullptr) && (count < maxCount)) {
+                    last = _free;
+                    _free = Next(_free);
+                    count++;
+                }
+
+                if (last != nullptr) {
+                    Next(last) = nullptr;
+                }
+
+                _available -= count;
+                _refills++;
+
+                _lock.Unlock();
+
+                return (count);
+            }
+            void Give(void* first, void* last, const uint16_t count)
+            {
+                _lock.Lock();
+
+                Next(last) = _free;
+                _free = first;
+                _available += count;
+
+                _lock.Unlock();
+            }
+            void Snapshot(ProxyAllocator::Statistics& info) const
+            {
+                _lock.Lock();
+                info.reserved = _reserved;
+                info.available = _available;
+                info.refills = _refills;
+                _lock.Unlock();
+            }
+
+        private:
+            void Carve(const uint8_t index)
+            {
+                const size_t blockSize = ClassSize[index];
+                const size_t blocks = std::max(static_cast<size_t>(Batch), SlabSize / blockSize);
+                uint8_t* slab = reinterpret_cast<uint8_t*>(::malloc(blocks * blockSize));
+
+                if (slab != nullptr) {
+                    for (size_t teller = blocks; teller > 0; teller--) {
+                        void* block = &slab[(teller - 1) * blockSize];
+                        Next(block) = _free;
+                        _free = block;
+                    }
+
+                    _reserved += static_cast<uint32_t>(blocks);
+                    _available += static_cast<uint32_t>(blocks);
+                }
+            }
+
+        private:
+            mutable CriticalSection _lock;
+            void* _free;
+            uint32_t _reserved;
+            uint32_t _available;
+            uint32_t _refills;
+        };
+
+        // Allocated once and never destructed, blocks might still be freed while the
+        // process is tearing down the static objects.
+        Pool* Pools()
+        {
+            static Pool* pools = new Pool[ProxyAllocator::Classes];
+            return (pools);
+        }
+
+        std::atomic<uint32_t> _oversized(0);
+
+        // Trivially destructible, so it can still be checked once the Cache of this thread is gone.
+        thread_local bool _torndown = false;
+
+        class Cache {
+        public:
+            Cache(Cache&&) = delete;
+            Cache(const Cache&) = delete;
+            Cache& operator=(Cache&&) = delete;
+            Cache& operator=(const Cache&) = delete;
+
+            Cache()
+                : _head()
+                , _count()
+            {
+                for (uint8_t index = 0; index < ProxyAllocator::Classes; index++) {
+                    _head[index] = nullptr;
+                    _count[index] = 0;
+                }
+            }
+            ~Cache()
+            {
+                _torndown = true;
+
+                for (uint8_t index = 0; index < ProxyAllocator::Classes; index++) {
+                    if (_head[index] != nullptr) {
+                        void* last = _head[index];
+
+                        while (Next(last) != nullptr) {
+                            last = Next(last);
+                        }
+
+                        Pools()[index].Give(_head[index], last, _count[index]);
+                    }
+                }
+            }
+
+        public:
+            void* Allocate(const uint8_t index)
+            {
+                if (_head[index] == nullptr) {
+                    _count[index] = Pools()[index].Take(index, _head[index], Batch);
+                }
+
+                void* result = _head[index];
+
+                if (result != nullptr) {
+                    _head[index] = Next(result);
+                    _count[index]--;
+                }
+
+                return (result);
+            }
+            void Free(const uint8_t index, void* block)
+            {
+                Next(block) = _head[index];
+                _head[index] = block;
+                _count[index]++;
+
+                // Do not let a thread that only frees (e.g. a consumer) hoard the blocks.
+                if (_count[index] >= (2 * Batch)) {
+                    void* first = _head[index];
+                    void* last = first;
+
+                    for (uint16_t teller = 1; teller < Batch; teller++) {
+                        last = Next(last);
+                    }
+
+                    _head[index] = Next(last);
+                    _count[index] -= Batch;
+
+                    Pools()[index].Give(first, last, Batch);
+                }
+            }
+
+        private:
+            void* _head[ProxyAllocator::Classes];
+            uint16_t _count[ProxyAllocator::Classes];
+        };
+
+        Cache* Local()
+        {
+            Cache* result = nullptr;
+
+            if (_torndown == false) {
+                static thread_local Cache cache;
+                result = &cache;
+            }
+
+            return (result);
+        }
+    }
+
+    /* static */ void* ProxyAllocator::Allocate(const size_t size)
+    {
+        uint8_t* block = nullptr;
+        const uint8_t index = ClassOf(size + Header);
+
+        if (index == Oversized) {
+            block = reinterpret_cast<uint8_t*>(::malloc(size + Header));
+            _oversized.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            Cache* cache = Local();
+
+            if (cache != nullptr) {
+                block = reinterpret_cast<uint8_t*>(cache->Allocate(index));
+            }
+            else {
+                void* list = nullptr;
+
+                if (Pools()[index].Take(index, list, 1) != 0) {
+                    block = reinterpret_cast<uint8_t*>(list);
+                }
+            }
+        }
+
+        if (block != nullptr) {
+            block[0] = index;
+            block = &block[Header];
+        }
+
+        return (block);
+    }
+
+    /* static */ void ProxyAllocator::Free(void* data)
+    {
+        if (data != nullptr) {
+            uint8_t* block = &(reinterpret_cast<uint8_t*>(data)[-static_cast<ptrdiff_t>(Header)]);
+            const uint8_t index = block[0];
+
+            if (index == Oversized) {
+                ::free(block);
+            }
+            else {
+                ASSERT(index < Classes);
+
+                Cache* cache = Local();
+
+                if (cache != nullptr) {
+                    cache->Free(index, block);
+                }
+                else {
+                    Pools()[index].Give(block, block, 1);
+                }
+            }
+        }
+    }
+
+    /* static */ uint32_t ProxyAllocator::Snapshot(Statistics info[Classes])
+    {
+        for (uint8_t index = 0; index < Classes; index++) {
+            info[index].size = ClassSize[index];
+            Pools()[index].Snapshot(info[index]);
+        }
+
+        return (_oversized.load(std::memory_order_relaxed));
+    }
+}
+}
+
+#endif // __CORE_PROXY_SLAB_ALLOCATOR__
@@ -47,6 +47,40 @@ namespace Thunder {
         template <typename ELEMENT>
         class SingletonProxyType;
 
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+        // ------------------------------------------------------------------------------
+        // Memory for the ProxyObjects is handed out in blocks of a fixed set of sizes
+        // (size classes). Blocks are carved from larger slabs and freed blocks are kept
+        // in a cache of the freeing thread, so most Create/Release pairs never get to
+        // the heap. Slabs are never returned to the system. Requests larger than the
+        // largest class go straight to the heap.
+        class EXTERNAL ProxyAllocator {
+        public:
+            static constexpr uint8_t Classes = 16;
+
+            struct Statistics {
+                uint32_t size; // Size of a block in this class, including its header
+                uint32_t reserved; // Blocks carved from slabs
+                uint32_t available; // Blocks in the shared pool, not cached by any thread
+                uint32_t refills; // Batches handed from the shared pool to a thread cache
+            };
+
+        public:
+            ProxyAllocator() = delete;
+            ProxyAllocator(ProxyAllocator&&) = delete;
+            ProxyAllocator(const ProxyAllocator&) = delete;
+            ProxyAllocator& operator=(ProxyAllocator&&) = delete;
+            ProxyAllocator& operator=(const ProxyAllocator&) = delete;
+
+        public:
+            static void* Allocate(const size_t size);
+            static void Free(void* block);
+
+            // Fills one entry per size class, returns the number of blocks that were too large for any class.
+            static uint32_t Snapshot(Statistics info[Classes]);
+        };
+#endif
+
         PUSH_WARNING(DISABLE_WARNING_MULTPILE_INHERITENCE_OF_BASE_CLASS)
         template <typename CONTEXT>
         class ProxyObject final : public CONTEXT, public std::conditional<std::is_base_of<IReferenceCounted, CONTEXT>::value, Void, IReferenceCounted>::type {
@@ -81,6 +115,18 @@ namespace Thunder {
                 // memory alignment
                 size_t alignedSize = ((stAllocateBlock + (sizeof(void*) - 1)) & (static_cast<size_t>(~(sizeof(void*) - 1))));
 
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+                if (AdditionalSize != 0) {
+                    Space = reinterpret_cast<uint8_t*>(ProxyAllocator::Allocate(alignedSize + sizeof(void*) + AdditionalSize));
+
+                    if (Space != nullptr) {
+                        *(reinterpret_cast<uint32_t*>(&Space[alignedSize])) = AdditionalSize;
+                    }
+                }
+                else {
+                    Space = reinterpret_cast<uint8_t*>(ProxyAllocator::Allocate(alignedSize));
+                }
+#else
                 if (AdditionalSize != 0) {
                     Space = reinterpret_cast<uint8_t*>(::malloc(alignedSize + sizeof(void*) + AdditionalSize));
 
@@ -91,6 +137,7 @@ namespace Thunder {
                 else {
                     Space = reinterpret_cast<uint8_t*>(::malloc(alignedSize));
                 }
+#endif
 
                 return Space;
             }
@@ -100,9 +147,13 @@ namespace Thunder {
                     void* stAllocateBlock)
             {
                 reinterpret_cast<ProxyObject<CONTEXT>*>(stAllocateBlock)->__Destructed();
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+                ProxyAllocator::Free(stAllocateBlock);
+#else
 PUSH_WARNING(DISABLE_WARNING_FREE_NONHEAP_OBJECT)
                 ::free(stAllocateBlock);
 POP_WARNING()
+#endif
             }
 
         public:
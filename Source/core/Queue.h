@@ -28,11 +28,14 @@
 #define __QUEUE_H
 
 #include <algorithm>
+#include <atomic>
 #include <queue>
+#include <thread>
 
 #include "Module.h"
 #include "StateTrigger.h"
 #include "Sync.h"
+#include "Time.h"
 
 namespace Thunder {
 namespace Core {
@@ -320,6 +323,500 @@ namespace Core {
         mutable CriticalSection _adminLock;
         const uint32_t _maxSlots;
     };
+
+    // ---------------------------------------------------------------------------
+    // The LockFreeQueueType offers the same interface as the QueueType, but the
+    // entries are kept in a bounded ring (Vyukov style MPMC queue). Producers and
+    // consumers only synchronise on atomic positions, they never share a lock.
+    // Each cell carries, next to its sequence number, a small state so entries
+    // can be inspected (Visit/HasEntry) or revoked (Remove) while they are in
+    // the ring. A revoked cell is left behind as a tombstone that the consumers
+    // skip. Only when a thread has to wait (empty on Extract, full on Insert) it
+    // falls back to a semaphore.
+    // The highwatermark is used to limit the Insert, Post is never refused as
+    // long as the queue is enabled. The ring is sized well beyond the mark, if
+    // it is completely exhausted a Post will yield until a slot is freed.
+    // Lock/Unlock freeze the consumers: once Lock returns, no entry is in the
+    // middle of being handed over to a consumer, and none leaves the ring
+    // until Unlock. Producers are not blocked. Visit, HasEntry and Remove take
+    // the lock, so an entry is always seen either in the ring or as already
+    // extracted. Do not Extract while holding the lock.
+    // ---------------------------------------------------------------------------
+    template <typename CONTEXT>
+    class LockFreeQueueType {
+    private:
+        enum state : uint8_t {
+            EMPTY,
+            FULL,
+            BUSY,
+            REVOKED
+        };
+
+        struct Cell {
+            Cell()
+                : Sequence(0)
+                , State(EMPTY)
+                , Data()
+            {
+            }
+
+            std::atomic<uint32_t> Sequence;
+            std::atomic<uint8_t> State;
+            CONTEXT Data;
+        };
+
+        class Waiters {
+        public:
+            Waiters(Waiters&&) = delete;
+            Waiters(const Waiters&) = delete;
+            Waiters& operator=(Waiters&&) = delete;
+            Waiters& operator=(const Waiters&) = delete;
+
+            Waiters()
+                : _count(0)
+                , _signal(0, 0x7FFFFFFF)
+            {
+            }
+            ~Waiters() = default;
+
+        public:
+            // Returns true if the caller should re-evaluate its condition, false on a timeout.
+            template <typename CONDITION>
+            bool Wait(CONDITION&& condition, const uint32_t waitTime)
+            {
+                bool result = true;
+
+                _count.fetch_add(1);
+
+                if (condition() == true) {
+                    Leave();
+                } else if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
+                    Leave();
+                    result = false;
+                }
+
+                return (result);
+            }
+            void Wake(uint32_t count)
+            {
+                int32_t waiting = _count.load();
+
+                while ((waiting > 0) && (count > 0)) {
+                    if (_count.compare_exchange_weak(waiting, waiting - 1) == true) {
+                        _signal.Unlock(1);
+                        waiting--;
+                        count--;
+                    }
+                }
+            }
+
+        private:
+            void Leave()
+            {
+                int32_t waiting = _count.load();
+
+                while (waiting > 0) {
+                    if (_count.compare_exchange_weak(waiting, waiting - 1) == true) {
+                        return;
+                    }
+                }
+
+                // Someone already claimed our registration, a signal is on its way.
+                _signal.Lock(Core::infinite);
+            }
+
+        private:
+            std::atomic<int32_t> _count;
+            CountingSemaphore _signal;
+        };
+
+    public:
+        LockFreeQueueType() = delete;
+        LockFreeQueueType(LockFreeQueueType<CONTEXT>&&) = delete;
+        LockFreeQueueType(const LockFreeQueueType<CONTEXT>&) = delete;
+        LockFreeQueueType& operator=(LockFreeQueueType<CONTEXT>&&) = delete;
+        LockFreeQueueType& operator=(const LockFreeQueueType<CONTEXT>&) = delete;
+
+        explicit LockFreeQueueType(const uint32_t highWaterMark)
+            : _maxSlots(highWaterMark)
+            , _mask(Capacity(highWaterMark) - 1)
+            , _cells(new Cell[_mask + 1])
+            , _head(0)
+            , _tail(0)
+            , _entries(0)
+            , _disabled(false)
+            , _consumers()
+            , _producers()
+            , _adminLock()
+            , _frozen(false)
+            , _popping(0)
+            , _freezes(0)
+            , _freezer()
+        {
+            // A highwatermark of 0 is bullshit.
+            ASSERT(_maxSlots != 0);
+
+            for (uint32_t index = 0; index <= _mask; index++) {
+                _cells[index].Sequence.store(index, std::memory_order_relaxed);
+            }
+
+            TRACE_L5("Constructor LockFreeQueueType <%p>", (this));
+        }
+        ~LockFreeQueueType()
+        {
+            TRACE_L5("Destructor LockFreeQueueType <%p>", (this));
+
+            // Disable the queue, the entries go with the cells.
+            Disable();
+
+            delete[] _cells;
+        }
+
+    public:
+        bool Remove(const CONTEXT& entry)
+        {
+            bool removed = false;
+
+            if (_disabled.load() == false) {
+                removed = Inspect([&](Cell& cell) -> bool {
+                    bool found = (cell.Data == entry);
+
+                    if (found == true) {
+                        cell.Data = CONTEXT();
+                    }
+
+                    return (found);
+                }, true);
+
+                if (removed == true) {
+                    _entries.fetch_sub(1);
+                    _producers.Wake(1);
+                }
+            }
+
+            return (removed);
+        }
+        bool Post(const CONTEXT& entry)
+        {
+            bool posted = false;
+
+            while ((_disabled.load() == false) && ((posted = Push(entry)) == false)) {
+                // The ring is exhausted, wait for a consumer to free a cell. If we are the
+                // ones holding the consumers, let them go for a moment.
+                if (_freezer.load() == std::this_thread::get_id()) {
+                    _frozen.store(false);
+                    std::this_thread::yield();
+                    Freeze();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+
+            return (posted);
+        }
+        bool Insert(const CONTEXT& entry, const uint32_t waitTime)
+        {
+            bool posted = false;
+            const uint64_t deadline = Deadline(waitTime);
+
+            while ((posted == false) && (_disabled.load() == false)) {
+                if ((IsFull() == false) && ((posted = Push(entry)) == true)) {
+                    break;
+                }
+
+                if (_producers.Wait([this]() { return ((IsFull() == false) || (_disabled.load() == true)); }, Remaining(deadline, waitTime)) == false) {
+                    break;
+                }
+            }
+
+            return (posted);
+        }
+        bool Extract(CONTEXT& result, const uint32_t waitTime)
+        {
+            bool received = false;
+            const uint64_t deadline = Deadline(waitTime);
+
+            while ((_disabled.load() == false) && ((received = Pop(result)) == false)) {
+                if (_entries.load() > 0) {
+                    // An entry was announced but its producer is still filling its cell.
+                    std::this_thread::yield();
+                } else if (_consumers.Wait([this]() { return ((_entries.load() > 0) || (_disabled.load() == true)); }, Remaining(deadline, waitTime)) == false) {
+                    break;
+                }
+            }
+
+            return (received);
+        }
+        void Enable()
+        {
+            _disabled.store(false);
+        }
+        void Disable()
+        {
+            if (_disabled.exchange(true) == false) {
+                // Release everyone waiting, they will see the disabled flag.
+                _consumers.Wake(~0u);
+                _producers.Wake(~0u);
+            }
+        }
+        void Flush()
+        {
+            // Clear is only possible in a "DISABLED" state !!
+            ASSERT(_disabled.load() == true);
+
+            CONTEXT entry;
+
+            while (Pop(entry) == true) {
+                entry = CONTEXT();
+            }
+        }
+        void FreeSlot() const
+        {
+            while ((IsFull() == true) && (_disabled.load() == false)) {
+                const_cast<Waiters&>(_producers).Wait([this]() { return ((IsFull() == false) || (_disabled.load() == true)); }, Core::infinite);
+            }
+        }
+        bool IsEmpty() const
+        {
+            return (_entries.load() <= 0);
+        }
+        bool IsFull() const
+        {
+            return (_entries.load() >= static_cast<int32_t>(_maxSlots));
+        }
+        uint32_t Length() const
+        {
+            const int32_t length = _entries.load();
+
+            return (length > 0 ? static_cast<uint32_t>(length) : 0);
+        }
+        // void action(const CONTEXT& element)
+        template <typename ACTION>
+        void Visit(ACTION&& action) const
+        {
+            const_cast<LockFreeQueueType<CONTEXT>*>(this)->Inspect([&](Cell& cell) -> bool {
+                action(static_cast<const CONTEXT&>(cell.Data));
+                return (false);
+            }, false);
+        }
+        bool HasEntry(const CONTEXT& element) const
+        {
+            return (const_cast<LockFreeQueueType<CONTEXT>*>(this)->Inspect([&](Cell& cell) -> bool {
+                return (cell.Data == element);
+            }, false));
+        }
+        void Lock() const
+        {
+            _adminLock.Lock();
+
+            if (_freezes++ == 0) {
+                _freezer.store(std::this_thread::get_id());
+                Freeze();
+            }
+        }
+        void Unlock() const
+        {
+            ASSERT(_freezes > 0);
+
+            if (--_freezes == 0) {
+                _freezer.store(std::thread::id());
+                _frozen.store(false);
+            }
+
+            _adminLock.Unlock();
+        }
+
+    private:
+        static uint32_t Capacity(const uint32_t highWaterMark)
+        {
+            // Leave plenty of room for Post, which ignores the highwatermark.
+            uint32_t capacity = 64;
+
+            while ((capacity < (highWaterMark * 4)) && (capacity < 0x40000000)) {
+                capacity <<= 1;
+            }
+
+            return (capacity);
+        }
+        static uint64_t Deadline(const uint32_t waitTime)
+        {
+            return (waitTime == Core::infinite ? 0 : Time::Now().Add(waitTime).Ticks());
+        }
+        static uint32_t Remaining(const uint64_t deadline, const uint32_t waitTime)
+        {
+            uint32_t result = waitTime;
+
+            if (waitTime != Core::infinite) {
+                const uint64_t now = Time::Now().Ticks();
+
+                result = (now >= deadline ? 0 : static_cast<uint32_t>((deadline - now) / Time::TicksPerMillisecond));
+            }
+
+            return (result);
+        }
+        bool Push(const CONTEXT& entry)
+        {
+            uint32_t position = _tail.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            while (cell == nullptr) {
+                Cell& candidate = _cells[position & _mask];
+                const int32_t distance = static_cast<int32_t>(candidate.Sequence.load(std::memory_order_acquire) - position);
+
+                if (distance < 0) {
+                    // Ring is exhausted.
+                    return (false);
+                } else if (distance > 0) {
+                    position = _tail.load(std::memory_order_relaxed);
+                } else if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                    cell = &candidate;
+                }
+            }
+
+            cell->Data = entry;
+            cell->State.store(FULL, std::memory_order_release);
+            cell->Sequence.store(position + 1, std::memory_order_release);
+
+            _entries.fetch_add(1);
+            _consumers.Wake(1);
+
+            return (true);
+        }
+        void Freeze() const
+        {
+            _frozen.store(true);
+
+            // Let the consumers that are already extracting, finish their handover.
+            while (_popping.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+        bool Pop(CONTEXT& result)
+        {
+            // Announce ourselves before checking for a freeze, Lock() waits for the announced ones.
+            _popping.fetch_add(1);
+
+            while (_frozen.load() == true) {
+                _popping.fetch_sub(1);
+
+                _adminLock.Lock();
+                _adminLock.Unlock();
+
+                _popping.fetch_add(1);
+            }
+
+            const bool popped = Claim(result);
+
+            _popping.fetch_sub(1);
+
+            return (popped);
+        }
+        bool Claim(CONTEXT& result)
+        {
+            uint32_t position = _head.load(std::memory_order_relaxed);
+
+            while (true) {
+                Cell& cell = _cells[position & _mask];
+                const int32_t distance = static_cast<int32_t>(cell.Sequence.load(std::memory_order_acquire) - (position + 1));
+
+                if (distance < 0) {
+                    // Nothing (completely) posted at the head.
+                    return (false);
+                } else if (distance > 0) {
+                    position = _head.load(std::memory_order_relaxed);
+                } else if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                    uint8_t current = FULL;
+
+                    // Wait for an inspector (if any) to let go of this cell.
+                    while ((cell.State.compare_exchange_weak(current, BUSY, std::memory_order_acquire) == false) && (current != REVOKED)) {
+                        current = FULL;
+                        std::this_thread::yield();
+                    }
+
+                    const bool available = (current != REVOKED);
+
+                    if (available == true) {
+                        result = cell.Data;
+                        cell.Data = CONTEXT();
+                    }
+
+                    cell.State.store(EMPTY, std::memory_order_relaxed);
+                    cell.Sequence.store(position + _mask + 1, std::memory_order_release);
+
+                    if (available == true) {
+                        _entries.fetch_sub(1);
+                        _producers.Wake(1);
+                        return (true);
+                    }
+
+                    // It was a tombstone, continue with the next one.
+                    position = _head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        // bool action(Cell& cell), returns true to stop the inspection.
+        template <typename ACTION>
+        bool Inspect(ACTION&& action, const bool revoke)
+        {
+            // With the consumers frozen, an entry between head and tail is not halfway a handover.
+            Lock();
+
+            bool stopped = false;
+            uint32_t position = _head.load(std::memory_order_acquire);
+            const uint32_t end = _tail.load(std::memory_order_acquire);
+
+            while ((stopped == false) && (static_cast<int32_t>(end - position) > 0)) {
+                Cell& cell = _cells[position & _mask];
+
+                bool acquired = false;
+
+                // If the cell is BUSY, wait for it to be resolved. A consumer holding it is
+                // handing the entry over, once done (sequence moved) its new owner is known.
+                while ((acquired == false) && (cell.Sequence.load(std::memory_order_acquire) == (position + 1))) {
+                    uint8_t current = FULL;
+
+                    if (cell.State.compare_exchange_weak(current, BUSY, std::memory_order_acquire) == true) {
+                        acquired = true;
+                    } else if ((current == REVOKED) || (current == EMPTY)) {
+                        break;
+                    } else if (current == BUSY) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                if (acquired == true) {
+                    // The cell could have been consumed and refilled in the mean time.
+                    if (cell.Sequence.load(std::memory_order_acquire) == (position + 1)) {
+                        stopped = action(cell);
+                    }
+
+                    cell.State.store(((stopped == true) && (revoke == true)) ? REVOKED : FULL, std::memory_order_release);
+                }
+
+                position++;
+            }
+
+            Unlock();
+
+            return (stopped);
+        }
+
+    private:
+        const uint32_t _maxSlots;
+        const uint32_t _mask;
+        Cell* _cells;
+        alignas(64) std::atomic<uint32_t> _head;
+        alignas(64) std::atomic<uint32_t> _tail;
+        alignas(64) std::atomic<int32_t> _entries;
+        std::atomic<bool> _disabled;
+        Waiters _consumers;
+        Waiters _producers;
+        mutable CriticalSection _adminLock;
+        mutable std::atomic<bool> _frozen;
+        std::atomic<uint32_t> _popping;
+        mutable uint32_t _freezes;
+        mutable std::atomic<std::thread::id> _freezer;
+    };
 }
 } // namespace Core
 
@@ -24,6 +24,23 @@ namespace Thunder {
 
 namespace Core {
 
+    ResourceMonitor::ResourceMonitor()
+        : _reactors()
+        , _assignmentLock()
+        , _assignments()
+        , _sealed(false)
+    {
+        _reactors.push_back(new ResourceMonitorBase());
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            delete reactor;
+        }
+        _reactors.clear();
+    }
+
     /* static */ ResourceMonitor& ResourceMonitor::Instance()
     {
         // Tests build/destroy the ResourceMonitor for each test. In production the
@@ -37,5 +54,140 @@ namespace Core {
         return (_instance);
 #endif
     }
+
+    uint32_t ResourceMonitor::Reactors(const uint8_t count)
+    {
+        uint32_t result = Core::ERROR_NONE;
+
+        _assignmentLock.Lock();
+
+        if (count != _reactors.size()) {
+
+            if ((count == 0) || (_sealed == true)) {
+                result = Core::ERROR_ILLEGAL_STATE;
+            }
+            else {
+                while (_reactors.size() > count) {
+                    delete _reactors.back();
+                    _reactors.pop_back();
+                }
+                while (_reactors.size() < count) {
+                    _reactors.push_back(new ResourceMonitorBase());
+                }
+            }
+        }
+
+        _assignmentLock.Unlock();
+
+        return (result);
+    }
+
+    uint32_t ResourceMonitor::Runs() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Runs();
+        }
+
+        return (result);
+    }
+
+    bool ResourceMonitor::IsReactor(const thread_id id) const
+    {
+        ReactorList::const_iterator index(_reactors.cbegin());
+
+        while ((index != _reactors.cend()) && ((*index)->Id() != id)) {
+            index++;
+        }
+
+        return (index != _reactors.cend());
+    }
+
+    uint32_t ResourceMonitor::Count() const
+    {
+        uint32_t result = 0;
+
+        for (const ResourceMonitorBase* reactor : _reactors) {
+            result += reactor->Count();
+        }
+
+        return (result);
+    }
+
+    bool ResourceMonitor::Info(const uint32_t position, Metadata& info) const
+    {
+        uint32_t offset = position;
+        ReactorList::const_iterator index(_reactors.cbegin());
+
+        while ((index != _reactors.cend()) && (offset >= (*index)->Count())) {
+            offset -= (*index)->Count();
+            index++;
+        }
+
+        return ((index != _reactors.cend()) && ((*index)->Info(offset, info) == true));
+    }
+
+    void ResourceMonitor::Register(IResource& resource)
+    {
+        uint8_t reactor = 0;
+
+        _assignmentLock.Lock();
+
+        // No more changes to the reactors from here on.
+        _sealed = true;
+
+        if (_reactors.size() > 1) {
+            IResource::handle descriptor = resource.Descriptor();
+
+            ASSERT(descriptor != IResource::INVALID);
+
+            reactor = Select(descriptor);
+
+            // Remember where it went, the descriptor might already be gone on Unregister.
+            _assignments[&resource] = reactor;
+        }
+
+        _assignmentLock.Unlock();
+
+        _reactors[reactor]->Register(resource);
+    }
+
+    void ResourceMonitor::Unregister(IResource& resource)
+    {
+        if (_reactors.size() == 1) {
+            _reactors[0]->Unregister(resource);
+        }
+        else {
+            bool found = false;
+            uint8_t reactor = 0;
+
+            _assignmentLock.Lock();
+
+            Assignments::iterator index(_assignments.find(&resource));
+
+            if (index != _assignments.end()) {
+                reactor = index->second;
+                found = true;
+                _assignments.erase(index);
+            }
+
+            _assignmentLock.Unlock();
+
+            if (found == true) {
+                _reactors[reactor]->Unregister(resource);
+            }
+        }
+    }
+
+    void ResourceMonitor::Break()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            // Reactors that never had a resource assigned, have no thread to wake up.
+            if (reactor->Id() != 0) {
+                reactor->Break();
+            }
+        }
+    }
 }
 } // namespace Thunder::Core
@@ -42,6 +42,11 @@
 #include <sys/types.h>
 #endif
 
+#if defined(__CORE_RESOURCE_MONITOR_EPOLL__) && defined(__LINUX__) && !defined(__APPLE__)
+#define __RESOURCE_MONITOR_EPOLL__
+#include <sys/epoll.h>
+#endif
+
 namespace Thunder {
 
 namespace Core {
@@ -118,29 +123,50 @@ namespace Core {
         ResourceMonitorType()
             : _monitor(nullptr)
             , _adminLock()
+            #ifndef __RESOURCE_MONITOR_EPOLL__
             , _resources()
+            #endif
             , _monitorRuns(0)
             , _name(_T("Monitor::") + ClassNameOnly(typeid(RESOURCE).name()).Text())
             , _watchDog(1024 * 512, _name.c_str())
             #ifdef __WINDOWS__
             , _action(WSACreateEvent())
+            #elif defined(__RESOURCE_MONITOR_EPOLL__)
+            , _slots()
+            , _freeSlots()
+            , _lookup()
+            , _pendingLock()
+            , _pending()
+            , _sweep(false)
+            , _pollDescriptor(::epoll_create1(EPOLL_CLOEXEC))
+            , _signalDescriptor(-1)
             #else
             , _descriptorArrayLength(RESOURCE_SLOTS)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (RESOURCE_SLOTS + 1))))
             , _signalDescriptor(-1)
             #endif
         {
+            #ifdef __RESOURCE_MONITOR_EPOLL__
+            ASSERT(_pollDescriptor != -1);
+            #endif
         }
 
         ~ResourceMonitorType()
         {
             #ifdef __DEBUG__
             // All resources should be gone !!!
+            #ifdef __RESOURCE_MONITOR_EPOLL__
+            for (const auto& slot : _slots) {
+                TRACE_L1("Resource name: %s", typeid(slot.resource).name());
+                ASSERT(slot.resource == nullptr);
+            }
+            #else
             for (const auto& resource : _resources) {
                 TRACE_L1("Resource name: %s", typeid(resource).name());
                 ASSERT(resource == nullptr);
             }
             #endif
+            #endif
 
             if (_monitor != nullptr) {
 
@@ -150,7 +176,14 @@ namespace Core {
 
                 _adminLock.Lock();
 
+                #ifdef __RESOURCE_MONITOR_EPOLL__
+                _lookup.clear();
+                _slots.clear();
+                _freeSlots.clear();
+                _pending.clear();
+                #else
                 _resources.clear();
+                #endif
 
                 _adminLock.Unlock();
 
@@ -158,7 +191,13 @@ namespace Core {
             }
 
             #ifdef __LINUX__
+            #ifdef __RESOURCE_MONITOR_EPOLL__
+            if (_pollDescriptor != -1) {
+                ::close(_pollDescriptor);
+            }
+            #else
             ::free(_descriptorArray);
+            #endif
             if (_signalDescriptor != -1) {
                 ::close(_signalDescriptor);
             }
@@ -183,8 +222,142 @@ namespace Core {
         }
         uint32_t Count() const 
         {
+            #ifdef __RESOURCE_MONITOR_EPOLL__
+            return (static_cast<uint32_t>(_lookup.size()));
+            #else
             return (static_cast<uint32_t>(_resources.size()));
+            #endif
         }
+        #ifdef __RESOURCE_MONITOR_EPOLL__
+        bool Info (const uint32_t position, Metadata& info) const
+        {
+            uint32_t count = position;
+
+            _adminLock.Lock();
+
+            typename Slots::const_iterator index(_slots.cbegin());
+
+            while (index != _slots.cend()) {
+                if (index->resource != nullptr) {
+                    if (count == 0) {
+                        break;
+                    }
+                    count--;
+                }
+                index++;
+            }
+
+            bool found = (index != _slots.cend());
+
+            if (found == true) {
+                info.descriptor = index->resource->Descriptor();
+                info.classname  = typeid(*(index->resource)).name();
+                info.monitor = index->events;
+                info.events  = index->revents;
+
+                char procfn[64];
+                snprintf(procfn, sizeof(procfn), "/proc/self/fd/%d", info.descriptor);
+
+                ssize_t len = readlink(procfn, info.filename, sizeof(info.filename) - 1);
+                info.filename[(len < 0 ? 0 : len)] = '\0';
+            }
+
+            _adminLock.Unlock();
+
+            return (found);
+        }
+        void Register(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            // Make sure this entry is only registered once !!!
+            if (_lookup.find(&resource) == _lookup.end()) {
+                uint32_t index;
+
+                if (_freeSlots.empty() == true) {
+                    index = static_cast<uint32_t>(_slots.size());
+                    _slots.push_back({ &resource, 0, -1, 0, 0 });
+                }
+                else {
+                    index = _freeSlots.back();
+                    _freeSlots.pop_back();
+                    _slots[index].resource = &resource;
+                    _slots[index].descriptor = -1;
+                    _slots[index].events = 0;
+                    _slots[index].revents = 0;
+                }
+
+                _lookup.emplace(&resource, index);
+
+                // The descriptor is added to the kernel set by the monitor thread, the first
+                // call to Events() has side effects that should run on that thread.
+                _pendingLock.Lock();
+                _pending.push_back(&resource);
+                _pendingLock.Unlock();
+            }
+
+            if (_monitor == nullptr) {
+                _monitor = new MonitorWorker(*this);
+                _monitorRuns = 0;
+                // Wait till we are at least initialized
+                _monitor->Wait(Thread::BLOCKED | Thread::STOPPED);
+            }
+
+            _monitor->Run();
+
+            Signal();
+
+            _adminLock.Unlock();
+        }
+        void Unregister(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            typename Lookup::iterator index(_lookup.find(&resource));
+
+            if (index != _lookup.end()) {
+                Slot& slot(_slots[index->second]);
+
+                if (slot.descriptor != -1) {
+                    // The descriptor might already be closed, in which case the kernel dropped it already.
+                    ::epoll_ctl(_pollDescriptor, EPOLL_CTL_DEL, slot.descriptor, nullptr);
+                }
+
+                Release(index->second);
+
+                _lookup.erase(index);
+
+                _pendingLock.Lock();
+                typename Resources::iterator entry(std::find(_pending.begin(), _pending.end(), &resource));
+                if (entry != _pending.end()) {
+                    _pending.erase(entry);
+                }
+                _pendingLock.Unlock();
+            }
+
+            _adminLock.Unlock();
+        }
+        inline void Break()
+        {
+            // Nobody told us who changed, re-evaluate all resources.
+            _pendingLock.Lock();
+            _sweep = true;
+            _pendingLock.Unlock();
+
+            Signal();
+        }
+        inline void Break(RESOURCE& resource)
+        {
+            // Only re-evaluate the resource that requested the attention of the monitor.
+            _pendingLock.Lock();
+            if (std::find(_pending.begin(), _pending.end(), &resource) == _pending.end()) {
+                _pending.push_back(&resource);
+            }
+            _pendingLock.Unlock();
+
+            Signal();
+        }
+        #else
         bool Info (const uint32_t position, Metadata& info) const
         {
             uint32_t count = position;
@@ -259,7 +432,18 @@ namespace Core {
 
             _adminLock.Unlock();
         }
+        inline void Break(RESOURCE& /* resource */)
+        {
+            Break();
+        }
         inline void Break()
+        {
+            Signal();
+        }
+        #endif
+
+    private:
+        inline void Signal()
         {
             ASSERT(_monitor != nullptr);
 
@@ -275,9 +459,8 @@ namespace Core {
             #elif defined(__WINDOWS__)
             ::WSASetEvent(_action);
             #endif
-        };
+        }
 
-    private:
         IS_MEMBER_AVAILABLE(Arm, hasArm);
 
         template <typename TYPE=WATCHDOG>
@@ -383,13 +566,79 @@ POP_WARNING()
 
             ASSERT(_signalDescriptor != -1);
 
+            #ifdef __RESOURCE_MONITOR_EPOLL__
+            struct epoll_event signal;
+            signal.events = EPOLLIN;
+            signal.data.u64 = SignalSlot;
+
+            if ((_signalDescriptor != -1) && (::epoll_ctl(_pollDescriptor, EPOLL_CTL_ADD, _signalDescriptor, &signal) != 0)) {
+                TRACE_L1("Error on adding the signal descriptor to the epoll set. Error %d", errno);
+                ::close(_signalDescriptor);
+                _signalDescriptor = -1;
+            }
+            #else
             _descriptorArray[0].fd = _signalDescriptor;
             _descriptorArray[0].events = POLLIN;
             _descriptorArray[0].revents = 0;
+            #endif
 
             return (_signalDescriptor != -1 ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
 
+        #ifdef __RESOURCE_MONITOR_EPOLL__
+        uint32_t Worker()
+        {
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _adminLock.Lock();
+
+            if (_lookup.empty() == true) {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+            else {
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_pollDescriptor, _eventArray, RESOURCE_SLOTS, -1);
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    if (errno != EINTR) {
+                        TRACE_L1("epoll_wait failed with error <%d>", errno);
+                    }
+                }
+                else {
+                    bool signalled = false;
+
+                    // Only the descriptors that have something to report are reported, dispatch them..
+                    for (int index = 0; index < result; index++) {
+                        if (_eventArray[index].data.u64 == SignalSlot) {
+                            /* We have a valid signal, read the info from the fd */
+                            struct signalfd_siginfo info;
+                            uint32_t VARIABLE_IS_NOT_USED bytes = read(_signalDescriptor, &info, sizeof(info));
+                            ASSERT(bytes == sizeof(info) || bytes == 0);
+                            signalled = true;
+                        }
+                        else {
+                            Dispatch(_eventArray[index].data.u64, static_cast<uint16_t>(_eventArray[index].events));
+                        }
+                    }
+
+                    if (signalled == true) {
+                        Evaluate();
+                    }
+                }
+            }
+
+            _adminLock.Unlock();
+
+            return (delay);
+        }
+        #else
+
         uint32_t Worker()
         {
             uint32_t delay = 0;
@@ -511,6 +760,7 @@ POP_WARNING()
             return (delay);
         }
         #endif
+        #endif
 
         #ifdef __WINDOWS__
         uint32_t Worker()
@@ -609,15 +859,178 @@ POP_WARNING()
         }
         #endif
 
+#ifdef __RESOURCE_MONITOR_EPOLL__
+    private:
+        // The kernel reports the slot index and its generation, a stale event of a slot
+        // that got reused in the mean time can never reach the wrong resource.
+        static constexpr uint64_t SignalSlot = ~static_cast<uint64_t>(0);
+
+        struct Slot {
+            RESOURCE* resource;
+            uint32_t generation;
+            int descriptor; // As it is in the kernel set, -1 if it is not.
+            uint16_t events;
+            uint16_t revents;
+        };
+
+        using Slots = std::vector<Slot>;
+        using Lookup = std::unordered_map<RESOURCE*, uint32_t>;
+
+        static_assert((POLLIN == EPOLLIN) && (POLLPRI == EPOLLPRI) && (POLLOUT == EPOLLOUT) && (POLLERR == EPOLLERR) && (POLLHUP == EPOLLHUP) && (POLLRDHUP == EPOLLRDHUP),
+            "The poll event flags returned by IResource::Events() are handed as is to epoll");
+
+        void Release(const uint32_t index)
+        {
+            Slot& slot(_slots[index]);
+
+            slot.resource = nullptr;
+            slot.generation++;
+            slot.descriptor = -1;
+            slot.events = 0;
+            slot.revents = 0;
+
+            _freeSlots.push_back(index);
+        }
+        void Update(RESOURCE* resource)
+        {
+            // The Handle() of the resource, might have unregistered it..
+            typename Lookup::iterator index(_lookup.find(resource));
+
+            if (index != _lookup.end()) {
+                uint32_t position = index->second;
+                uint16_t events = resource->Events();
+
+                // Events() might have caused (un)registrations, so the slots could have moved.
+                index = _lookup.find(resource);
+
+                if (index != _lookup.end()) {
+                    position = index->second;
+                    Slot& slot(_slots[position]);
+
+                    if (events == 0) {
+                        if (slot.descriptor != -1) {
+                            ::epoll_ctl(_pollDescriptor, EPOLL_CTL_DEL, slot.descriptor, nullptr);
+                        }
+                        Release(position);
+                        _lookup.erase(index);
+                    }
+                    else {
+                        const int descriptor = resource->Descriptor();
+                        struct epoll_event info;
+                        int result;
+
+                        // Oneshot, the descriptor is rearmed once the resource has been handled and reported its new interest.
+                        info.events = events | EPOLLONESHOT;
+                        info.data.u64 = (static_cast<uint64_t>(slot.generation) << 32) | position;
+
+                        if ((slot.descriptor != -1) && (slot.descriptor != descriptor)) {
+                            // The resource moved to another descriptor (a listening channel that got accepted).
+                            ::epoll_ctl(_pollDescriptor, EPOLL_CTL_DEL, slot.descriptor, nullptr);
+                            slot.descriptor = -1;
+                        }
+
+                        if (slot.descriptor == -1) {
+                            result = ::epoll_ctl(_pollDescriptor, EPOLL_CTL_ADD, descriptor, &info);
+                        }
+                        else if (((result = ::epoll_ctl(_pollDescriptor, EPOLL_CTL_MOD, descriptor, &info)) != 0) && (errno == ENOENT)) {
+                            // Closed and reopened under the same number, the kernel dropped it from the set.
+                            result = ::epoll_ctl(_pollDescriptor, EPOLL_CTL_ADD, descriptor, &info);
+                        }
+
+                        if (result != 0) {
+                            TRACE_L1("epoll_ctl failed for descriptor %d with error <%d>", descriptor, errno);
+                        }
+
+                        slot.descriptor = (result == 0 ? descriptor : -1);
+                        slot.events = events;
+                    }
+                }
+            }
+        }
+        void Dispatch(const uint64_t tag, const uint16_t flagsSet)
+        {
+            uint32_t position = static_cast<uint32_t>(tag & 0xFFFFFFFF);
+
+            if (position < _slots.size()) {
+                Slot& slot(_slots[position]);
+
+                // The entry might have been removed from observing in the mean time...
+                if ((slot.resource != nullptr) && (slot.generation == static_cast<uint32_t>(tag >> 32))) {
+                    RESOURCE* entry = slot.resource;
+
+                    slot.revents = flagsSet;
+
+                    Arm();
+
+                    entry->Handle(flagsSet);
+
+                    Reset();
+
+                    Update(entry);
+                }
+            }
+        }
+        void Evaluate()
+        {
+            Resources pending;
+
+            _pendingLock.Lock();
+            bool sweep = _sweep;
+            _sweep = false;
+            pending.swap(_pending);
+            _pendingLock.Unlock();
+
+            if (sweep == true) {
+                pending.clear();
+                pending.reserve(_lookup.size());
+
+                for (const Slot& slot : _slots) {
+                    if (slot.resource != nullptr) {
+                        pending.push_back(slot.resource);
+                    }
+                }
+            }
+
+            for (RESOURCE* entry : pending) {
+                typename Lookup::iterator index(_lookup.find(entry));
+
+                if (index != _lookup.end()) {
+                    if (_slots[index->second].events != 0) {
+                        Arm();
+
+                        // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
+                        entry->Handle(0);
+
+                        Reset();
+                    }
+
+                    Update(entry);
+                }
+            }
+        }
+#endif
+
     private:
         MonitorWorker* _monitor;
         mutable Core::CriticalSection _adminLock;
+        #ifndef __RESOURCE_MONITOR_EPOLL__
         Resources _resources;
+        #endif
         uint32_t _monitorRuns;
         string _name;
         WATCHDOG _watchDog;
 
-        #ifdef __LINUX__
+        #ifdef __RESOURCE_MONITOR_EPOLL__
+        Slots _slots;
+        std::vector<uint32_t> _freeSlots;
+        Lookup _lookup;
+        Core::CriticalSection _pendingLock;
+        Resources _pending;
+        bool _sweep;
+        int _pollDescriptor;
+        int _signalDescriptor;
+        struct epoll_event _eventArray[RESOURCE_SLOTS];
+        #elif defined(__LINUX__)
         uint32_t _descriptorArrayLength;
         struct ::pollfd* _descriptorArray;
         int _signalDescriptor;
@@ -656,13 +1069,21 @@ POP_WARNING()
     using ResourceMonitorBase = ResourceMonitorType<IResource, Void, 0, 32>;
     #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor distributes the resources over a number of reactors (ResourceMonitorBase
+    // instances, each with its own thread). A resource is pinned to a reactor based on its descriptor
+    // at registration, so all events of a single resource are handled in order, by the same thread.
+    class EXTERNAL ResourceMonitor {
     private:
         friend SingletonType<ResourceMonitor>;
 
-        ResourceMonitor() = default;
+        using ReactorList = std::vector<ResourceMonitorBase*>;
+        using Assignments = std::unordered_map<const IResource*, uint8_t>;
+
+        ResourceMonitor();
 
     public:
+        using Metadata = ResourceMonitorBase::Metadata;
+
         ResourceMonitor(ResourceMonitor&&) = delete;
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(ResourceMonitor&&) = delete;
@@ -670,7 +1091,72 @@ POP_WARNING()
 
         static ResourceMonitor& Instance();
 
-        ~ResourceMonitor() = default;
+        ~ResourceMonitor();
+
+    public:
+        // The number of reactors can only be changed before the first resource is registered,
+        // from then on the set of reactors is read without taking a lock.
+        uint32_t Reactors(const uint8_t count);
+        uint8_t Reactors() const
+        {
+            return (static_cast<uint8_t>(_reactors.size()));
+        }
+        const TCHAR* Name() const
+        {
+            return (_reactors[0]->Name());
+        }
+        uint32_t Runs() const;
+        uint32_t Runs(const uint8_t index) const
+        {
+            ASSERT(index < _reactors.size());
+            return (_reactors[index]->Runs());
+        }
+        thread_id Id(const uint8_t index = 0) const
+        {
+            ASSERT(index < _reactors.size());
+            return (_reactors[index]->Id());
+        }
+        bool IsReactor(const thread_id id) const;
+        uint32_t Count() const;
+        uint32_t Count(const uint8_t index) const
+        {
+            ASSERT(index < _reactors.size());
+            return (_reactors[index]->Count());
+        }
+        bool Info(const uint32_t position, Metadata& info) const;
+        void Register(IResource& resource);
+        void Unregister(IResource& resource);
+        void Break();
+        void Break(IResource& resource)
+        {
+            if (_reactors.size() == 1) {
+                _reactors[0]->Break(resource);
+            }
+            else {
+                // Where it was registered, the descriptor might have changed or be gone by now.
+                _assignmentLock.Lock();
+                Assignments::const_iterator index(_assignments.find(&resource));
+                const bool found = (index != _assignments.cend());
+                const uint8_t reactor = (found == true ? index->second : 0);
+                _assignmentLock.Unlock();
+
+                if (found == true) {
+                    _reactors[reactor]->Break(resource);
+                }
+            }
+        }
+
+    private:
+        uint8_t Select(const IResource::handle descriptor) const
+        {
+            return (static_cast<uint8_t>(static_cast<uint32_t>(descriptor) % _reactors.size()));
+        }
+
+    private:
+        ReactorList _reactors;
+        mutable Core::CriticalSection _assignmentLock;
+        Assignments _assignments;
+        bool _sealed;
     };
 }
 } // namespace Thunder::Core
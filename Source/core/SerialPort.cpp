@@ -614,7 +614,7 @@ namespace Core {
             // subscribtion.
             _state |= SerialPort::EXCEPTION;
             _state &= ~SerialPort::OPEN;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Break(*this);
         } 
 #endif
 
@@ -646,7 +646,7 @@ namespace Core {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (_state != 0)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_POLLING_TIME ? SLEEPSLOT_POLLING_TIME : waiting);
 
@@ -680,7 +680,7 @@ namespace Core {
 #else
     if ((_state & (SerialPort::OPEN | SerialPort::EXCEPTION | SerialPort::WRITESLOT)) == SerialPort::OPEN) {
         _state |= SerialPort::WRITESLOT;
-        ResourceMonitor::Instance().Break();
+        ResourceMonitor::Instance().Break(*this);
     }
 #endif
 
@@ -735,7 +735,7 @@ void SerialPort::Write(const uint16_t writtenBytes)
 
     do {
         if (_sendOffset == _sendBytes) {
-            _sendBytes = SendData(_sendBuffer, _sendBufferSize);
+            _sendBytes = static_cast<uint16_t>(SendData(_sendBuffer, static_cast<uint32_t>(_sendBufferSize)));
             _sendOffset = 0;
         }
 
@@ -772,7 +772,7 @@ void SerialPort::Read(const uint16_t readBytes)
     _adminLock.Lock();
 
     if (readBytes > 0) {
-        uint16_t handledBytes = ReceiveData(_receiveBuffer, _readBytes + readBytes);
+        uint16_t handledBytes = static_cast<uint16_t>(ReceiveData(_receiveBuffer, static_cast<uint32_t>(_readBytes + readBytes)));
 
         ASSERT((_readBytes + readBytes) >= handledBytes);
 
@@ -815,7 +815,7 @@ void SerialPort::Read(const uint16_t readBytes)
         }
 
         if (_readBytes != 0) {
-            uint16_t handledBytes = ReceiveData(_receiveBuffer, _readBytes);
+            uint16_t handledBytes = static_cast<uint16_t>(ReceiveData(_receiveBuffer, static_cast<uint32_t>(_readBytes)));
 
             ASSERT(_readBytes >= handledBytes);
 
@@ -841,7 +841,7 @@ void SerialPort::Read(const uint16_t readBytes)
 
             do {
                 if (_sendOffset == _sendBytes) {
-                    _sendBytes = SendData(_sendBuffer, _sendBufferSize);
+                    _sendBytes = static_cast<uint16_t>(SendData(_sendBuffer, static_cast<uint32_t>(_sendBufferSize)));
                     _sendOffset = 0;
                 }
 
@@ -891,7 +891,7 @@ void SerialPort::Read(const uint16_t readBytes)
                     _readBytes += size;
 
                     if (_readBytes != 0) {
-                        uint16_t handledBytes = ReceiveData(_receiveBuffer, _readBytes);
+                        uint16_t handledBytes = static_cast<uint16_t>(ReceiveData(_receiveBuffer, static_cast<uint32_t>(_readBytes)));
 
                         ASSERT(_readBytes >= handledBytes);
 
@@ -208,9 +208,29 @@ namespace Core {
         uint32_t Close(uint32_t waitTime);
         void Trigger();
 
-        // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        // Methods to extract and insert data into the port buffers. Implement the pair taking
+        // 32 bits lengths, like on a SocketPort. The pair taking 16 bits lengths is deprecated.
+        // The buffers of a serial port never exceed 64KB.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            ASSERT(maxSendSize <= 0xFFFF);
+            return (SendData(dataFrame, static_cast<uint16_t>(maxSendSize)));
+        }
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            ASSERT(receivedSize <= 0xFFFF);
+            return (ReceiveData(dataFrame, static_cast<uint16_t>(receivedSize)));
+        }
+POP_WARNING()
+        DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+        }
+        DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+        }
         virtual void StateChange() = 0;
 
         uint32_t Configuration(
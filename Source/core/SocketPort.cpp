@@ -30,6 +30,7 @@
 #ifdef __POSIX__
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 #include <net/if.h>
 #define __ERRORRESULT__ errno
 #define __ERROR_AGAIN__ EAGAIN
@@ -46,6 +47,7 @@
 #elif defined(__LINUX__)
 #include <signal.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
 #include <sys/signalfd.h>
 #ifdef SYSTEMD_FOUND
 #include <systemd/sd-daemon.h>
@@ -323,8 +325,8 @@ namespace Thunder {
             const enumType socketType,
             const NodeId& refLocalNode,
             const NodeId& refRemoteNode,
-            const uint16_t nSendBufferSize,
-            const uint16_t nReceiveBufferSize)
+            const uint32_t nSendBufferSize,
+            const uint32_t nReceiveBufferSize)
             : SocketPort(socketType, refLocalNode, refRemoteNode, nSendBufferSize, nReceiveBufferSize, nSendBufferSize, nReceiveBufferSize)
         {
         }
@@ -333,8 +335,8 @@ namespace Thunder {
             const enumType socketType,
             const NodeId& refLocalNode,
             const NodeId& refremoteNode,
-            const uint16_t nSendBufferSize,
-            const uint16_t nReceiveBufferSize,
+            const uint32_t nSendBufferSize,
+            const uint32_t nReceiveBufferSize,
             const uint32_t nSocketSendBufferSize,
             const uint32_t nSocketReceiveBufferSize)
             : m_LocalNode(refLocalNode)
@@ -353,6 +355,11 @@ namespace Thunder {
             , m_ReadBytes(0)
             , m_SendBytes(0)
             , m_SendOffset(0)
+            , m_Payload(nullptr)
+            , m_PayloadLength(0)
+            , m_File(INVALID_HANDLE_VALUE)
+            , m_FileOffset(0)
+            , m_FileLength(0)
             , m_Interface(~0)
             , m_SystemdSocket(false)
         {
@@ -363,8 +370,8 @@ namespace Thunder {
             const enumType socketType,
             const SOCKET& refConnector,
             const NodeId& remoteNode,
-            const uint16_t nSendBufferSize,
-            const uint16_t nReceiveBufferSize)
+            const uint32_t nSendBufferSize,
+            const uint32_t nReceiveBufferSize)
             : SocketPort(socketType, refConnector, remoteNode, nSendBufferSize, nReceiveBufferSize, nSendBufferSize, nReceiveBufferSize)
         {
         }
@@ -373,8 +380,8 @@ namespace Thunder {
             const enumType socketType,
             const SOCKET& refConnector,
             const NodeId& remoteNode,
-            const uint16_t nSendBufferSize,
-            const uint16_t nReceiveBufferSize,
+            const uint32_t nSendBufferSize,
+            const uint32_t nReceiveBufferSize,
             const uint32_t nSocketSendBufferSize,
             const uint32_t nSocketReceiveBufferSize)
             : m_LocalNode(remoteNode.AnyInterface())
@@ -393,6 +400,11 @@ namespace Thunder {
             , m_ReadBytes(0)
             , m_SendBytes(0)
             , m_SendOffset(0)
+            , m_Payload(nullptr)
+            , m_PayloadLength(0)
+            , m_File(INVALID_HANDLE_VALUE)
+            , m_FileOffset(0)
+            , m_FileLength(0)
             , m_Interface(~0)
             , m_SystemdSocket(false)
         {
@@ -494,6 +506,8 @@ namespace Thunder {
             m_ReadBytes = 0;
             m_SendBytes = 0;
             m_SendOffset = 0;
+            m_PayloadLength = 0;
+            m_FileLength = 0;
 
             if ((m_State.load(Core::memory_order::memory_order_relaxed) & (SocketPort::LINK | SocketPort::OPEN | SocketPort::MONITOR)) == (SocketPort::LINK | SocketPort::OPEN)) {
 
@@ -628,7 +642,7 @@ namespace Thunder {
 #endif
                     }
 
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Break(*this);
                 } else {
                     TRACE_L3("Socket is already closed or being closed");
                 }
@@ -642,7 +656,7 @@ namespace Thunder {
 
                         // We probably did not get a response from the otherside on the close
                         // sloppy but let's forcefully close it
-                        ResourceMonitor::Instance().Break();
+                        ResourceMonitor::Instance().Break(*this);
 
                         closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -665,7 +679,7 @@ namespace Thunder {
             if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
                 m_State |= SocketPort::WRITESLOT;
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Break(*this);
             }
             m_syncAdmin.Unlock();
         }
@@ -706,7 +720,7 @@ namespace Thunder {
 
             if (m_ReceiveBufferSize == static_cast<uint16_t>(~0)) {
                 if (m_SocketReceiveBufferSize < 0xFFFF) {
-                    m_ReceiveBufferSize = static_cast<uint16_t>(m_SocketReceiveBufferSize);
+                    m_ReceiveBufferSize = m_SocketReceiveBufferSize;
                 }
 
                 TRACE_L2("Chosen user receive buffer size (%u)", m_ReceiveBufferSize);
@@ -728,7 +742,7 @@ namespace Thunder {
 
             if (m_SendBufferSize == static_cast<uint16_t>(~0)) {
                 if (m_SocketSendBufferSize < 0xFFFF) {
-                    m_SendBufferSize = static_cast<uint16_t>(m_SocketSendBufferSize);
+                    m_SendBufferSize = m_SocketSendBufferSize;
                 }
 
                 TRACE_L2("Chosen user send buffer size (%u)", m_SendBufferSize);
@@ -940,7 +954,7 @@ namespace Thunder {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (IsOpen() == false)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_POLLING_TIME ? SLEEPSLOT_POLLING_TIME : waiting);
 
@@ -975,7 +989,7 @@ namespace Thunder {
                     break;
                 }
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_POLLING_TIME ? SLEEPSLOT_POLLING_TIME : waiting);
 
@@ -1003,7 +1017,7 @@ namespace Thunder {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (IsClosed() == false)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().IsReactor(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_POLLING_TIME ? SLEEPSLOT_POLLING_TIME : waiting);
 
@@ -1144,14 +1158,130 @@ namespace Thunder {
             }
         }
 
-        /* virtual */ int32_t SocketPort::Read(uint8_t buffer[], const uint16_t length) const {
+        /* virtual */ int32_t SocketPort::Read(uint8_t buffer[], const uint32_t length) const {
             return (::recv(m_Socket, reinterpret_cast<char*>(buffer), length, 0));
         }
 
-        /* virtual */ int32_t SocketPort::Write(const uint8_t buffer[], const uint16_t length) {
+        /* virtual */ int32_t SocketPort::Write(const uint8_t buffer[], const uint32_t length) {
             return (::send(m_Socket, reinterpret_cast<const char*>(buffer), length, 0));
         }
 
+        /* virtual */ int32_t SocketPort::Write(const uint8_t buffer[], const uint32_t length, const uint8_t payload[], const uint32_t payloadLength) {
+#ifdef __WINDOWS__
+            WSABUF segments[2];
+            DWORD sent = 0;
+
+            segments[0].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(buffer));
+            segments[0].len = length;
+            segments[1].buf = reinterpret_cast<CHAR*>(const_cast<uint8_t*>(payload));
+            segments[1].len = payloadLength;
+
+            return (::WSASend(m_Socket, segments, 2, &sent, 0, nullptr, nullptr) == 0 ? static_cast<int32_t>(sent) : -1);
+#else
+            struct iovec segments[2];
+
+            segments[0].iov_base = const_cast<uint8_t*>(buffer);
+            segments[0].iov_len = length;
+            segments[1].iov_base = const_cast<uint8_t*>(payload);
+            segments[1].iov_len = payloadLength;
+
+            return (::writev(m_Socket, segments, 2));
+#endif
+        }
+
+        void SocketPort::Gather(const uint8_t payload[], const uint32_t length)
+        {
+            ASSERT((m_State & SocketPort::LINK) != 0);
+            ASSERT(m_PayloadLength == 0);
+
+            m_Payload = payload;
+            m_PayloadLength = length;
+        }
+
+        bool SocketPort::Splice(const File::Handle file, const uint64_t offset, const uint32_t length)
+        {
+            ASSERT((m_State & SocketPort::LINK) != 0);
+            ASSERT((m_PayloadLength == 0) && (m_FileLength == 0));
+
+#ifdef __LINUX__
+            const bool supported = true;
+#else
+            const bool supported = false;
+#endif
+
+            if (supported == true) {
+                m_File = file;
+                m_FileOffset = offset;
+                m_FileLength = length;
+            }
+
+            return (supported);
+        }
+
+        int32_t SocketPort::Transmit()
+        {
+            int32_t result = -1;
+
+#ifdef __LINUX__
+            if (m_SendOffset != m_SendBytes) {
+                // More is coming from the file, so the buffered bytes may share a segment with it.
+                result = static_cast<int32_t>(::send(m_Socket, &(m_SendBuffer[m_SendOffset]), m_SendBytes - m_SendOffset, MSG_MORE));
+            }
+            else {
+                off_t offset = static_cast<off_t>(m_FileOffset);
+
+                result = static_cast<int32_t>(::sendfile(m_Socket, m_File, &offset, std::min(m_FileLength, static_cast<uint32_t>(0x40000000))));
+
+                if (result == 0) {
+                    // The file got shorter than announced, the rest will never come.
+                    errno = EIO;
+                    result = -1;
+                }
+            }
+#else
+            ASSERT(false);
+#endif
+
+            return (result);
+        }
+
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        /* virtual */ uint32_t SocketPort::SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            // Only gets here if the deprecated 16 bits SendData is the one implemented.
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t loaded;
+
+            do {
+                window = static_cast<uint16_t>(std::min(maxSendSize - result, static_cast<uint32_t>(0xFFFF)));
+                loaded = SendData(&(dataFrame[result]), window);
+                result += loaded;
+
+                // A gathered payload or spliced file goes out right after what is in the buffer now.
+            } while ((loaded == window) && (result < maxSendSize) && (m_PayloadLength == 0) && (m_FileLength == 0));
+
+            return (result);
+        }
+
+        /* virtual */ uint32_t SocketPort::ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            // Only gets here if the deprecated 16 bits ReceiveData is the one implemented.
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t handled;
+
+            do {
+                window = static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF)));
+                handled = ReceiveData(&(dataFrame[result]), window);
+                result += handled;
+
+            } while ((handled == window) && (result < receivedSize));
+
+            return (result);
+        }
+POP_WARNING()
+
         void SocketPort::Write()
         {
             bool dataLeftToSend = true;
@@ -1161,10 +1291,10 @@ namespace Thunder {
             m_State &= (~(SocketPort::WRITE | SocketPort::WRITESLOT));
 
             while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
-                if (m_SendOffset == m_SendBytes) {
+                if ((m_SendOffset == m_SendBytes) && (m_PayloadLength == 0) && (m_FileLength == 0)) {
                     m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
                     m_SendOffset = 0;
-                    dataLeftToSend = (m_SendOffset != m_SendBytes);
+                    dataLeftToSend = ((m_SendOffset != m_SendBytes) || (m_PayloadLength != 0) || (m_FileLength != 0));
 
                     ASSERT(m_SendBytes <= m_SendBufferSize);
                 }
@@ -1184,12 +1314,42 @@ namespace Thunder {
                             m_RemoteNode.Size());
 
                     }
+                    else if (m_PayloadLength != 0) {
+                        sendSize = Write(&(m_SendBuffer[m_SendOffset]), m_SendBytes - m_SendOffset, m_Payload, m_PayloadLength);
+                    }
+                    else if (m_FileLength != 0) {
+                        sendSize = Transmit();
+                    }
                     else {
                         sendSize = Write(&(m_SendBuffer[m_SendOffset]), m_SendBytes - m_SendOffset);
                     }
 
                     if (sendSize >= 0) {
-                        m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
+                        if ((m_State & SocketPort::LINK) == 0) {
+                            m_SendOffset = m_SendBytes;
+                        }
+                        else {
+                            uint32_t buffered = std::min(static_cast<uint32_t>(sendSize), m_SendBytes - m_SendOffset);
+
+                            m_SendOffset += buffered;
+
+                            if (buffered != static_cast<uint32_t>(sendSize)) {
+                                const uint32_t remainder = (static_cast<uint32_t>(sendSize) - buffered);
+
+                                if (m_PayloadLength != 0) {
+                                    ASSERT(remainder <= m_PayloadLength);
+
+                                    m_Payload += remainder;
+                                    m_PayloadLength -= remainder;
+                                }
+                                else {
+                                    ASSERT(remainder <= m_FileLength);
+
+                                    m_FileOffset += remainder;
+                                    m_FileLength -= remainder;
+                                }
+                            }
+                        }
                     }
                     else {
                         uint32_t l_Result = __ERRORRESULT__;
@@ -1263,7 +1423,7 @@ namespace Thunder {
                 }
 
                 if (m_ReadBytes != 0) {
-                    uint16_t handledBytes = ReceiveData(m_ReceiveBuffer, m_ReadBytes);
+                    uint32_t handledBytes = ReceiveData(m_ReceiveBuffer, m_ReadBytes);
 
                     ASSERT(m_ReadBytes >= handledBytes);
 
@@ -25,6 +25,7 @@
 #define __SOCKETPORT_H
 
 #include "Module.h"
+#include "FileSystem.h"
 #include "NodeId.h"
 #include "Portability.h"
 #include "ResourceMonitor.h"
@@ -85,28 +86,28 @@ namespace Thunder {
             SocketPort(const enumType socketType,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize);
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize);
 
             SocketPort(const enumType socketType,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize);
 
             SocketPort(const enumType socketType,
                 const SOCKET& connector,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize);
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize);
 
             SocketPort(const enumType socketType,
                 const SOCKET& connector,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize);
 
@@ -193,11 +194,11 @@ namespace Thunder {
             inline uint32_t ReceivedInterface() const {
                 return (m_Interface);
             }
-            inline uint16_t SendBufferSize() const
+            inline uint32_t SendBufferSize() const
             {
                 return (m_SendBufferSize);
             }
-            inline uint16_t ReceiveBufferSize() const
+            inline uint32_t ReceiveBufferSize() const
             {
                 return (m_ReceiveBufferSize);
             }
@@ -215,6 +216,8 @@ namespace Thunder {
                 m_ReadBytes = 0;
                 m_SendBytes = 0;
                 m_SendOffset = 0;
+                m_PayloadLength = 0;
+                m_FileLength = 0;
                 m_syncAdmin.Unlock();
             }
 
@@ -235,13 +238,34 @@ namespace Thunder {
             uint32_t Close(const uint32_t waitTime);
             void Trigger();
 
-            // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+            // Methods to extract and insert data into the socket buffers. Implement the pair taking
+            // 32 bits lengths. The pair taking 16 bits lengths is deprecated, if that is the one
+            // implemented, it is fed in windows of at most 64KB.
+            virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize);
+            virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize);
+            DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            {
+                return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+            }
+            DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            {
+                return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+            }
 
             // Signal a state change, Opened, Closed or Accepted
             virtual void StateChange() = 0;
 
+            // Only to be called from SendData on a connected socket. The payload is written to the
+            // socket straight from the given memory, after the bytes SendData put in the dataFrame.
+            // It must remain valid until the next call to SendData.
+            void Gather(const uint8_t payload[], const uint32_t length);
+
+            // Only to be called from SendData on a connected socket. The given part of the file is sent
+            // by the kernel, after the bytes SendData put in the dataFrame, without copying it through
+            // user space. The file must remain open until the next call to SendData. Returns false if
+            // the platform can not do this, the content must then be passed through SendData.
+            bool Splice(const File::Handle file, const uint64_t offset, const uint32_t length);
+
             // In case of a single connection should be accepted, these methods help
             // changing the socket from a Listening socket to a connected socket and
             // back in case the socket closes.
@@ -257,8 +281,18 @@ namespace Thunder {
 
         protected:
             virtual uint32_t Initialize();
-            virtual int32_t Read(uint8_t buffer[], const uint16_t length) const;
-            virtual int32_t Write(const uint8_t buffer[], const uint16_t length);
+            virtual int32_t Read(uint8_t buffer[], const uint32_t length) const;
+            virtual int32_t Write(const uint8_t buffer[], const uint32_t length);
+            // The lengths are 32 bits wide now, override the methods above.
+            DEPRECATED int32_t Read(uint8_t buffer[], const uint16_t length) const
+            {
+                return (Read(buffer, static_cast<uint32_t>(length)));
+            }
+            DEPRECATED int32_t Write(const uint8_t buffer[], const uint16_t length)
+            {
+                return (Write(buffer, static_cast<uint32_t>(length)));
+            }
+            virtual int32_t Write(const uint8_t buffer[], const uint32_t length, const uint8_t payload[], const uint32_t payloadLength);
             void SetError() {
                 m_State |= SocketPort::EXCEPTION;
             }
@@ -284,6 +318,7 @@ POP_WARNING()
             void Accepted();
             void Read();
             void Write();
+            int32_t Transmit();
             void BufferAlignment(SOCKET socket);
             SOCKET ConstructSocket(NodeId& localNode, const string& interfaceName);
             uint32_t WaitForOpen(const uint32_t time) const;
@@ -293,8 +328,8 @@ POP_WARNING()
         private:
             NodeId m_LocalNode;
             NodeId m_RemoteNode;
-            uint16_t m_ReceiveBufferSize;
-            uint16_t m_SendBufferSize;
+            uint32_t m_ReceiveBufferSize;
+            uint32_t m_SendBufferSize;
             uint32_t m_SocketReceiveBufferSize;
             uint32_t m_SocketSendBufferSize;
             enumType m_SocketType;
@@ -304,9 +339,14 @@ POP_WARNING()
             NodeId m_ReceivedNode;
             uint8_t* m_SendBuffer;
             uint8_t* m_ReceiveBuffer;
-            uint16_t m_ReadBytes;
-            uint16_t m_SendBytes;
-            uint16_t m_SendOffset;
+            uint32_t m_ReadBytes;
+            uint32_t m_SendBytes;
+            uint32_t m_SendOffset;
+            const uint8_t* m_Payload;
+            uint32_t m_PayloadLength;
+            File::Handle m_File;
+            uint64_t m_FileOffset;
+            uint32_t m_FileLength;
             uint32_t m_Interface;
             bool m_SystemdSocket;
         };
@@ -321,8 +361,8 @@ POP_WARNING()
             SocketStream(const bool rawSocket,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize)
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize)
                 : SocketStream(rawSocket, localNode, remoteNode, sendBufferSize, receiveBufferSize, sendBufferSize, receiveBufferSize)
             {
             }
@@ -330,8 +370,8 @@ POP_WARNING()
             SocketStream(const bool rawSocket,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize)
                 : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::STREAM), localNode, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize)
@@ -341,8 +381,8 @@ POP_WARNING()
             SocketStream(const bool rawSocket,
                 const SOCKET& connector,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize)
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize)
                 : SocketStream(rawSocket, connector, remoteNode, sendBufferSize, receiveBufferSize, sendBufferSize, receiveBufferSize)
             {
             }
@@ -350,8 +390,8 @@ POP_WARNING()
             SocketStream(const bool rawSocket,
                 const SOCKET& connector,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize)
                 : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::STREAM), connector, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize)
@@ -371,8 +411,8 @@ POP_WARNING()
             SocketDatagram(const bool rawSocket,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize)
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize)
                 : SocketDatagram(rawSocket, localNode, remoteNode, sendBufferSize, receiveBufferSize, sendBufferSize, receiveBufferSize)
             {
             }
@@ -380,8 +420,8 @@ POP_WARNING()
             SocketDatagram(const bool rawSocket,
                 const NodeId& localNode,
                 const NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize)
                 : SocketPort((rawSocket ? SocketPort::RAW : SocketPort::DATAGRAM), localNode, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize)
@@ -421,14 +461,14 @@ POP_WARNING()
                 {
                     SocketPort::LocalNode(localNode);
                 }
-                uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */) override
+                uint32_t SendData(uint8_t* /* dataFrame */, const uint32_t /* maxSendSize */) override
                 {
                     // This should not happen on this socket !!!!!
                     ASSERT(false);
 
                     return (0);
                 }
-                uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t /* receivedSize */) override
+                uint32_t ReceiveData(uint8_t* /* dataFrame */, const uint32_t /* receivedSize */) override
                 {
                     // This should not happen on this socket !!!!!
                     ASSERT(false);
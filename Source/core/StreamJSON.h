@@ -66,9 +66,9 @@ namespace Core {
 
                 return (trigger);
             }
-            inline uint16_t Serialize(uint8_t* stream, const uint16_t length) const
+            inline uint32_t Serialize(uint8_t* stream, const uint32_t length) const
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 _adminLock.Lock();
 
@@ -89,10 +89,10 @@ namespace Core {
             }
 
         private:
-            inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IElement>& source, uint8_t* stream, const uint16_t length) const {
+            inline uint32_t Serialize(const Core::ProxyType<Core::JSON::IElement>& source, uint8_t* stream, const uint32_t length) const {
                 return(source->Serialize(reinterpret_cast<char*>(stream), length, _offset));
             }
-            inline uint16_t Serialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, uint8_t* stream, const uint16_t length) const {
+            inline uint32_t Serialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, uint8_t* stream, const uint32_t length) const {
                 return(source->Serialize(stream, length, _offset));
             }
             
@@ -131,9 +131,9 @@ namespace Core {
             {
                 return (_current.IsValid() == false);
             }
-            inline uint16_t Deserialize(const uint8_t* stream, const uint16_t length)
+            inline uint32_t Deserialize(const uint8_t* stream, const uint32_t length)
             {
-                uint16_t loaded = 0;
+                uint32_t loaded = 0;
 
                 if (_current.IsValid() == false) {
                     _current = Core::ProxyType<INTERFACE>(_factory.Element(EMPTY_STRING));
@@ -151,10 +151,10 @@ namespace Core {
             }
 
         private:
-            inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IElement>& source, const uint8_t* stream, const uint16_t length) {
+            inline uint32_t Deserialize(const Core::ProxyType<Core::JSON::IElement>& source, const uint8_t* stream, const uint32_t length) {
                 return(source->Deserialize(reinterpret_cast<const char*>(stream), length, _offset));
             }
-            inline uint16_t Deserialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, const uint8_t* stream, const uint16_t length) {
+            inline uint32_t Deserialize(const Core::ProxyType<Core::JSON::IMessagePack>& source, const uint8_t* stream, const uint32_t length) {
                 return (source->Deserialize(stream, length, _offset));
             }
 
@@ -188,12 +188,12 @@ namespace Core {
 
         public:
             // Methods to extract and insert data into the socket buffers
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -280,13 +280,13 @@ POP_WARNING()
         {
             return ((_serializer.IsIdle() == true) && (_deserializer.IsIdle() == true));
         }
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
             return (_serializer.Serialize(dataFrame, maxSendSize));
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
         {
-            uint16_t handled = 0;
+            uint32_t handled = 0;
 
             do {
                 handled += _deserializer.Deserialize(&dataFrame[handled], (receivedSize - handled));
@@ -300,11 +300,11 @@ namespace Core {
             {
                 _parent.StateChange();
             }
-            virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -488,14 +488,15 @@ POP_WARNING()
         }
 
         // Methods to extract and insert data into the socket buffers
-        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _responses.Lock();
 
             if ((_current != nullptr) && (_current != reinterpret_cast<typename DATAEXCHANGE::Request*>(~0))) {
-                result = _current->Serialize(dataFrame, maxSendSize);
+                // The exchange takes at most 64KB at a time, the link comes back for the rest.
+                result = _current->Serialize(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF))));
 
                 if (result == 0) {
                     Send(*_current);
@@ -508,16 +509,25 @@ POP_WARNING()
 
             return (result);
         }
-        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData)
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData)
         {
+            uint32_t offset = 0;
+
             _responses.Lock();
 
-            if (_buffer.Deserialize(dataFrame, availableData) == true) {
-                do {
-                    if (_responses.Evaluate(_buffer) == false) {
-                        Received(_buffer);
-                    }
-                } while (_buffer.Next() == true);
+            // The exchange takes at most 64KB at a time.
+            while (offset < availableData) {
+                const uint16_t window = static_cast<uint16_t>(std::min(availableData - offset, static_cast<uint32_t>(0xFFFF)));
+
+                if (_buffer.Deserialize(&(dataFrame[offset]), window) == true) {
+                    do {
+                        if (_responses.Evaluate(_buffer) == false) {
+                            Received(_buffer);
+                        }
+                    } while (_buffer.Next() == true);
+                }
+
+                offset += window;
             }
 
             _responses.Unlock();
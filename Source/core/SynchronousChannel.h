@@ -108,21 +108,22 @@ namespace Core {
             {
                 return (_response);
             }
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
             {
-                uint16_t result = _message.Serialize(dataFrame, maxSendSize);
+                // The outbound messages serialize in frames of at most 64KB.
+                uint32_t result = _message.Serialize(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF))));
 
                 if (result == 0) {
                     _state = (_response == nullptr ? COMPLETE : INBOUND);
                 }
                 return (result);
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData)
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData)
             {
-                uint16_t result = 0;
+                uint32_t result = 0;
 
                 if (_response != nullptr) {
-                    result = _response->Deserialize(dataFrame, availableData);
+                    result = _response->Deserialize(dataFrame, static_cast<uint16_t>(std::min(availableData, static_cast<uint32_t>(0xFFFF))));
                     IInbound::state newState = _response->IsCompleted();
                     if (newState == IInbound::COMPLETED) {
                         _state = COMPLETE;
@@ -336,9 +337,9 @@ namespace Core {
         }
 
         // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -366,9 +367,9 @@ namespace Core {
 
             return (result);
         }
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t availableData) override
+        uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t availableData) override
         {
-            uint16_t result = 0;
+            uint32_t result = 0;
 
             _adminLock.Lock();
 
@@ -398,8 +399,11 @@ namespace Core {
 
             _adminLock.Unlock();
 
-            if (result < availableData) {
-                result += Deserialize(&(dataFrame[result]), availableData - result);
+            // The unsolicited messages are deserialized in frames of at most 64KB.
+            uint16_t handled = 1;
+            while ((result < availableData) && (handled != 0)) {
+                handled = Deserialize(&(dataFrame[result]), static_cast<uint16_t>(std::min(availableData - result, static_cast<uint32_t>(0xFFFF))));
+                result += handled;
             }
 
             return (result);
@@ -23,6 +23,8 @@
 #include "ResourceMonitor.h"
 #include "Number.h"
 
+#include <deque>
+
 namespace Thunder {
 
 namespace Core {
@@ -167,7 +169,11 @@ namespace Core {
         using QueueElement = ProxyType<IDispatch>;
         #endif
 
+        #ifdef __CORE_LOCKFREE_JOB_QUEUE__
+        using MessageQueue = LockFreeQueueType< QueueElement >;
+        #else
         using MessageQueue = QueueType< QueueElement >;
+        #endif
 
     public:   
         template<typename IMPLEMENTATION>
@@ -384,6 +390,11 @@ POP_WARNING()
                 , _interestCount(0)
                 , _currentRequest()
                 , _runs(0)
+                #ifdef __CORE_WORK_STEALING__
+                , _owner(0)
+                , _localLock()
+                , _local()
+                #endif
             {
                 ASSERT(dispatcher != nullptr);
             }
@@ -428,7 +439,11 @@ POP_WARNING()
             {
                 _dispatcher->Initialize();
 
-                while (_parent._queue.Extract(_currentRequest, infinite) == true) {
+                #ifdef __CORE_WORK_STEALING__
+                _owner = Thread::ThreadId();
+                #endif
+
+                while (Next() == true) {
 
                     ASSERT(_currentRequest.IsValid() == true);
 
@@ -485,9 +500,104 @@ POP_WARNING()
                     _parent.Idle();
                 }
 
+                #ifdef __CORE_WORK_STEALING__
+                _owner = 0;
+                #endif
+
                 _dispatcher->Deinitialize();
             }
 
+        private:
+            friend class ThreadPool;
+
+            bool Next()
+            {
+                #ifdef __CORE_WORK_STEALING__
+                bool result = false;
+
+                if (_parent._active == true) {
+                    // Own work first (follow-ups of what we just did), than the shared queue and
+                    // only if there is nothing there, see if someone else is overloaded.
+                    result = ((Pop() == true) || (_parent._queue.Extract(_currentRequest, 0) == true) || (_parent.Steal(*this) == true));
+
+                    if (result == false) {
+                        // Announce that we are starving before the last attempt, so new local work
+                        // is handed over through the shared queue from now on.
+                        _parent._idle++;
+                        result = ((_parent.Steal(*this) == true) || (_parent._queue.Extract(_currentRequest, infinite) == true));
+                        _parent._idle--;
+                    }
+                }
+                else {
+                    // Stopping, nothing new is taken on, but what was handed to this Minion
+                    // before, is still done. Only this Minion adds to its own queue.
+                    result = Pop();
+                }
+
+                return (result);
+                #else
+                return (_parent._queue.Extract(_currentRequest, infinite));
+                #endif
+            }
+
+            #ifdef __CORE_WORK_STEALING__
+            bool IsOwner() const {
+                return (_owner == Thread::ThreadId());
+            }
+            uint32_t Pending() const {
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                return (static_cast<uint32_t>(_local.size()));
+            }
+            void Push(const ProxyType<IDispatch>& job) {
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                _local.emplace_back(job);
+            }
+            bool Pop() {
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                bool result = (_local.empty() == false);
+                if (result == true) {
+                    // FIFO, a job that keeps resubmitting itself should not starve the others.
+                    _currentRequest = _local.front();
+                    _local.pop_front();
+                }
+                return (result);
+            }
+            bool Steal(Minion& victim) {
+                Core::SafeSyncType<Core::CriticalSection> lock(victim._localLock);
+                bool result = (victim._local.empty() == false);
+                if (result == true) {
+                    // Take the oldest job, it has been waiting the longest.
+                    _currentRequest = victim._local.front();
+                    victim._local.pop_front();
+                }
+                return (result);
+            }
+            void Share() {
+                // The job moves to the shared queue while the local lock is held, so a Revoke,
+                // that looks at the local queues before the shared one, can not miss it.
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                if (_local.empty() == false) {
+                    _parent._queue.Post(_local.back());
+                    _local.pop_back();
+                }
+            }
+            bool Remove(const ProxyType<IDispatch>& job) {
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                std::deque<QueueElement>::iterator index = std::find(_local.begin(), _local.end(), job);
+                bool result = (index != _local.end());
+                if (result == true) {
+                    _local.erase(index);
+                }
+                return (result);
+            }
+            void Visit(std::vector<string>& jobs) const {
+                Core::SafeSyncType<Core::CriticalSection> lock(_localLock);
+                for (const QueueElement& element : _local) {
+                    jobs.emplace_back(element->Identifier());
+                }
+            }
+            #endif
+
         private:
             ThreadPool& _parent;
             IDispatcher* _dispatcher;
@@ -500,6 +610,11 @@ POP_WARNING()
             ProxyType<IDispatch> _currentRequest;
             #endif
             uint32_t _runs;
+            #ifdef __CORE_WORK_STEALING__
+            std::atomic<thread_id> _owner;
+            mutable CriticalSection _localLock;
+            std::deque<QueueElement> _local;
+            #endif
         };
 
     private:
@@ -537,6 +652,9 @@ POP_WARNING()
             Minion& Me() {
                 return (_minion);
             }
+            const Minion& Me() const {
+                return (_minion);
+            }
 
         private:
             uint32_t Worker() override
@@ -556,6 +674,11 @@ POP_WARNING()
 
         ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize, IDispatcher* dispatcher, IScheduler* scheduler, Minion* external, ICallback* callback) 
             : _queue(queueSize)
+            #ifdef __CORE_WORK_STEALING__
+            , _active(true)
+            , _idle(0)
+            , _victim(0)
+            #endif
             , _scheduler(scheduler)
             #ifdef __CORE_WARNING_REPORTING__
             , _dispatchedJobMonitor(nullptr)
@@ -579,7 +702,18 @@ POP_WARNING()
             return (static_cast<uint8_t>(_units.size()));
         }
         uint32_t Pending() const {
-            return (_queue.Length());
+            uint32_t result = _queue.Length();
+
+            #ifdef __CORE_WORK_STEALING__
+            for (const Executor& unit : _units) {
+                result += unit.Me().Pending();
+            }
+            if (_external != nullptr) {
+                result += _external->Pending();
+            }
+            #endif
+
+            return (result);
         }
         void Snapshot(const uint8_t length, Metadata* entries, std::vector<string>& jobs) const
         {
@@ -599,6 +733,16 @@ POP_WARNING()
                 });
 
             _queue.Unlock();
+
+            #ifdef __CORE_WORK_STEALING__
+            // The local queues lock before the shared queue (Share), so do not visit them under its lock.
+            for (const Executor& unit : _units) {
+                unit.Me().Visit(jobs);
+            }
+            if (_external != nullptr) {
+                _external->Visit(jobs);
+            }
+            #endif
         }
         thread_id Id(const uint8_t index) const
         {
@@ -615,7 +759,10 @@ POP_WARNING()
             ASSERT(job.IsValid() == true);
             ASSERT(_queue.HasEntry(job) == false);
 
-            if (Thread::ThreadId() == ResourceMonitor::Instance().Id()) {
+            if (Local(job) == true) {
+                // Submitted from one of our own Minions, it stays with that Minion.
+            }
+            else if (ResourceMonitor::Instance().IsReactor(Thread::ThreadId()) == true) {
                 _queue.Post(job);
             }
             else {
@@ -629,7 +776,7 @@ POP_WARNING()
 
             ASSERT(job.IsValid() == true);
 
-            if (_queue.Remove(job) == true) {
+            if (Remove(job) == true) {
                 result = ERROR_NONE;
             }
             else {
@@ -656,6 +803,9 @@ POP_WARNING()
         }
         void Run()
         {
+            #ifdef __CORE_WORK_STEALING__
+            _active = true;
+            #endif
             _queue.Enable();
             std::list<Executor>::iterator index = _units.begin();
             while (index != _units.end()) {
@@ -665,6 +815,9 @@ POP_WARNING()
         }
         void Stop()
         {
+            #ifdef __CORE_WORK_STEALING__
+            _active = false;
+            #endif
             _queue.Disable();
             std::list<Executor>::iterator index = _units.begin();
             while (index != _units.end()) {
@@ -707,6 +860,10 @@ POP_WARNING()
                     bool idle = (index == _units.end());
                     _queue.Unlock();
 
+                    #ifdef __CORE_WORK_STEALING__
+                    idle = idle && (Pending() == 0);
+                    #endif
+
                     if (idle == true) {
                         // There is nothing to process, we are idle, going into Idle mode...
                         _callback->Idle();
@@ -720,7 +877,9 @@ POP_WARNING()
             ProxyType<IDispatch> resubmit = job.Resubmit(scheduleTime);
             if (resubmit.IsValid() == true) {
                 if ((scheduleTime.IsValid() == false) || (_scheduler == nullptr) || (scheduleTime < Time::Now()) ) {
-                    _queue.Post(resubmit);
+                    if (Local(resubmit) == false) {
+                        _queue.Post(resubmit);
+                    }
                 }
                 else {
                     // See if we have a hook that can process scheduled entries :-)
@@ -729,9 +888,98 @@ POP_WARNING()
             }
             _queue.Unlock();
         }
+        bool Local(VARIABLE_IS_NOT_USED const ProxyType<IDispatch>& job) {
+            bool result = false;
+
+            #ifdef __CORE_WORK_STEALING__
+            if (_active == true) {
+                Minion* minion = Current();
+
+                if (minion != nullptr) {
+                    minion->Push(job);
+
+                    if (_idle > 0) {
+                        // Someone is starving, rather have it run in parallel than wait for us.
+                        minion->Share();
+                    }
+
+                    result = true;
+                }
+            }
+            #endif
+
+            return (result);
+        }
+        bool Remove(const ProxyType<IDispatch>& job) {
+            bool result = false;
+
+            #ifdef __CORE_WORK_STEALING__
+            // Jobs only move from a local queue to the shared queue, never the other way
+            // around, so check the local ones first.
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == false) && (index != _units.end())) {
+                result = index->Me().Remove(job);
+                index++;
+            }
+            if ((result == false) && (_external != nullptr)) {
+                result = _external->Remove(job);
+            }
+            #endif
+
+            return ((result == true) || (_queue.Remove(job) == true));
+        }
+        #ifdef __CORE_WORK_STEALING__
+        Minion* Current() {
+            Minion* result = nullptr;
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == nullptr) && (index != _units.end())) {
+                if (index->Me().IsOwner() == true) {
+                    result = &(index->Me());
+                }
+                index++;
+            }
+            if ((result == nullptr) && (_external != nullptr) && (_external->IsOwner() == true)) {
+                result = _external;
+            }
+
+            return (result);
+        }
+        bool Steal(Minion& thief) {
+            bool result = false;
+            const uint32_t count = static_cast<uint32_t>(_units.size());
+
+            if (count > 0) {
+                // Do not let all thieves start with the same victim.
+                uint32_t skip = (_victim++ % count);
+                std::list<Executor>::iterator index = _units.begin();
+                while (skip-- != 0) { index++; }
+
+                for (uint32_t loop = 0; (result == false) && (loop < count); loop++) {
+                    if (&(index->Me()) != &thief) {
+                        result = thief.Steal(index->Me());
+                    }
+                    if (++index == _units.end()) {
+                        index = _units.begin();
+                    }
+                }
+            }
+            if ((result == false) && (_external != nullptr) && (_external != &thief)) {
+                result = thief.Steal(*_external);
+            }
+
+            return (result);
+        }
+        #endif
 
     private:
         MessageQueue _queue;
+        #ifdef __CORE_WORK_STEALING__
+        std::atomic<bool> _active;
+        std::atomic<uint32_t> _idle;
+        std::atomic<uint32_t> _victim;
+        #endif
         std::list<Executor> _units;
         IScheduler* _scheduler;
         #ifdef __CORE_WARNING_REPORTING__
@@ -27,6 +27,8 @@
 #include "Sync.h"
 #include "Thread.h"
 #include "Time.h"
+#include "TypeTraits.h"
+#include <unordered_map>
 #include <utility>
 
 // ---- Referenced classes and types ----
@@ -44,7 +46,495 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
 //
 namespace Thunder {
 namespace Core {
-    template <typename CONTENT>
+    // ---------------------------------------------------------------------------
+    // Pending administration of the TimerType. All entries are kept in one list,
+    // sorted on their schedule time. Scheduling and revoking are O(N).
+    // ---------------------------------------------------------------------------
+    template <typename CONTENT, typename ELEMENT>
+    class TimerListType {
+    private:
+        using Entries = std::list<ELEMENT>;
+
+    public:
+        TimerListType(TimerListType<CONTENT, ELEMENT>&&) = delete;
+        TimerListType(const TimerListType<CONTENT, ELEMENT>&) = delete;
+        TimerListType<CONTENT, ELEMENT>& operator=(TimerListType<CONTENT, ELEMENT>&&) = delete;
+        TimerListType<CONTENT, ELEMENT>& operator=(const TimerListType<CONTENT, ELEMENT>&) = delete;
+
+        TimerListType()
+            : _entries()
+        {
+        }
+        ~TimerListType() = default;
+
+    public:
+        bool IsEmpty() const
+        {
+            return (_entries.empty());
+        }
+        uint32_t Count() const
+        {
+            return (static_cast<uint32_t>(_entries.size()));
+        }
+        void Clear()
+        {
+            _entries.clear();
+        }
+        // Schedule time of the first entry, or the max value if there is none.
+        uint64_t Next() const
+        {
+            return (_entries.empty() ? NUMBER_MAX_UNSIGNED(uint64_t) : _entries.front().ScheduleTime());
+        }
+        void Insert(ELEMENT&& entry)
+        {
+            typename Entries::iterator index = _entries.begin();
+
+            while ((index != _entries.end()) && (entry.ScheduleTime() >= (*index).ScheduleTime())) {
+                ++index;
+            }
+
+            _entries.insert(index, std::move(entry));
+        }
+        uint32_t Remove(const CONTENT& info, const bool all)
+        {
+            uint32_t removed = 0;
+            typename Entries::iterator index = _entries.begin();
+
+            while (index != _entries.end()) {
+                if (*index == info) {
+                    index = _entries.erase(index);
+                    removed++;
+
+                    if (all == false) {
+                        break;
+                    }
+                } else {
+                    ++index;
+                }
+            }
+
+            return (removed);
+        }
+        bool HasEntry(const CONTENT& info) const
+        {
+            return (std::find(_entries.cbegin(), _entries.cend(), info) != _entries.cend());
+        }
+        bool IsDue(const uint64_t now)
+        {
+            return ((_entries.empty() == false) && (_entries.front().ScheduleTime() <= now));
+        }
+        // Only allowed if IsDue() reported an entry.
+        ELEMENT Extract()
+        {
+            ASSERT(_entries.empty() == false);
+
+            ELEMENT result(std::move(_entries.front()));
+            _entries.pop_front();
+
+            return (result);
+        }
+
+    private:
+        Entries _entries;
+    };
+
+    // ---------------------------------------------------------------------------
+    // Pending administration of the TimerType as a hierarchical timing wheel.
+    // The wheel counts in milliseconds and has 4 levels of 256 slots. An entry is
+    // stored at the level that matches the most significant byte in which it
+    // differs from the current tick. When the current tick passes a slot at a
+    // higher level, its entries cascade down, so scheduling and expiring are O(1).
+    // Entries beyond the reach of the wheel (49 days) are parked in an overflow
+    // list.
+    // Revoke is O(1) if the content offers a "size_t Hash() const" that is equal
+    // for equal contents. Without it, revoke is a scan, like the TimerListType.
+    // ---------------------------------------------------------------------------
+    template <typename CONTENT, typename ELEMENT>
+    class TimerWheelType {
+    private:
+        static constexpr uint8_t Levels = 4;
+        static constexpr uint8_t Bits = 8;
+        static constexpr uint16_t Slots = (1 << Bits);
+        static constexpr uint8_t Words = (Slots / 64);
+
+        struct Entry;
+        using Entries = std::list<Entry>;
+
+        struct Entry {
+            Entry(ELEMENT&& element, const uint64_t tick)
+                : Element(std::move(element))
+                , Tick(tick)
+                , Owner(nullptr)
+            {
+            }
+
+            ELEMENT Element;
+            uint64_t Tick;
+            Entries* Owner;
+        };
+
+        using Index = std::unordered_multimap<size_t, typename Entries::iterator>;
+
+        IS_MEMBER_AVAILABLE(Hash, hasHash);
+
+    public:
+        TimerWheelType(TimerWheelType<CONTENT, ELEMENT>&&) = delete;
+        TimerWheelType(const TimerWheelType<CONTENT, ELEMENT>&) = delete;
+        TimerWheelType<CONTENT, ELEMENT>& operator=(TimerWheelType<CONTENT, ELEMENT>&&) = delete;
+        TimerWheelType<CONTENT, ELEMENT>& operator=(const TimerWheelType<CONTENT, ELEMENT>&) = delete;
+
+        TimerWheelType()
+            : _current(Time::Now().Ticks() / Time::TicksPerMillisecond)
+            , _count(0)
+            , _due()
+            , _overflow()
+            , _index()
+        {
+            ::memset(_occupied, 0, sizeof(_occupied));
+        }
+        ~TimerWheelType() = default;
+
+    public:
+        bool IsEmpty() const
+        {
+            return (_count == 0);
+        }
+        uint32_t Count() const
+        {
+            return (_count);
+        }
+        void Clear()
+        {
+            for (uint8_t level = 0; level < Levels; level++) {
+                for (uint16_t slot = 0; slot < Slots; slot++) {
+                    _slots[level][slot].clear();
+                }
+            }
+            ::memset(_occupied, 0, sizeof(_occupied));
+            _due.clear();
+            _overflow.clear();
+            _index.clear();
+            _count = 0;
+        }
+        // Time at which the wheel needs attention. This is the time the first entry
+        // is due or, if that is still at a higher level, the moment it cascades down.
+        uint64_t Next() const
+        {
+            uint64_t result = NUMBER_MAX_UNSIGNED(uint64_t);
+
+            if (_due.empty() == false) {
+                result = 0;
+            } else if (_count != 0) {
+                result = Upcoming() * Time::TicksPerMillisecond;
+            }
+
+            return (result);
+        }
+        void Insert(ELEMENT&& entry)
+        {
+            // Round up, an entry should never fire before its time.
+            const uint64_t tick = ((entry.ScheduleTime() + Time::TicksPerMillisecond - 1) / Time::TicksPerMillisecond);
+            Entries* list = Locate(tick);
+
+            list->emplace_back(std::move(entry), tick);
+
+            typename Entries::iterator index = std::prev(list->end());
+            index->Owner = list;
+
+            Track(index);
+
+            _count++;
+        }
+        uint32_t Remove(const CONTENT& info, const bool all)
+        {
+            uint32_t removed = 0;
+
+            Find(info, [&](typename Entries::iterator index) -> bool {
+                Untrack(index);
+                Erase(index);
+                removed++;
+                return (all == false);
+            });
+
+            return (removed);
+        }
+        bool HasEntry(const CONTENT& info) const
+        {
+            bool found = false;
+
+            const_cast<TimerWheelType<CONTENT, ELEMENT>*>(this)->Find(info, [&](typename Entries::iterator) -> bool {
+                found = true;
+                return (true);
+            });
+
+            return (found);
+        }
+        bool IsDue(const uint64_t now)
+        {
+            if (_due.empty() == true) {
+                Advance(now / Time::TicksPerMillisecond);
+            }
+
+            return (_due.empty() == false);
+        }
+        // Only allowed if IsDue() reported an entry.
+        ELEMENT Extract()
+        {
+            ASSERT(_due.empty() == false);
+
+            typename Entries::iterator index = _due.begin();
+
+            Untrack(index);
+            ELEMENT result(std::move(index->Element));
+            _due.erase(index);
+            _count--;
+
+            return (result);
+        }
+
+    private:
+        static uint8_t Lowest(const uint64_t value)
+        {
+            ASSERT(value != 0);
+        #ifdef __GNUC__
+            return (static_cast<uint8_t>(__builtin_ctzll(value)));
+        #else
+            uint8_t result = 0;
+            while ((value & (1ULL << result)) == 0) {
+                result++;
+            }
+            return (result);
+        #endif
+        }
+        static uint16_t Position(const uint64_t tick, const uint8_t level)
+        {
+            return (static_cast<uint16_t>((tick >> (Bits * level)) & (Slots - 1)));
+        }
+        Entries* Locate(const uint64_t tick)
+        {
+            Entries* result = &_overflow;
+
+            if (tick <= _current) {
+                result = &_due;
+            } else {
+                const uint64_t difference = (tick ^ _current);
+                uint8_t level = 0;
+
+                while ((level < Levels) && ((difference >> (Bits * (level + 1))) != 0)) {
+                    level++;
+                }
+
+                if (level < Levels) {
+                    const uint16_t slot = Position(tick, level);
+
+                    _occupied[level][slot / 64] |= (1ULL << (slot % 64));
+                    result = &(_slots[level][slot]);
+                }
+            }
+
+            return (result);
+        }
+        void Erase(typename Entries::iterator index)
+        {
+            Entries* owner = index->Owner;
+
+            owner->erase(index);
+            _count--;
+
+            Vacated(owner);
+        }
+        void Vacated(Entries* owner)
+        {
+            if ((owner->empty() == true) && (owner >= &(_slots[0][0])) && (owner <= &(_slots[Levels - 1][Slots - 1]))) {
+                const uint32_t offset = static_cast<uint32_t>(owner - &(_slots[0][0]));
+                const uint16_t slot = (offset % Slots);
+
+                _occupied[offset / Slots][slot / 64] &= ~(1ULL << (slot % 64));
+            }
+        }
+        void Move(Entries& source)
+        {
+            // Entries may land in the list they come from (overflow), so detach them first.
+            Entries moving;
+            moving.splice(moving.end(), source);
+
+            while (moving.empty() == false) {
+                Entries* destination = Locate(moving.front().Tick);
+
+                destination->splice(destination->end(), moving, moving.begin());
+                destination->back().Owner = destination;
+            }
+        }
+        // The first tick, after the current one, at which a slot needs to be handled.
+        uint64_t Upcoming() const
+        {
+            uint64_t result = NUMBER_MAX_UNSIGNED(uint64_t);
+            uint8_t level = 0;
+
+            while ((level < Levels) && (result == NUMBER_MAX_UNSIGNED(uint64_t))) {
+                const uint16_t start = Position(_current, level) + 1;
+
+                if (start < Slots) {
+                    uint8_t word = static_cast<uint8_t>(start / 64);
+                    uint64_t bits = _occupied[level][word] & (~0ULL << (start % 64));
+
+                    while ((bits == 0) && (++word < Words)) {
+                        bits = _occupied[level][word];
+                    }
+
+                    if (bits != 0) {
+                        const uint8_t shift = (Bits * (level + 1));
+                        const uint64_t base = ((shift < 64) ? ((_current >> shift) << shift) : 0);
+
+                        result = base + (static_cast<uint64_t>((word * 64) + Lowest(bits)) << (Bits * level));
+                    }
+                }
+
+                level++;
+            }
+
+            if ((result == NUMBER_MAX_UNSIGNED(uint64_t)) && (_overflow.empty() == false)) {
+                result = ((_current >> (Bits * Levels)) + 1) << (Bits * Levels);
+            }
+
+            return (result);
+        }
+        void Advance(const uint64_t tick)
+        {
+            while (_current < tick) {
+                const uint64_t next = (_count == 0 ? NUMBER_MAX_UNSIGNED(uint64_t) : Upcoming());
+
+                if (next > tick) {
+                    // Nothing to be handled on the way.
+                    _current = tick;
+                } else {
+                    _current = next;
+
+                    // Cascade from the top, entries end up in lower levels or are due.
+                    if ((_current & ((1ULL << (Bits * Levels)) - 1)) == 0) {
+                        Move(_overflow);
+                    }
+                    for (uint8_t level = (Levels - 1); level > 0; level--) {
+                        if ((_current & ((1ULL << (Bits * level)) - 1)) == 0) {
+                            Entries& slot = _slots[level][Position(_current, level)];
+                            Move(slot);
+                            Vacated(&slot);
+                        }
+                    }
+
+                    Entries& slot = _slots[0][Position(_current, 0)];
+                    Move(slot);
+                    Vacated(&slot);
+                }
+            }
+        }
+
+        // bool action(Entries::iterator), returns true to stop looking.
+        template <typename ACTION, typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<hasHash<const TYPE, size_t>::value, void>::type
+        Find(const CONTENT& info, ACTION&& action)
+        {
+            std::pair<typename Index::iterator, typename Index::iterator> range = _index.equal_range(info.Hash());
+            typename Index::iterator index = range.first;
+            bool stop = false;
+
+            while ((stop == false) && (index != range.second)) {
+                // The action untracks the entry, step away from it first.
+                typename Entries::iterator entry = index->second;
+                ++index;
+
+                if (entry->Element == info) {
+                    stop = action(entry);
+                }
+            }
+        }
+        template <typename ACTION, typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<!hasHash<const TYPE, size_t>::value, void>::type
+        Find(const CONTENT& info, ACTION&& action)
+        {
+            bool stop = Find(_due, info, action);
+
+            for (uint8_t level = 0; (stop == false) && (level < Levels); level++) {
+                for (uint16_t slot = 0; (stop == false) && (slot < Slots); slot++) {
+                    if ((_occupied[level][slot / 64] & (1ULL << (slot % 64))) != 0) {
+                        stop = Find(_slots[level][slot], info, action);
+                    }
+                }
+            }
+
+            if (stop == false) {
+                Find(_overflow, info, action);
+            }
+        }
+        template <typename ACTION>
+        bool Find(Entries& entries, const CONTENT& info, ACTION& action)
+        {
+            bool stop = false;
+            typename Entries::iterator index = entries.begin();
+
+            while ((stop == false) && (index != entries.end())) {
+                typename Entries::iterator entry = index;
+                ++index;
+
+                if (entry->Element == info) {
+                    stop = action(entry);
+                }
+            }
+
+            return (stop);
+        }
+        template <typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<hasHash<const TYPE, size_t>::value, void>::type
+        Track(typename Entries::iterator index)
+        {
+            _index.emplace(index->Element.Content().Hash(), index);
+        }
+        template <typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<!hasHash<const TYPE, size_t>::value, void>::type
+        Track(typename Entries::iterator)
+        {
+        }
+        template <typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<hasHash<const TYPE, size_t>::value, void>::type
+        Untrack(typename Entries::iterator index)
+        {
+            std::pair<typename Index::iterator, typename Index::iterator> range = _index.equal_range(index->Element.Content().Hash());
+
+            while ((range.first != range.second) && (range.first->second != index)) {
+                ++range.first;
+            }
+
+            ASSERT(range.first != range.second);
+
+            if (range.first != range.second) {
+                _index.erase(range.first);
+            }
+        }
+        template <typename TYPE = CONTENT>
+        typename Core::TypeTraits::enable_if<!hasHash<const TYPE, size_t>::value, void>::type
+        Untrack(typename Entries::iterator)
+        {
+        }
+
+    private:
+        uint64_t _current;
+        uint32_t _count;
+        Entries _slots[Levels][Slots];
+        uint64_t _occupied[Levels][Words];
+        Entries _due;
+        Entries _overflow;
+        Index _index;
+    };
+
+#ifdef __CORE_TIMER_WHEEL__
+    template <typename CONTENT, typename ELEMENT>
+    using TimerQueueType = TimerWheelType<CONTENT, ELEMENT>;
+#else
+    template <typename CONTENT, typename ELEMENT>
+    using TimerQueueType = TimerListType<CONTENT, ELEMENT>;
+#endif
+
+    template <typename CONTENT, template <typename, typename> class PENDING = TimerQueueType>
     class TimerType {
 
     private:
@@ -150,11 +640,11 @@ namespace Core {
             }
 
         private:
-            TimerType<CONTENT>& m_Parent;
+            TimerType<CONTENT, PENDING>& m_Parent;
         };
 
         using TimeInfoBlocks = TimedInfo<CONTENT>;
-        using SubscriberList = typename std::list<TimeInfoBlocks>;
+        using SubscriberList = PENDING<CONTENT, TimeInfoBlocks>;
 
     public:
         TimerType(const TimerType&) = delete;
@@ -179,7 +669,7 @@ namespace Core {
             _timerThread.Stop();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            _pendingQueue.Clear();
 
             _adminLock.Unlock();
 
@@ -212,7 +702,7 @@ namespace Core {
             _timerThread.Block();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            _pendingQueue.Clear();
             _adminLock.Unlock();
 
             _timerThread.Wait(Thread::BLOCKED, Core::infinite);
@@ -223,14 +713,7 @@ namespace Core {
             // This needs to be atomic. Make sure it is.
             _adminLock.Lock();
 
-            typename SubscriberList::const_iterator index = _pendingQueue.cbegin();
-
-            // Clear all entries !!
-            while ((index != _pendingQueue.cend()) && (*index != element)) {
-                index++;
-            }
-
-            bool found = (index != _pendingQueue.cend());
+            bool found = _pendingQueue.HasEntry(element);
 
             // Done with the administration. Release the lock.
             _adminLock.Unlock();
@@ -257,15 +740,7 @@ namespace Core {
 
             _adminLock.Lock();
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
-
-            while ((index != _pendingQueue.end()) && ((*index).Content() != info)) {
-                ++index;
-            }
-
-            if (index != _pendingQueue.end()) {
-                _pendingQueue.erase(index);
-            }
+            _pendingQueue.Remove(info, false);
 
             if (ScheduleEntry(std::move(newEntry)) == true) {
                 _timerThread.Run();
@@ -292,24 +767,11 @@ namespace Core {
                 _adminLock.Lock();
             }
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
-
-            bool changedHead = false;
+            const uint64_t head = _pendingQueue.Next();
 
-            while (index != _pendingQueue.end()) {
-                if (index->Content() == info) {
-                    changedHead |= (index == _pendingQueue.begin());
-                    foundElement = true;
+            foundElement = (_pendingQueue.Remove(info, true) != 0);
 
-                    // Remove this... Found it, remove it.
-                    index = _pendingQueue.erase(index);
-                }
-                else {
-                    ++index;
-                }
-            }
-
-            if (changedHead == true) {
+            if ((foundElement == true) && (_pendingQueue.Next() != head)) {
                 // If we added the new time up front, retrigger the scheduler.
                 _timerThread.Run();
             }
@@ -326,7 +788,7 @@ namespace Core {
 
         uint32_t Pending() const
         {
-            return (static_cast<uint32_t>(_pendingQueue.size()));
+            return (_pendingQueue.Count());
         }
 
         thread_id ThreadId() const
@@ -346,12 +808,11 @@ namespace Core {
             // Ranging from 0-Core::infinite
             _timerThread.Block();
 
-            while ((_pendingQueue.empty() == false) && (_pendingQueue.front().ScheduleTime() <= now)) {
-                TimedInfo<CONTENT> info(std::move(_pendingQueue.front()));
+            while (_pendingQueue.IsDue(now) == true) {
+                // Make sure we loose the current one before we do the call, that one might add ;-)
+                TimedInfo<CONTENT> info(_pendingQueue.Extract());
                 _executing = &(info.Content());
 
-                // Make sure we loose the current one before we do the call, that one might add ;-)
-                _pendingQueue.pop_front();
                 _waitForCompletion.ResetEvent();
 
                 _adminLock.Unlock();
@@ -373,19 +834,20 @@ namespace Core {
             }
 
             // Calculate the delay...
-            if (_pendingQueue.empty() == true) {
+            if (_pendingQueue.IsEmpty() == true) {
                 _nextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
                 uint64_t delta = Time::Now().Ticks();
+                uint64_t next = _pendingQueue.Next();
 
-                if (delta >= _pendingQueue.front().ScheduleTime()) {
+                if (delta >= next) {
                     _nextTrigger = delta;
                     delayTime = 0;
                 } else {
                     // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
                     // om de waarde in ms te krijgen.
-                    _nextTrigger = _pendingQueue.front().ScheduleTime();
+                    _nextTrigger = next;
                     delayTime = static_cast<uint32_t>((_nextTrigger - delta) / Time::TicksPerMillisecond);
                 }
             }
@@ -398,23 +860,12 @@ namespace Core {
     private:
         bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
         {
-            bool reevaluate = false;
-            typename SubscriberList::iterator index = _pendingQueue.begin();
+            const uint64_t head = _pendingQueue.Next();
 
-            while ((index != _pendingQueue.end()) && (infoBlock.ScheduleTime() >= (*index).ScheduleTime())) {
-                ++index;
-            }
-
-            if (index == _pendingQueue.begin()) {
-                _pendingQueue.push_front(std::move(infoBlock));
+            // If we added the new time up front, retrigger the scheduler.
+            bool reevaluate = (infoBlock.ScheduleTime() < head);
 
-                // If we added the new time up front, retrigger the scheduler.
-                reevaluate = true;
-            } else if (index == _pendingQueue.end()) {
-                _pendingQueue.push_back(std::move(infoBlock));
-            } else {
-                _pendingQueue.insert(index, std::move(infoBlock));
-            }
+            _pendingQueue.Insert(std::move(infoBlock));
 
             return (reevaluate);
         }
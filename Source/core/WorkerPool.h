@@ -150,6 +150,11 @@ namespace Core {
             {
                 return (!operator==(RHS));
             }
+            // Equal timers have an equal hash, allows the TimerType to find them quickly.
+            size_t Hash() const
+            {
+                return (_job.IsValid() == true ? reinterpret_cast<size_t>(_job.operator->()) : 0);
+            }
             uint64_t Timed(const uint64_t /* scheduledTime */)
             {
                 ASSERT(_pool != nullptr);
@@ -380,6 +385,11 @@ POP_WARNING()
 
             return (result);
         }
+        // Number of threads in the pool, processing the submitted jobs.
+        uint8_t Count() const
+        {
+            return (_threadPool.Count());
+        }
         void Join() override
         {
             _joined = Thread::ThreadId();
@@ -308,8 +308,8 @@ SecureSocketPort::Handler::Handler(SecureSocketPort& parent,
     const enumType socketType,
     const Core::NodeId& localNode,
     const Core::NodeId& remoteNode,
-    const uint16_t sendBufferSize,
-    const uint16_t receiveBufferSize,
+    const uint32_t sendBufferSize,
+    const uint32_t receiveBufferSize,
     const uint32_t socketSendBufferSize,
     const uint32_t socketReceiveBufferSize)
     : SocketPort(socketType, localNode, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize)
@@ -323,8 +323,8 @@ SecureSocketPort::Handler::Handler(SecureSocketPort& parent,
     const enumType socketType,
     const SOCKET& connector,
     const Core::NodeId& remoteNode,
-    const uint16_t sendBufferSize,
-    const uint16_t receiveBufferSize,
+    const uint32_t sendBufferSize,
+    const uint32_t receiveBufferSize,
     const uint32_t socketSendBufferSize,
     const uint32_t socketReceiveBufferSize)
     : SocketPort(socketType, connector, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize)
@@ -388,7 +388,7 @@ uint32_t SecureSocketPort::Handler::Initialize() {
     return (initialized);
 }
 
-int32_t SecureSocketPort::Handler::Read(uint8_t buffer[], const uint16_t length) const {
+int32_t SecureSocketPort::Handler::Read(uint8_t buffer[], const uint32_t length) const {
 
     ASSERT(_handShaking != ERROR);
 
@@ -399,7 +399,7 @@ int32_t SecureSocketPort::Handler::Read(uint8_t buffer[], const uint16_t length)
     return (SSL_read(_ssl, buffer, length));
 }
 
-int32_t SecureSocketPort::Handler::Write(const uint8_t buffer[], const uint16_t length) {
+int32_t SecureSocketPort::Handler::Write(const uint8_t buffer[], const uint32_t length) {
 
     ASSERT(_handShaking != ERROR);
 
@@ -412,6 +412,25 @@ int32_t SecureSocketPort::Handler::Write(const uint8_t buffer[], const uint16_t
     return (result);
 }
 
+int32_t SecureSocketPort::Handler::Write(const uint8_t buffer[], const uint32_t length, const uint8_t payload[], const uint32_t payloadLength) {
+
+    // Everything passes through the TLS layer, so there is nothing to gather here.
+    int32_t result = (length != 0 ? Write(buffer, length) : 0);
+
+    if ((result == static_cast<int32_t>(length)) && (payloadLength != 0)) {
+        int32_t sent = Write(payload, payloadLength);
+
+        if (sent > 0) {
+            result += sent;
+        }
+        else if (result == 0) {
+            result = sent;
+        }
+    }
+
+    return (result);
+}
+
 uint32_t SecureSocketPort::Handler::Open(const uint32_t waitTime) {
     return (Core::SocketPort::Open(waitTime));
 }
@@ -522,4 +541,36 @@ void SecureSocketPort::Handler::Update() {
 SecureSocketPort::~SecureSocketPort() {
 }
 
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+/* virtual */ uint32_t SecureSocketPort::SendData(uint8_t* dataFrame, const uint32_t maxSendSize) {
+    // Only gets here if the deprecated 16 bits SendData is the one implemented.
+    uint32_t result = 0;
+    uint16_t window;
+    uint16_t loaded;
+
+    do {
+        window = static_cast<uint16_t>(std::min(maxSendSize - result, static_cast<uint32_t>(0xFFFF)));
+        loaded = SendData(&(dataFrame[result]), window);
+        result += loaded;
+    } while ((loaded == window) && (result < maxSendSize));
+
+    return (result);
+}
+
+/* virtual */ uint32_t SecureSocketPort::ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) {
+    // Only gets here if the deprecated 16 bits ReceiveData is the one implemented.
+    uint32_t result = 0;
+    uint16_t window;
+    uint16_t handled;
+
+    do {
+        window = static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF)));
+        handled = ReceiveData(&(dataFrame[result]), window);
+        result += handled;
+    } while ((handled == window) && (result < receivedSize));
+
+    return (result);
+}
+POP_WARNING()
+
 } } // namespace Thunder::Crypto
@@ -131,16 +131,16 @@ namespace Crypto {
                 const enumType socketType,
                 const Core::NodeId& localNode,
                 const Core::NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize);
             Handler(SecureSocketPort& parent,
                 const enumType socketType,
                 const SOCKET& connector,
                 const Core::NodeId& remoteNode,
-                const uint16_t sendBufferSize,
-                const uint16_t receiveBufferSize,
+                const uint32_t sendBufferSize,
+                const uint32_t receiveBufferSize,
                 const uint32_t socketSendBufferSize,
                 const uint32_t socketReceiveBufferSize);
             ~Handler();
@@ -148,18 +148,19 @@ namespace Crypto {
         public:
             uint32_t Initialize() override;
 
-            int32_t Read(uint8_t buffer[], const uint16_t length) const override;
-            int32_t Write(const uint8_t buffer[], const uint16_t length) override;
+            int32_t Read(uint8_t buffer[], const uint32_t length) const override;
+            int32_t Write(const uint8_t buffer[], const uint32_t length) override;
+            int32_t Write(const uint8_t buffer[], const uint32_t length, const uint8_t payload[], const uint32_t payloadLength) override;
 
             uint32_t Open(const uint32_t waitTime);
             uint32_t Close(const uint32_t waitTime);
 
             // Methods to extract and insert data into the socket buffers
-            inline uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override {
+            inline uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
-            inline uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override {
+            inline uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
 
@@ -201,16 +202,16 @@ namespace Crypto {
             const Core::SocketPort::enumType socketType,
             const Core::NodeId& localNode,
             const Core::NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize)
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize)
             : _handler(*this, socketType, localNode, remoteNode, sendBufferSize, receiveBufferSize, sendBufferSize, receiveBufferSize) {
         }
         SecureSocketPort(
             const Core::SocketPort::enumType socketType,
             const Core::NodeId& localNode,
             const Core::NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize,
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize,
             const uint32_t socketSendBufferSize,
             const uint32_t socketReceiveBufferSize)
             : _handler(*this, socketType, localNode, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize) {
@@ -219,16 +220,16 @@ namespace Crypto {
             const Core::SocketPort::enumType socketType,
             const SOCKET& connector,
             const Core::NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize)
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize)
             : _handler(*this, socketType, connector, remoteNode, sendBufferSize, receiveBufferSize, sendBufferSize, receiveBufferSize) {
         }
         SecureSocketPort(
             const Core::SocketPort::enumType socketType,
             const SOCKET& connector,
             const Core::NodeId& remoteNode,
-            const uint16_t sendBufferSize,
-            const uint16_t receiveBufferSize,
+            const uint32_t sendBufferSize,
+            const uint32_t receiveBufferSize,
             const uint32_t socketSendBufferSize,
             const uint32_t socketReceiveBufferSize)
             : _handler(*this, socketType, connector, remoteNode, sendBufferSize, receiveBufferSize, socketSendBufferSize, socketReceiveBufferSize) {
@@ -309,9 +310,18 @@ namespace Crypto {
             static_cast<Core::IResource&>(_handler).Handle(events);
         }
 
-        // Methods to extract and insert data into the socket buffers
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+        // Methods to extract and insert data into the socket buffers. As on a Core::SocketPort, the
+        // pair taking 32 bits lengths is the one to implement, the 16 bits pair is deprecated.
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize);
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize);
+        DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+        }
+        DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+        }
 
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
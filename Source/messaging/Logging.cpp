@@ -81,6 +81,9 @@ namespace Logging {
             }
             counter++;
         }
+
+        // The process is about to go down, do not leave the dump behind in a staging buffer.
+        Messaging::MessageUnit::Instance().Flush();
     }
 
     void DumpSystemFiles(const pid_t pid)
@@ -105,6 +108,8 @@ namespace Logging {
             std::string procPath = std::string("/proc/") + std::to_string(pid) + "/status";
             logProcPath(procPath);
         }
+
+        Messaging::MessageUnit::Instance().Flush();
     }
 
 #ifdef __CORE_EXCEPTION_CATCHING__
@@ -86,7 +86,7 @@ namespace Logging {
                 Thunder::Core::Time::Now().Ticks()                                                                                          \
             );                                                                                                                              \
             Thunder::Core::Messaging::IStore::Logging __log__(__info__);                                                                    \
-            Thunder::Core::Messaging::TextMessage __message__(__data__.Data());                                                             \
+            Thunder::Core::Messaging::TextMessage __message__(__data__);                                                                    \
             Thunder::Messaging::MessageUnit::Instance().Push(__log__, &__message__);                                                        \
         }                                                                                                                                   \
     } while(false)
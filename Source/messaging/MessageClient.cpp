@@ -177,6 +177,22 @@ namespace Messaging {
      */
     void MessageClient::PopMessagesAndCall(const MessageHandler& handler)
     {
+        using Entry = std::pair<Core::ProxyType<Core::Messaging::MessageInfo>, Core::ProxyType<Core::Messaging::IEvent>>;
+
+        // The messages are reported once the lock is released, so a format that is not known yet can be asked
+        // for without blocking the other users of this client.
+        struct Unresolved {
+            uint32_t Instance;
+            uint32_t Id;
+            Core::ProxyType<MessageUnit::Client::Channel> Channel;
+            Core::ProxyType<Core::Messaging::TextMessage> Text;
+        };
+
+        std::vector<Entry> entries;
+        std::vector<Unresolved> unresolved;
+
+        ASSERT(handler != nullptr);
+
         _adminLock.Lock();
 
         for (auto& client : _clients) {
@@ -195,8 +211,6 @@ namespace Messaging {
 
                 uint16_t length = 0;
 
-                ASSERT(handler != nullptr);
-
                 auto factory = _factories.find(type);
 
                 if (factory != _factories.end()) {
@@ -209,7 +223,21 @@ namespace Messaging {
                     length = metadata->Deserialize(_readBuffer, size);
                     length += message->Deserialize((&_readBuffer[length]), (size - length));
 
-                    handler(metadata, message);
+                    // The writer might have left the formatting of the text to us.
+                    Core::ProxyType<Core::Messaging::TextMessage> text(message);
+
+                    if ((text.IsValid() == true) && (text->Deferred() != 0)) {
+                        const string* format = client.second.Format(text->Deferred());
+
+                        if (format != nullptr) {
+                            text->Render(*format);
+                        }
+                        else if (client.second.IsUnresolvable(text->Deferred()) == false) {
+                            unresolved.push_back({ client.first, text->Deferred(), client.second.Metadata(), text });
+                        }
+                    }
+
+                    entries.emplace_back(std::move(metadata), std::move(message));
                 }
 
                 if (length == 0) {
@@ -221,6 +249,67 @@ namespace Messaging {
         }
  
         _adminLock.Unlock();
+
+        for (const Unresolved& entry : unresolved) {
+            string format;
+            bool found = false;
+            bool asked = false;
+
+            _adminLock.Lock();
+
+            Clients::const_iterator index(_clients.find(entry.Instance));
+
+            if (index != _clients.end()) {
+                // Asked for already, on behalf of an earlier message.
+                const string* known = index->second.Format(entry.Id);
+
+                if (known != nullptr) {
+                    format = *known;
+                    found = true;
+                }
+                else {
+                    asked = index->second.IsUnresolvable(entry.Id);
+                }
+            }
+
+            _adminLock.Unlock();
+
+            if ((found == false) && (asked == false)) {
+                found = (MessageUnit::Client::Format(*(entry.Channel), entry.Id, FormatWaitTime, format) == Core::ERROR_NONE);
+
+                _adminLock.Lock();
+
+                Clients::iterator client(_clients.find(entry.Instance));
+
+                if (client != _clients.end()) {
+                    if (found == true) {
+                        client->second.Format(entry.Id, format);
+                    }
+                    else {
+                        // No answer, e.g. the other side is gone, so leave its messages unrendered from now on.
+                        client->second.Unresolvable(entry.Id);
+                    }
+                }
+
+                _adminLock.Unlock();
+            }
+
+            if (found == true) {
+                entry.Text->Render(format);
+            }
+        }
+
+#ifdef MESSAGE_BATCHING_ENABLED
+        // Writers hand over their messages per thread in batches, so restore the order in which they were
+        // created, over all buffers, before reporting them.
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            return (lhs.first->TimeStamp() < rhs.first->TimeStamp());
+        });
+#endif
+
+        for (const Entry& entry : entries) {
+            handler(entry.first, entry.second);
+        }
     }
 
     /**
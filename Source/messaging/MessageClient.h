@@ -68,6 +68,9 @@ namespace Messaging {
             }
         };
 
+        // How long to wait for the other side to hand over the format of a deferred text.
+        static constexpr uint32_t FormatWaitTime = 1000;
+
         using Factories = std::unordered_map<Core::Messaging::Metadata::type, IEventFactory*, enumHash>;
         using Clients = std::map<uint32_t, MessageUnit::Client>;
 
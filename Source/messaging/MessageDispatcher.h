@@ -102,6 +102,200 @@ namespace Messaging {
             Core::DoorBell _doorBell;
         };
 
+#ifdef MESSAGE_BATCHING_ENABLED
+    public:
+        // Per thread staging: messages are collected in a buffer owned by the pushing thread and moved to
+        // the cyclic buffer in one reservation (and one ring) once the stage is full or too old.
+        static constexpr uint16_t StageSize = 4 * 1024;
+        static constexpr uint32_t StageAge = 20; // ms
+
+    private:
+        class Stage {
+        public:
+            Stage() = delete;
+            Stage(Stage&&) = delete;
+            Stage(const Stage&) = delete;
+            Stage& operator=(Stage&&) = delete;
+            Stage& operator=(const Stage&) = delete;
+
+            explicit Stage(MessageDataBuffer& parent)
+                : _lock()
+                , _parent(&parent)
+                , _detached(false)
+                , _used(0)
+                , _oldest(0)
+            {
+            }
+            ~Stage() = default;
+
+        public:
+            bool IsDetached() const {
+                return (_detached);
+            }
+            bool IsEmpty() const {
+                _lock.Lock();
+                const bool result = (_used == 0);
+                _lock.Unlock();
+
+                return (result);
+            }
+            const MessageDataBuffer* Parent() const {
+                _lock.Lock();
+                const MessageDataBuffer* result = _parent;
+                _lock.Unlock();
+
+                return (result);
+            }
+            uint32_t Push(const uint16_t length, const uint8_t* value)
+            {
+                uint32_t result = Core::ERROR_WRITE_ERROR;
+                const uint16_t fullLength = sizeof(length) + length;
+
+                _lock.Lock();
+
+                if (_parent != nullptr) {
+                    uint32_t committed = Core::ERROR_NONE;
+
+                    if ((_used + fullLength) > sizeof(_buffer)) {
+                        committed = Commit();
+                    }
+
+                    if (fullLength > sizeof(_buffer)) {
+                        // Will never fit the stage, hand it over as is.
+                        result = _parent->Write(length, value);
+                    }
+                    else {
+                        const uint64_t now = Core::Time::Now().Ticks();
+
+                        if (_used == 0) {
+                            _oldest = now;
+                            _parent->Staged();
+                        }
+
+                        ::memcpy(&_buffer[_used], &fullLength, sizeof(fullLength));
+                        ::memcpy(&_buffer[_used + sizeof(fullLength)], value, length);
+                        _used += fullLength;
+                        result = Core::ERROR_NONE;
+
+                        if ((_used >= (sizeof(_buffer) / 2)) || ((now - _oldest) >= (StageAge * Core::Time::TicksPerMillisecond))) {
+                            result = Commit();
+                        }
+                    }
+
+                    // Messages pushed earlier got lost making room for this one, the caller should know.
+                    if (result == Core::ERROR_NONE) {
+                        result = committed;
+                    }
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+            uint32_t Flush(const bool stale)
+            {
+                uint32_t result = Core::ERROR_NONE;
+
+                _lock.Lock();
+
+                if ((_parent != nullptr) && (_used > 0)) {
+                    if ((stale == false) || ((Core::Time::Now().Ticks() - _oldest) >= (StageAge * Core::Time::TicksPerMillisecond))) {
+                        result = Commit();
+                    }
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+            // The owning thread is gone, whatever is left goes out now. Nobody is left to tell if that
+            // fails, the parent keeps count of what got dropped.
+            void Detach()
+            {
+                _lock.Lock();
+
+                if ((_parent != nullptr) && (_used > 0)) {
+                    Commit();
+                }
+                _detached = true;
+
+                _lock.Unlock();
+            }
+            // The buffer is going away, drop the link to it.
+            void Orphan()
+            {
+                _lock.Lock();
+                _parent = nullptr;
+                _used = 0;
+                _lock.Unlock();
+            }
+
+        private:
+            uint32_t Commit()
+            {
+                ASSERT(_parent != nullptr);
+
+                uint32_t result = _parent->Write(_buffer, _used);
+
+                if (result != Core::ERROR_NONE) {
+                    uint16_t offset = 0;
+                    uint32_t records = 0;
+
+                    while (offset < _used) {
+                        uint16_t fullLength;
+                        ::memcpy(&fullLength, &_buffer[offset], sizeof(fullLength));
+                        offset += fullLength;
+                        records++;
+                    }
+
+                    _parent->_dropped += records;
+                }
+
+                _used = 0;
+
+                return (result);
+            }
+
+        private:
+            mutable Core::CriticalSection _lock;
+            MessageDataBuffer* _parent;
+            std::atomic<bool> _detached;
+            uint16_t _used;
+            uint64_t _oldest;
+            uint8_t _buffer[StageSize];
+        };
+
+        // Lives in thread local storage, one per pushing thread.
+        class Binding {
+        public:
+            Binding(Binding&&) = delete;
+            Binding(const Binding&) = delete;
+            Binding& operator=(Binding&&) = delete;
+            Binding& operator=(const Binding&) = delete;
+
+            Binding()
+                : _stage()
+            {
+            }
+            ~Binding()
+            {
+                if (_stage != nullptr) {
+                    _stage->Detach();
+                }
+            }
+
+        public:
+            std::shared_ptr<Stage>& Current() {
+                return (_stage);
+            }
+
+        private:
+            std::shared_ptr<Stage> _stage;
+        };
+
+        using Stages = std::vector<std::shared_ptr<Stage>>;
+
+#endif
     public:
         MessageDataBuffer(const MessageDataBuffer&) = delete;
         MessageDataBuffer& operator=(const MessageDataBuffer&) = delete;
@@ -117,6 +311,11 @@ namespace Messaging {
         MessageDataBuffer(const string& identifier, const uint32_t instanceId, const string& baseDirectory, const uint16_t dataSize, const uint16_t socketPort = 0, const bool initialize = false)
             : _filenames(PrepareFilenames(baseDirectory, identifier, instanceId, socketPort))
             , _dataLock()
+#ifdef MESSAGE_BATCHING_ENABLED
+            , _stageLock()
+            , _stages()
+            , _dropped(0)
+#endif
             , _initialize(initialize)
             // clang-format off
             , _dataBuffer(_filenames.doorBell, _filenames.data,  Core::File::USER_READ    |
@@ -145,8 +344,17 @@ namespace Messaging {
                 }
             }
         }
-        ~MessageDataBuffer()
+        virtual ~MessageDataBuffer()
         {
+#ifdef MESSAGE_BATCHING_ENABLED
+            _stageLock.Lock();
+            for (std::shared_ptr<Stage>& stage : _stages) {
+                stage->Flush(false);
+                stage->Orphan();
+            }
+            _stages.clear();
+            _stageLock.Unlock();
+#endif
             _dataBuffer.Relinquish();
 
             if (_initialize == true) {
@@ -167,39 +375,98 @@ namespace Messaging {
         *
         * @param length length of message
         * @param value buffer
-        * @return uint32_t ERROR_WRITE_ERROR: failed to reserve enough space - eg, value size is exceeding max cyclic buffer size
+        * @return uint32_t ERROR_WRITE_ERROR: failed to reserve enough space - eg, value size is exceeding max cyclic buffer size,
+        *                                     with batching this may also concern messages staged before this one
         *                  ERROR_NONE: OK
         */
         uint32_t PushData(const uint16_t length, const uint8_t* value)
         {
-            uint32_t result = Core::ERROR_WRITE_ERROR;
-            const uint16_t fullLength = sizeof(length) + length; // headerLength + informationLength
-
             INTERNAL_ASSERT(length > 0);
             INTERNAL_ASSERT(value != nullptr);
 
-            _dataLock.Lock();
+#ifdef MESSAGE_BATCHING_ENABLED
+            return (Staging().Push(length, value));
+#else
+            return (Write(length, value));
+#endif
+        }
 
-            if (_dataBuffer.IsValid() == true) {
-                const uint16_t reservedLength = _dataBuffer.Reserve(fullLength);
+#ifdef MESSAGE_BATCHING_ENABLED
+        /**
+        * @brief Move the messages staged by the pushing threads into the cyclic buffer.
+        *
+        * @param stale only move the stages that have been waiting longer than StageAge
+        * @return uint32_t ERROR_WRITE_ERROR: the messages of at least one stage could not be written, see Dropped()
+        *                  ERROR_NONE: OK
+        */
+        uint32_t Flush(const bool stale = false)
+        {
+            uint32_t result = Core::ERROR_NONE;
 
-                if (reservedLength >= fullLength) {
-                    //no need to serialize because we can write to CyclicBuffer step by step
-                    _dataBuffer.Write(reinterpret_cast<const uint8_t*>(&fullLength), sizeof(fullLength)); //fullLength
-                    _dataBuffer.Write(value, length); //value
-                    _dataBuffer.Ring();
-                    result = Core::ERROR_NONE;
+            _stageLock.Lock();
+
+            Stages::iterator index(_stages.begin());
+
+            while (index != _stages.end()) {
+                const uint32_t flushed = (*index)->Flush(stale);
+
+                if (flushed != Core::ERROR_NONE) {
+                    result = flushed;
+                }
+
+                if ((*index)->IsDetached() == true) {
+                    index = _stages.erase(index);
                 }
                 else {
-                    TRACE_L1("Buffer to small to fit message!");
+                    index++;
                 }
             }
 
-            _dataLock.Unlock();
+            _stageLock.Unlock();
 
             return (result);
         }
 
+        /**
+        * @brief Check if any of the pushing threads has messages staged.
+        */
+        bool HasStaged() const
+        {
+            bool result = false;
+
+            _stageLock.Lock();
+
+            for (const std::shared_ptr<Stage>& stage : _stages) {
+                if (stage->IsEmpty() == false) {
+                    result = true;
+                    break;
+                }
+            }
+
+            _stageLock.Unlock();
+
+            return (result);
+        }
+
+        /**
+        * @brief Number of staged messages that were lost because the cyclic buffer did not take them.
+        */
+        uint32_t Dropped() const
+        {
+            return (_dropped.load());
+        }
+
+    protected:
+        /**
+        * @brief A pushing thread staged a message while it had nothing staged, from now on a stale flush makes sense.
+        */
+        virtual void Staged()
+        {
+        }
+
+    public:
+#endif
+
         /**
          * @brief Read data after doorbell ringed. If buffer is too small to fit whole message it will be partially filled.
          *
@@ -272,6 +539,81 @@ namespace Messaging {
             return (_filenames.metaData);
         }
 
+    private:
+        uint32_t Write(const uint16_t length, const uint8_t* value)
+        {
+            uint32_t result = Core::ERROR_WRITE_ERROR;
+            const uint16_t fullLength = sizeof(length) + length; // headerLength + informationLength
+
+            _dataLock.Lock();
+
+            if (_dataBuffer.IsValid() == true) {
+                const uint16_t reservedLength = _dataBuffer.Reserve(fullLength);
+
+                if (reservedLength >= fullLength) {
+                    //no need to serialize because we can write to CyclicBuffer step by step
+                    _dataBuffer.Write(reinterpret_cast<const uint8_t*>(&fullLength), sizeof(fullLength)); //fullLength
+                    _dataBuffer.Write(value, length); //value
+                    _dataBuffer.Ring();
+                    result = Core::ERROR_NONE;
+                }
+                else {
+                    TRACE_L1("Buffer to small to fit message!");
+                }
+            }
+
+            _dataLock.Unlock();
+
+            return (result);
+        }
+#ifdef MESSAGE_BATCHING_ENABLED
+        // Write a run of complete [fullLength][value] records in one reservation.
+        uint32_t Write(const uint8_t records[], const uint16_t length)
+        {
+            uint32_t result = Core::ERROR_WRITE_ERROR;
+
+            _dataLock.Lock();
+
+            if (_dataBuffer.IsValid() == true) {
+                const uint32_t reservedLength = _dataBuffer.Reserve(length);
+
+                if (reservedLength >= length) {
+                    _dataBuffer.Write(records, length);
+                    _dataBuffer.Ring();
+                    result = Core::ERROR_NONE;
+                }
+                else {
+                    TRACE_L1("Buffer to small to fit the staged messages!");
+                }
+            }
+
+            _dataLock.Unlock();
+
+            return (result);
+        }
+        Stage& Staging()
+        {
+            static thread_local Binding binding;
+
+            std::shared_ptr<Stage>& stage(binding.Current());
+
+            if ((stage == nullptr) || (stage->Parent() != this)) {
+                if (stage != nullptr) {
+                    // Staged for another buffer, that one should not lose it.
+                    stage->Detach();
+                }
+
+                stage = std::make_shared<Stage>(*this);
+
+                _stageLock.Lock();
+                _stages.push_back(stage);
+                _stageLock.Unlock();
+            }
+
+            return (*stage);
+        }
+#endif
+
     private:
         struct Filenames {
             string doorBell;
@@ -316,6 +658,11 @@ namespace Messaging {
 
     private:
         mutable Core::CriticalSection _dataLock;
+#ifdef MESSAGE_BATCHING_ENABLED
+        mutable Core::CriticalSection _stageLock;
+        Stages _stages;
+        std::atomic<uint32_t> _dropped;
+#endif
         bool _initialize;
         DataBuffer _dataBuffer;
     };
@@ -354,5 +354,19 @@ namespace Thunder {
                 }
             }
         }
+
+        /**
+        * @brief Make all messages pushed so far available to the reading side, e.g. before a crash dump.
+        */
+        void MessageUnit::Flush()
+        {
+#ifdef MESSAGE_BATCHING_ENABLED
+            _adminLock.Lock();
+            if ((_dispatcher != nullptr) && (_dispatcher->Flush() != Core::ERROR_NONE)) {
+                TRACE_L1("Unable to flush message data, %u messages dropped so far!", _dispatcher->Dropped());
+            }
+            _adminLock.Unlock();
+#endif
+        }
     } // namespace Messaging
 }
@@ -24,6 +24,8 @@
 #include "TraceFactory.h"
 #include "DirectOutput.h"
 
+#include <unordered_set>
+
 namespace Thunder {
 
     namespace Messaging {
@@ -50,7 +52,8 @@ namespace Thunder {
             enum metadataFrameProtocol : uint8_t {
                 UPDATE      = 0,
                 CONTROLS    = 1,
-                MODULES     = 2
+                MODULES     = 2,
+                FORMAT      = 3
             };
 
             enum flush : uint8_t {
@@ -722,6 +725,8 @@ namespace Thunder {
                 using BaseClass = MessageDataBuffer;
 
             public:
+                using Channel = Core::IPCChannelClientType<Core::Void, false, true>;
+
                 Client() = delete;
                 Client(Client&&) = delete;
                 Client(const Client&) = delete;
@@ -730,22 +735,24 @@ namespace Thunder {
 
                 Client(const string& identifier, const uint32_t instanceId, const string& baseDirectory, const uint16_t socketPort = 0)
                     : MessageDataBuffer(identifier, instanceId, baseDirectory, MessageUnit::Instance().DataSize(), socketPort, false)
-                    , _channel(Core::NodeId(MetadataName().c_str()), MetadataBufferSize) {
-                    _channel.Open(Core::infinite);
+                    , _channel(Core::ProxyType<Channel>::Create(Core::NodeId(MetadataName().c_str()), static_cast<uint32_t>(MetadataBufferSize)))
+                    , _formats()
+                    , _unresolvable() {
+                    _channel->Open(Core::infinite);
                 }
                 ~Client() {
-                    _channel.Close(100);
+                    _channel->Close(100);
                 }
 
             public:
                 bool IsValid() const {
-                    return (_channel.IsOpen());
+                    return (_channel->IsOpen());
                 }
 
                 void Validate()
                 {
                     if ((IsValid() == false) && (MessageDataBuffer::Validate() == true)) {
-                        _channel.Open(Core::infinite);
+                        _channel->Open(Core::infinite);
                     }
                 }
 
@@ -762,7 +769,7 @@ namespace Thunder {
                 {
                     uint32_t result = Core::ERROR_ILLEGAL_STATE;
 
-                    if (_channel.IsOpen() == true) {
+                    if (_channel->IsOpen() == true) {
 
                         uint8_t dataBuffer[TempMetadataBufferSize];
 
@@ -779,7 +786,7 @@ namespace Thunder {
 
                         metaDataFrame->Parameters().Set(writer.Offset() + length, dataBuffer);
 
-                        result = _channel.Invoke(metaDataFrame, waitTime);
+                        result = _channel->Invoke(metaDataFrame, waitTime);
                     }
 
                     return (result);
@@ -787,7 +794,7 @@ namespace Thunder {
 
                 void Load(ControlList& info, const string& module) const
                 {
-                    if (_channel.IsOpen() == true) {
+                    if (_channel->IsOpen() == true) {
 
                         // We got a connection to the spawned process side, get the list of traces from
                         // there and send our settings from here...
@@ -802,7 +809,7 @@ namespace Thunder {
 
                         metaDataFrame->Parameters().Set(writer.Offset(), buffer);
 
-                        uint32_t result = _channel.Invoke(metaDataFrame, Core::infinite);
+                        uint32_t result = _channel->Invoke(metaDataFrame, Core::infinite);
 
                         if (result == Core::ERROR_NONE) {
                             uint16_t index = 0;
@@ -834,7 +841,7 @@ namespace Thunder {
 
                 void Modules(std::vector<string>& modules) const
                 {
-                    if (_channel.IsOpen() == true) {
+                    if (_channel->IsOpen() == true) {
                         Core::ProxyType<MetadataFrame> metaDataFrame(Core::ProxyType<MetadataFrame>::Create());
 
                         uint8_t buffer[1];
@@ -845,7 +852,7 @@ namespace Thunder {
 
                         metaDataFrame->Parameters().Set(writer.Offset(), buffer);
 
-                        uint32_t result = _channel.Invoke(metaDataFrame, Core::infinite);
+                        uint32_t result = _channel->Invoke(metaDataFrame, Core::infinite);
 
                         if (result == Core::ERROR_NONE) {
                             uint16_t bufferSize = metaDataFrame->Response().Length();
@@ -868,8 +875,93 @@ namespace Thunder {
                     }
                 }
 
+                /**
+                 * @brief Format string registered under the given id on the other side, if it was retrieved before.
+                 *
+                 * @param id the id carried by a deferred message
+                 * @return const string* the format, nullptr if it is not known (yet)
+                 */
+                const string* Format(const uint32_t id) const
+                {
+                    std::unordered_map<uint32_t, string>::const_iterator index(_formats.find(id));
+
+                    return (index != _formats.end() ? &(index->second) : nullptr);
+                }
+                void Format(const uint32_t id, const string& format)
+                {
+                    _formats.emplace(id, format);
+                }
+
+                /**
+                 * @brief Whether the other side already failed to hand over the format registered under the given id.
+                 *        It is asked only once, so messages carrying that id do not all pay the wait again.
+                 *
+                 * @param id the id carried by a deferred message
+                 */
+                bool IsUnresolvable(const uint32_t id) const
+                {
+                    return (_unresolvable.find(id) != _unresolvable.end());
+                }
+                void Unresolvable(const uint32_t id)
+                {
+                    _unresolvable.insert(id);
+                }
+
+                /**
+                 * @brief The channel to the other side. It is shared, so the caller can use it without holding on to this client.
+                 */
+                Core::ProxyType<Channel> Metadata() const
+                {
+                    return (_channel);
+                }
+
+                /**
+                 * @brief Ask the other side for the format string registered under the given id.
+                 *
+                 * @param channel the channel to the other side, see Metadata()
+                 * @param id the id carried by a deferred message
+                 * @param waitTime how long to wait for the other side to answer
+                 * @param format the format, if it could be retrieved
+                 * @return uint32_t Core::ERROR_NONE if the format was retrieved
+                 */
+                static uint32_t Format(Channel& channel, const uint32_t id, const uint32_t waitTime, string& format)
+                {
+                    uint32_t result = Core::ERROR_ILLEGAL_STATE;
+
+                    if (channel.IsOpen() == true) {
+                        Core::ProxyType<MetadataFrame> metaDataFrame(Core::ProxyType<MetadataFrame>::Create());
+
+                        uint8_t buffer[1 + sizeof(id)];
+                        Core::FrameType<0> frame(buffer, sizeof(buffer), sizeof(buffer));
+                        Core::FrameType<0>::Writer writer(frame, 0);
+
+                        writer.Number<metadataFrameProtocol>(metadataFrameProtocol::FORMAT);
+                        writer.Number<uint32_t>(id);
+
+                        metaDataFrame->Parameters().Set(writer.Offset(), buffer);
+
+                        result = channel.Invoke(metaDataFrame, waitTime);
+
+                        if (result == Core::ERROR_NONE) {
+                            if (metaDataFrame->Response().Length() > 1) {
+                                Core::FrameType<0> response(const_cast<uint8_t*>(metaDataFrame->Response().Value()), metaDataFrame->Response().Length(), metaDataFrame->Response().Length());
+                                Core::FrameType<0>::Reader reader(response, 0);
+
+                                format = reader.NullTerminatedText();
+                            }
+                            else {
+                                result = Core::ERROR_UNKNOWN_KEY;
+                            }
+                        }
+                    }
+
+                    return (result);
+                }
+
             private:
-                mutable Core::IPCChannelClientType<Core::Void, false, true> _channel;
+                Core::ProxyType<Channel> _channel;
+                std::unordered_map<uint32_t, string> _formats;
+                std::unordered_set<uint32_t> _unresolvable;
             };
 
         private:
@@ -923,6 +1015,16 @@ namespace Thunder {
                                 uint16_t length = _parent.Serialize(outBuffer, sizeof(outBuffer));
                                 message->Response().Set(length, outBuffer);
                             }
+                            else if (protocol == metadataFrameProtocol::FORMAT) {
+                                ASSERT(reader.HasData());
+                                string format;
+                                Core::Messaging::Formats::Lookup(reader.Number<uint32_t>(), format);
+
+                                Core::FrameType<0> response(outBuffer, sizeof(outBuffer), sizeof(outBuffer));
+                                Core::FrameType<0>::Writer writer(response, 0);
+                                writer.NullTerminatedText(format, sizeof(outBuffer));
+                                message->Response().Set(writer.Offset(), outBuffer);
+                            }
                             else {
                                 ASSERT(false);
                             }
@@ -959,6 +1061,51 @@ namespace Thunder {
                     Core::ProxyObject<MetadataFrameHandler> _handler;
                 };
 
+#ifdef MESSAGE_BATCHING_ENABLED
+                // Moves stages of threads that stopped pushing into the cyclic buffer, so their last messages
+                // do not wait for the next one to arrive. Only runs while something is staged.
+                class Flusher : public Core::Thread {
+                public:
+                    Flusher() = delete;
+                    Flusher(Flusher&&) = delete;
+                    Flusher(const Flusher&) = delete;
+                    Flusher& operator=(Flusher&&) = delete;
+                    Flusher& operator=(const Flusher&) = delete;
+
+                    Flusher(MessageDataBuffer& parent)
+                        : Core::Thread(Core::Thread::DefaultStackSize(), _T("MessageFlusher"))
+                        , _parent(parent)
+                    {
+                        Core::Thread::Run();
+                    }
+                    ~Flusher() override
+                    {
+                        Core::Thread::Stop();
+                        Core::Thread::Wait(Core::Thread::STOPPED, Core::infinite);
+                    }
+
+                public:
+                    void Wake()
+                    {
+                        Core::Thread::Run();
+                    }
+
+                private:
+                    uint32_t Worker() override
+                    {
+                        // Block first, a Wake() from here on gets this worker going again.
+                        Core::Thread::Block();
+
+                        _parent.Flush(true);
+
+                        return (_parent.HasStaged() == true ? MessageDataBuffer::StageAge : Core::infinite);
+                    }
+
+                private:
+                    MessageDataBuffer& _parent;
+                };
+
+#endif
             public:
                 MessageDispatcher() = delete;
                 MessageDispatcher(MessageDispatcher&&) = delete;
@@ -979,6 +1126,9 @@ namespace Thunder {
                 MessageDispatcher(MessageUnit& parent, const string& identifier, const uint32_t instanceId, const string& basePath, const uint16_t dataSize, const uint16_t socketPort)
                     : BaseClass(identifier, instanceId, basePath, dataSize, socketPort, true)
                     , _metaDataBuffer(parent, BaseClass::MetadataName())
+#ifdef MESSAGE_BATCHING_ENABLED
+                    , _flusher(*this)
+#endif
                 {
                 }
                 ~MessageDispatcher() = default;
@@ -989,7 +1139,18 @@ namespace Thunder {
                 }
 
             private:
+#ifdef MESSAGE_BATCHING_ENABLED
+                void Staged() override
+                {
+                    _flusher.Wake();
+                }
+
+#endif
+            private:
                 MetaDataBuffer _metaDataBuffer;
+#ifdef MESSAGE_BATCHING_ENABLED
+                Flusher _flusher;
+#endif
             };
 
         private:
@@ -1035,6 +1196,7 @@ namespace Thunder {
 
             bool Default(const Core::Messaging::Metadata& control) const override;
             void Push(const Core::Messaging::MessageInfo& messageInfo, const Core::Messaging::IEvent* message) override;
+            void Flush();
 
         private:
             uint16_t Serialize(uint8_t* buffer, const uint16_t length, const string& module);
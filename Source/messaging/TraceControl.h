@@ -51,7 +51,7 @@
                 __LINE__,                                                               \
                 Thunder::Core::ClassNameOnly(typeid(*this).name()).Text()               \
             );                                                                          \
-            Thunder::Core::Messaging::TextMessage __message__(__data__.Data());         \
+            Thunder::Core::Messaging::TextMessage __message__(__data__);                \
             Thunder::Messaging::MessageUnit::Instance().Push(__trace__, &__message__);  \
         }                                                                               \
     } while(false)
@@ -71,7 +71,7 @@
                 __LINE__,                                                               \
                 __FUNCTION__                                                            \
             );                                                                          \
-            Thunder::Core::Messaging::TextMessage __message__(__data__.Data());         \
+            Thunder::Core::Messaging::TextMessage __message__(__data__);                \
             Thunder::Messaging::MessageUnit::Instance().Push(__trace__, &__message__);  \
         }                                                                               \
     } while(false)
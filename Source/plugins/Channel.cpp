@@ -33,6 +33,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         , _deserializer(*this)
         , _text()
         , _offset(0)
+        , _sending(false)
         , _sendQueue()
     {
     }
@@ -111,15 +111,17 @@ namespace PluginHost {
                 }
 
                 if (_current.IsValid() == true) {
-                    loaded = _current->Serialize(stream, length, _offset);
+                    loaded = static_cast<uint16_t>(_current->Serialize(stream, static_cast<uint32_t>(length), _offset));
                     if ( (_offset == 0) || (loaded != length) ) {
                         _current.Release();
                     }
 #if THUNDER_PERFORMANCE
                     else {
 			Core::ProxyType<const TrackingJSONRPC> tracking(_current);
-                        ASSERT (tracking.IsValid() == true);
-                        const_cast<TrackingJSONRPC&>(*tracking).Out(loaded);
+                        // Broadcasted events are not tracked.
+                        if (tracking.IsValid() == true) {
+                            const_cast<TrackingJSONRPC&>(*tracking).Out(loaded);
+                        }
                     }
 #endif
                 }
@@ -164,7 +166,7 @@ namespace PluginHost {
                     }
                 } 
                 if (_current.IsValid() == true) {
-                    loaded = _current->Deserialize(stream, length, _offset);
+                    loaded = static_cast<uint16_t>(_current->Deserialize(stream, length, _offset));
 #if THUNDER_PERFORMANCE
 		    Core::ProxyType<TrackingJSONRPC> tracking (_current);
                     ASSERT (tracking.IsValid() == true);
@@ -436,6 +438,33 @@ POP_WARNING()
         {
             return ((BaseClass::IsWebSocket() == false) || ((_serializer.IsIdle() == true) && (_deserializer.IsIdle() == true)));
         }
+        // Plain strings are sent straight from the queue, the front one is handed out until
+        // we get asked for the next one.
+        uint32_t SendPayload(const uint8_t*& payload) override
+        {
+            uint32_t length = 0;
+
+            BaseClass::Lock();
+
+            if (_sending == true) {
+                ASSERT(_sendQueue.size() != 0);
+
+                _sendQueue.pop_front();
+                _sending = false;
+            }
+
+            if (((_state & 0xFF) == TEXT) && (_sendQueue.size() != 0) && (_offset == 0)) {
+                const string& text(_sendQueue.front().Text());
+
+                payload = reinterpret_cast<const uint8_t*>(text.c_str());
+                length = static_cast<uint32_t>(text.length());
+                _sending = (length != 0);
+            }
+
+            BaseClass::Unlock();
+
+            return (length);
+        }
         Core::ProxyType<Core::JSON::IElement> Element() {
             Core::ProxyType<Core::JSON::IElement> result;
 
@@ -457,6 +486,7 @@ POP_WARNING()
         DeserializerImpl _deserializer;
         string _text;
         uint32_t _offset;
+        bool _sending;
         std::list<Package> _sendQueue;
 
         // All requests needed by any instance of this webserver are coming from this web server. They are extracted
@@ -350,6 +350,7 @@ namespace Controller {
                 string Configuration /* @opaque @brief Plugin configuration */;
 
                 uint16_t Observers /* @brief Number or observers */;
+                Core::OptionalType<uint32_t> ActivationTime /* @brief Duration of the last activation (in ms) */;
                 Core::OptionalType<uint32_t> ProcessedRequests /* @brief Number of API requests that have been processed by the plugin */;
                 Core::OptionalType<uint32_t> ProcessedObjects /* @brief Number of objects that have been processed by the plugin */;
             };
@@ -23,6 +23,9 @@ namespace Thunder {
 
     namespace PluginHost {
 
+        /* static */ constexpr TCHAR JSONRPC::EventBody::Head[];
+        /* static */ Core::ProxyPoolType<JSONRPC::EventMessage> JSONRPC::_eventMessages(4);
+
         JSONRPC::JSONRPC()
             : _adminLock()
             , _handlers()
@@ -87,6 +87,155 @@ namespace PluginHost {
         };
 
     private:
+        // The part of an event message that is the same for all channels subscribed to
+        // the event. It is encoded once and shared, read-only, by all EventMessages.
+        class EventBody {
+        public:
+            EventBody() = delete;
+            EventBody(EventBody&&) = delete;
+            EventBody(const EventBody&) = delete;
+            EventBody& operator=(EventBody&&) = delete;
+            EventBody& operator=(const EventBody&) = delete;
+
+            EventBody(const string& event, const string& parameters)
+                : _text()
+            {
+                _text.reserve(event.length() + parameters.length() + 16);
+                _text += '.';
+                _text += Escaped(event);
+                _text += '\"';
+
+                if (parameters.empty() == false) {
+                    _text += _T(",\"params\":");
+                    _text += parameters;
+                }
+
+                _text += '}';
+            }
+            ~EventBody() = default;
+
+        public:
+            // Everything up to the designator, equal for all event messages.
+            static constexpr TCHAR Head[] = _T("{\"jsonrpc\":\"2.0\",\"method\":\"");
+
+            const string& Text() const
+            {
+                return (_text);
+            }
+
+            static string Escaped(const string& text)
+            {
+                string result;
+                string::const_iterator index(text.begin());
+
+                while ((index != text.end()) && (::isprint(static_cast<uint8_t>(*index))) && (*index != '\"') && (*index != '\\') && (*index != '/')) {
+                    index++;
+                }
+
+                if (index == text.end()) {
+                    result = text;
+                }
+                else {
+                    Core::JSON::String encoder;
+                    encoder = text;
+                    encoder.ToString(result);
+
+                    // Drop the quotes, the text is embedded in the method name.
+                    result = result.substr(1, result.length() - 2);
+                }
+
+                return (result);
+            }
+
+        private:
+            string _text;
+        };
+
+        // The event message for a single channel: the Head, the designator of the channel
+        // and the shared EventBody, written back to back.
+        class EventMessage : public Core::JSON::IElement {
+        public:
+            EventMessage(EventMessage&&) = delete;
+            EventMessage(const EventMessage&) = delete;
+            EventMessage& operator=(EventMessage&&) = delete;
+            EventMessage& operator=(const EventMessage&) = delete;
+
+            EventMessage()
+                : _designator()
+                , _body()
+            {
+            }
+            ~EventMessage() override = default;
+
+        public:
+            void Set(const string& designator, const Core::ProxyType<const EventBody>& body)
+            {
+                _designator = EventBody::Escaped(designator);
+                _body = body;
+            }
+
+            // IElement iface:
+            void Clear() override
+            {
+                _designator.clear();
+
+                if (_body.IsValid() == true) {
+                    _body.Release();
+                }
+            }
+            bool IsSet() const override
+            {
+                return (_body.IsValid());
+            }
+            bool IsNull() const override
+            {
+                return (false);
+            }
+            uint32_t Serialize(char stream[], const uint32_t maxLength, uint32_t& offset) const override
+            {
+                ASSERT(_body.IsValid() == true);
+
+                const TCHAR* parts[] = { EventBody::Head, _designator.c_str(), _body->Text().c_str() };
+                const uint32_t lengths[] = { static_cast<uint32_t>(sizeof(EventBody::Head) - 1), static_cast<uint32_t>(_designator.length()), static_cast<uint32_t>(_body->Text().length()) };
+
+                uint32_t skip = offset;
+                uint32_t loaded = 0;
+
+                for (uint8_t part = 0; (part < (sizeof(lengths) / sizeof(lengths[0]))) && (loaded < maxLength); part++) {
+                    if (skip >= lengths[part]) {
+                        skip -= lengths[part];
+                    }
+                    else {
+                        const uint32_t size = std::min(lengths[part] - skip, maxLength - loaded);
+
+                        ::memcpy(&(stream[loaded]), &(parts[part][skip]), size);
+                        loaded += size;
+                        skip = 0;
+                    }
+                }
+
+                offset += loaded;
+
+                if (offset == (lengths[0] + lengths[1] + lengths[2])) {
+                    offset = 0;
+                }
+
+                return (loaded);
+            }
+            uint32_t Deserialize(const char[], const uint32_t, uint32_t& offset, Core::OptionalType<Core::JSON::Error>& error) override
+            {
+                // Event messages are only sent, never received.
+                error = Core::JSON::Error{ "Event messages can not be deserialized." };
+                offset = 0;
+
+                return (0);
+            }
+
+        private:
+            string _designator;
+            Core::ProxyType<const EventBody> _body;
+        };
+
         class Observer {
         private:
             class Destination {
@@ -293,12 +442,18 @@ namespace PluginHost {
             void Event(JSONRPC& parent, const string event, const string& parameter, const SendIfMethod& sendifmethod) {
                 Destinations::iterator index(_designators.begin());
 
+                // Encoded on the first channel that needs it, and shared by all that follow.
+                Core::ProxyType<const EventBody> body;
+
                 while (index != _designators.end()) {
                     Destination& entry = (*index);
 
                     if (!sendifmethod || sendifmethod(entry.Designator())) {
                         if (entry.Callback() == nullptr) {
-                            parent.Notify(entry.ChannelId(), entry.Designator() + '.' + event, parameter);
+                            if (body.IsValid() == false) {
+                                body = Core::ProxyType<const EventBody>(Core::ProxyType<EventBody>::Create(event, parameter));
+                            }
+                            parent.Notify(entry.ChannelId(), entry.Designator(), body);
                         }
                         else {
                             entry.Callback()->Event(event, entry.Designator(), parameter);
@@ -992,18 +1147,13 @@ namespace PluginHost {
 
             return (result);
         }
-        void Notify(const uint32_t channelId, const string& designator, const string& parameters)
+        void Notify(const uint32_t channelId, const string& designator, const Core::ProxyType<const EventBody>& body)
         {
-            Core::ProxyType<Core::JSONRPC::Message> message(Core::ProxyType<Core::JSONRPC::Message>(IFactories::Instance().JSONRPC()));
+            Core::ProxyType<EventMessage> message(_eventMessages.Element());
 
             ASSERT(_service != nullptr);
 
-            if (!parameters.empty()) {
-                message->Parameters = parameters;
-            }
-
-            message->Designator = designator;
-            message->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+            message->Set(designator, body);
 
             _service->Submit(channelId, Core::ProxyType<Core::JSON::IElement>(message));
         }
@@ -1018,6 +1168,8 @@ namespace PluginHost {
         mutable ObserverMap _observers;
         EventAliasesMap _eventAliases;
         Core::SinkType<Notification> _notification;
+
+        static Core::ProxyPoolType<EventMessage> _eventMessages;
     };
 
     class EXTERNAL JSONRPCSupportsEventStatus : virtual public PluginHost::JSONRPC {
@@ -85,6 +85,7 @@ namespace PluginHost
         , ProcessedObjects(0)
 #endif
         , Observers(0)
+        , ActivationTime(0)
         , ServiceVersion()
         , Module()
         , InterfaceVersion()
@@ -95,6 +96,7 @@ namespace PluginHost
         Add(_T("processedobjects"), &ProcessedObjects);
 #endif
         Add(_T("observers"), &Observers);
+        Add(_T("activationtime"), &ActivationTime);
         Add(_T("module"), &Module);
         Add(_T("version"), &ServiceVersion);
         Add(_T("interface"), &InterfaceVersion);
@@ -107,6 +109,7 @@ namespace PluginHost
         , ProcessedObjects(std::move(move.ProcessedObjects))
 #endif
         , Observers(std::move(move.Observers))
+        , ActivationTime(std::move(move.ActivationTime))
         , ServiceVersion(std::move(move.ServiceVersion))
         , Module(std::move(move.Module))
         , InterfaceVersion(std::move(move.InterfaceVersion))
@@ -117,6 +120,7 @@ namespace PluginHost
         Add(_T("processedobjects"), &ProcessedObjects);
 #endif
         Add(_T("observers"), &Observers);
+        Add(_T("activationtime"), &ActivationTime);
         Add(_T("module"), &Module);
         Add(_T("version"), &ServiceVersion);
 
@@ -130,6 +134,7 @@ namespace PluginHost
         , ProcessedObjects(copy.ProcessedObjects)
 #endif
         , Observers(copy.Observers)
+        , ActivationTime(copy.ActivationTime)
         , ServiceVersion(copy.ServiceVersion)
         , Module(copy.Module)
         , InterfaceVersion(copy.InterfaceVersion)
@@ -140,6 +145,7 @@ namespace PluginHost
         Add(_T("processedobjects"), &ProcessedObjects);
 #endif
         Add(_T("observers"), &Observers);
+        Add(_T("activationtime"), &ActivationTime);
         Add(_T("module"), &Module);
         Add(_T("version"), &ServiceVersion);
 
@@ -152,6 +158,108 @@ namespace PluginHost
         return (*this);
     }
 
+    Metadata::Channel::Compression::Compression()
+        : Core::JSON::Container()
+        , MessagesOut(0)
+        , RawOut(0)
+        , DeflatedOut(0)
+        , DeflateTime(0)
+        , MessagesIn(0)
+        , DeflatedIn(0)
+        , RawIn(0)
+        , InflateTime(0)
+    {
+        Add(_T("messagesout"), &MessagesOut);
+        Add(_T("rawout"), &RawOut);
+        Add(_T("deflatedout"), &DeflatedOut);
+        Add(_T("deflatetime"), &DeflateTime);
+        Add(_T("messagesin"), &MessagesIn);
+        Add(_T("deflatedin"), &DeflatedIn);
+        Add(_T("rawin"), &RawIn);
+        Add(_T("inflatetime"), &InflateTime);
+    }
+    Metadata::Channel::Compression::Compression(Compression&& move)
+        : Core::JSON::Container()
+        , MessagesOut(std::move(move.MessagesOut))
+        , RawOut(std::move(move.RawOut))
+        , DeflatedOut(std::move(move.DeflatedOut))
+        , DeflateTime(std::move(move.DeflateTime))
+        , MessagesIn(std::move(move.MessagesIn))
+        , DeflatedIn(std::move(move.DeflatedIn))
+        , RawIn(std::move(move.RawIn))
+        , InflateTime(std::move(move.InflateTime))
+    {
+        Add(_T("messagesout"), &MessagesOut);
+        Add(_T("rawout"), &RawOut);
+        Add(_T("deflatedout"), &DeflatedOut);
+        Add(_T("deflatetime"), &DeflateTime);
+        Add(_T("messagesin"), &MessagesIn);
+        Add(_T("deflatedin"), &DeflatedIn);
+        Add(_T("rawin"), &RawIn);
+        Add(_T("inflatetime"), &InflateTime);
+    }
+    Metadata::Channel::Compression::Compression(const Compression& copy)
+        : Core::JSON::Container()
+        , MessagesOut(copy.MessagesOut)
+        , RawOut(copy.RawOut)
+        , DeflatedOut(copy.DeflatedOut)
+        , DeflateTime(copy.DeflateTime)
+        , MessagesIn(copy.MessagesIn)
+        , DeflatedIn(copy.DeflatedIn)
+        , RawIn(copy.RawIn)
+        , InflateTime(copy.InflateTime)
+    {
+        Add(_T("messagesout"), &MessagesOut);
+        Add(_T("rawout"), &RawOut);
+        Add(_T("deflatedout"), &DeflatedOut);
+        Add(_T("deflatetime"), &DeflateTime);
+        Add(_T("messagesin"), &MessagesIn);
+        Add(_T("deflatedin"), &DeflatedIn);
+        Add(_T("rawin"), &RawIn);
+        Add(_T("inflatetime"), &InflateTime);
+    }
+    Metadata::Channel::Compression& Metadata::Channel::Compression::operator=(Compression&& move)
+    {
+        if (this != &move) {
+            MessagesOut = std::move(move.MessagesOut);
+            RawOut = std::move(move.RawOut);
+            DeflatedOut = std::move(move.DeflatedOut);
+            DeflateTime = std::move(move.DeflateTime);
+            MessagesIn = std::move(move.MessagesIn);
+            DeflatedIn = std::move(move.DeflatedIn);
+            RawIn = std::move(move.RawIn);
+            InflateTime = std::move(move.InflateTime);
+        }
+
+        return (*this);
+    }
+    Metadata::Channel::Compression& Metadata::Channel::Compression::operator=(const Compression& RHS)
+    {
+        MessagesOut = RHS.MessagesOut;
+        RawOut = RHS.RawOut;
+        DeflatedOut = RHS.DeflatedOut;
+        DeflateTime = RHS.DeflateTime;
+        MessagesIn = RHS.MessagesIn;
+        DeflatedIn = RHS.DeflatedIn;
+        RawIn = RHS.RawIn;
+        InflateTime = RHS.InflateTime;
+
+        return (*this);
+    }
+    Metadata::Channel::Compression& Metadata::Channel::Compression::operator=(const Web::WebSocket::Deflate::Statistics& RHS)
+    {
+        MessagesOut = RHS.messagesOut;
+        RawOut = RHS.rawOut;
+        DeflatedOut = RHS.deflatedOut;
+        DeflateTime = RHS.ticksOut;
+        MessagesIn = RHS.messagesIn;
+        DeflatedIn = RHS.deflatedIn;
+        RawIn = RHS.rawIn;
+        InflateTime = RHS.ticksIn;
+
+        return (*this);
+    }
+
     Metadata::Channel::Channel()
         : Core::JSON::Container()
     {
@@ -160,6 +268,7 @@ namespace PluginHost
         Core::JSON::Container::Add(_T("activity"), &Activity);
         Core::JSON::Container::Add(_T("id"), &ID);
         Core::JSON::Container::Add(_T("name"), &Name);
+        Core::JSON::Container::Add(_T("deflate"), &Deflate);
     }
     Metadata::Channel::Channel(Metadata::Channel&& move)
         : Core::JSON::Container()
@@ -168,12 +277,14 @@ namespace PluginHost
         , Activity(std::move(move.Activity))
         , ID(std::move(move.ID))
         , Name(std::move(move.Name))
+        , Deflate(std::move(move.Deflate))
     {
         Core::JSON::Container::Add(_T("remote"), &Remote);
         Core::JSON::Container::Add(_T("state"), &State);
         Core::JSON::Container::Add(_T("activity"), &Activity);
         Core::JSON::Container::Add(_T("id"), &ID);
         Core::JSON::Container::Add(_T("name"), &Name);
+        Core::JSON::Container::Add(_T("deflate"), &Deflate);
     }
     Metadata::Channel::Channel(const Metadata::Channel& copy)
         : Core::JSON::Container()
@@ -182,12 +293,14 @@ namespace PluginHost
         , Activity(copy.Activity)
         , ID(copy.ID)
         , Name(copy.Name)
+        , Deflate(copy.Deflate)
     {
         Core::JSON::Container::Add(_T("remote"), &Remote);
         Core::JSON::Container::Add(_T("state"), &State);
         Core::JSON::Container::Add(_T("activity"), &Activity);
         Core::JSON::Container::Add(_T("id"), &ID);
         Core::JSON::Container::Add(_T("name"), &Name);
+        Core::JSON::Container::Add(_T("deflate"), &Deflate);
     }
 
     Metadata::Channel& Metadata::Channel::operator=(Metadata::Channel&& move)
@@ -198,6 +311,7 @@ namespace PluginHost
             Activity = std::move(move.Activity);
             ID = std::move(move.ID);
             Name = std::move(move.Name);
+            Deflate = std::move(move.Deflate);
         }
 
         return (*this);
@@ -209,6 +323,7 @@ namespace PluginHost
         Activity = RHS.Activity;
         ID = RHS.ID;
         Name = RHS.Name;
+        Deflate = RHS.Deflate;
 
         return (*this);
     }
@@ -253,13 +368,43 @@ namespace PluginHost
         return (*this);
     }
 
+    Metadata::Server::Reactor::Reactor()
+        : Core::JSON::Container()
+        , Id()
+        , Resources(0)
+        , Runs(0) {
+        Add(_T("id"), &Id);
+        Add(_T("resources"), &Resources);
+        Add(_T("runs"), &Runs);
+    }
+    Metadata::Server::Reactor::Reactor(Reactor&& move)
+        : Core::JSON::Container()
+        , Id(std::move(move.Id))
+        , Resources(std::move(move.Resources))
+        , Runs(std::move(move.Runs)) {
+        Add(_T("id"), &Id);
+        Add(_T("resources"), &Resources);
+        Add(_T("runs"), &Runs);
+    }
+    Metadata::Server::Reactor::Reactor(const Reactor& copy)
+        : Core::JSON::Container()
+        , Id(copy.Id)
+        , Resources(copy.Resources)
+        , Runs(copy.Runs) {
+        Add(_T("id"), &Id);
+        Add(_T("resources"), &Resources);
+        Add(_T("runs"), &Runs);
+    }
+
     Metadata::Server::Server()
         : Core::JSON::Container()
         , ThreadPoolRuns()
         , PendingRequests()
+        , Reactors()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
         Core::JSON::Container::Add(_T("pending"), &PendingRequests);
+        Core::JSON::Container::Add(_T("reactors"), &Reactors);
     }
 
     Metadata::Metadata()
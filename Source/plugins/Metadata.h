@@ -84,6 +84,10 @@ namespace PluginHost {
                 result.Version = ServiceVersion;
                 result.Observers = Observers;
 
+                if (ActivationTime.IsSet() == true) {
+                    result.ActivationTime = ActivationTime.Value();
+                }
+
 #if THUNDER_RUNTIME_STATISTICS
                 result.ProcessedRequests = meta.ProcessedRequests;
                 result.ProcessedObjects = meta.ProcessedObjects;
@@ -101,6 +105,7 @@ namespace PluginHost {
             Core::JSON::DecUInt32 ProcessedObjects;
 #endif
             Core::JSON::DecUInt32 Observers;
+            Core::JSON::DecUInt32 ActivationTime;
             Version ServiceVersion;
             Core::JSON::String Module;
             Core::JSON::ArrayType<Core::JSON::String> InterfaceVersion;
@@ -109,6 +114,30 @@ namespace PluginHost {
         public:
             using state = Exchange::Controller::IMetadata::Data::Link::state;
 
+            // permessage-deflate counters of a websocket link, times in uS.
+            class EXTERNAL Compression : public Core::JSON::Container {
+            public:
+                Compression();
+                Compression(Compression&& move);
+                Compression(const Compression& copy);
+                ~Compression() override = default;
+
+                Compression& operator=(Compression&& move);
+                Compression& operator=(const Compression& RHS);
+                Compression& operator=(const Web::WebSocket::Deflate::Statistics& RHS);
+
+            public:
+                Core::JSON::DecUInt32 MessagesOut;
+                Core::JSON::DecUInt64 RawOut;
+                Core::JSON::DecUInt64 DeflatedOut;
+                Core::JSON::DecUInt64 DeflateTime;
+                Core::JSON::DecUInt32 MessagesIn;
+                Core::JSON::DecUInt64 DeflatedIn;
+                Core::JSON::DecUInt64 RawIn;
+                Core::JSON::DecUInt64 InflateTime;
+            };
+
+        public:
             Channel();
             Channel(Channel&& move);
             Channel(const Channel& copy);
@@ -123,6 +152,7 @@ namespace PluginHost {
             Core::JSON::Boolean Activity;
             Core::JSON::DecUInt32 ID;
             Core::JSON::String Name;
+            Compression Deflate;
         };
         class EXTERNAL Server : public Core::JSON::Container {
         public:
@@ -143,6 +173,21 @@ namespace PluginHost {
                 Core::JSON::String     Job;
                 Core::JSON::DecUInt32  Runs;
             };
+            class EXTERNAL Reactor : public Core::JSON::Container {
+            public:
+                Reactor& operator=(Reactor&&) = delete;
+                Reactor& operator=(const Reactor&) = delete;
+
+                Reactor();
+                Reactor(Reactor&& move);
+                Reactor(const Reactor& copy);
+                ~Reactor() override = default;
+
+            public:
+                Core::JSON::InstanceId Id;
+                Core::JSON::DecUInt32  Resources;
+                Core::JSON::DecUInt32  Runs;
+            };
 
         public:
             Server(Server&&) = delete;
@@ -157,11 +202,13 @@ namespace PluginHost {
             {
                 ThreadPoolRuns.Clear();
                 PendingRequests.Clear();
+                Reactors.Clear();
             }
 
         public:
             Core::JSON::ArrayType<Minion> ThreadPoolRuns;
             Core::JSON::ArrayType<Core::JSON::String> PendingRequests;
+            Core::JSON::ArrayType<Reactor> Reactors;
         };
         class EXTERNAL SubSystem : public Core::JSON::Container {
         private:
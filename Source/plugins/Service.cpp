@@ -76,34 +76,184 @@ namespace PluginHost {
         _notifierLock.Unlock();
     }
 
-    void Service::FileToServe(const string& webServiceRequest, Web::Response& response, const bool allowUnsafePath)
+    static string EntityTag(const Core::File& file)
+    {
+        // Strong, as long as a file is not changed twice within the same microsecond, without a change in size.
+        return (Core::Format(_T("\"%" PRIx64 "-%" PRIx64 "\""), file.ModificationTime().Ticks(), file.Size()));
+    }
+
+    bool Service::WebAssets::Get(const string& path, Asset& asset)
+    {
+        bool result = false;
+
+        _lock.Lock();
+
+        if (_changed.exchange(false) == true) {
+            _assets.clear();
+        }
+
+        Assets::const_iterator index(_assets.find(path));
+
+        if (index != _assets.end()) {
+            asset = index->second;
+            result = true;
+        }
+
+        _lock.Unlock();
+
+        return (result);
+    }
+
+    void Service::WebAssets::Add(const string& path, const Asset& asset)
+    {
+        const string directory(asset.File.PathName());
+
+        _lock.Lock();
+
+        bool watched = (std::find(_directories.begin(), _directories.end(), directory) != _directories.end());
+
+        if ((watched == false) && (Core::FileSystemMonitor::Instance().Register(this, directory) == true)) {
+            _directories.push_back(directory);
+            watched = true;
+        }
+
+        // Without a watch, there is no telling when it is outdated.
+        if (watched == true) {
+            if ((_assets.size() >= MaxAssets) && (_assets.find(path) == _assets.end())) {
+                // Any entry will do, a lookup that misses only costs a few system calls.
+                _assets.erase(_assets.begin());
+            }
+
+            _assets.emplace(std::piecewise_construct,
+                std::forward_as_tuple(path),
+                std::forward_as_tuple(asset));
+        }
+
+        _lock.Unlock();
+    }
+
+    void Service::WebAssets::Clear()
     {
-        Web::MIMETypes result;
+        _lock.Lock();
+
+        for (const string& directory : _directories) {
+            Core::FileSystemMonitor::Instance().Unregister(this, directory);
+        }
+
+        _directories.clear();
+        _assets.clear();
+        _changed = false;
+
+        _lock.Unlock();
+    }
+
+    bool Service::Locate(const string& webServiceRequest, WebAssets::Asset& asset, const bool allowUnsafePath)
+    {
+        bool result = true;
+        Web::MIMETypes type;
         Web::EncodingTypes encoding = Web::ENCODING_UNKNOWN;
         uint16_t offset = static_cast<uint16_t>(_config.WebPrefix().length()) + (_webURLPath.empty() ? 1 : static_cast<uint16_t>(_webURLPath.length()) + 2);
         string fileToService = _webServerFilePath;
-        if ((webServiceRequest.length() <= offset) || (Web::MIMETypeAndEncodingForFile(webServiceRequest.substr(offset, -1), fileToService, result, encoding) == false)) {
-            Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
+        string key;
 
+        if ((webServiceRequest.length() <= offset) || (Web::MIMETypeAndEncodingForFile(webServiceRequest.substr(offset, -1), fileToService, type, encoding) == false)) {
             // No filename gives, be default, we go for the index.html page..
-            *fileBody = fileToService + _T("index.html");
-            response.ContentType = Web::MIME_HTML;
-            response.Body<Web::FileBody>(fileBody);
+            fileToService += _T("index.html");
+            type = Web::MIME_HTML;
+            encoding = Web::ENCODING_UNKNOWN;
+            key = fileToService;
         } else {
             ASSERT(fileToService.length() >= _webServerFilePath.length());
-            string normalizedPath = Core::File::Normalize(fileToService.substr(_webServerFilePath.length()), !allowUnsafePath);
 
-            if (normalizedPath.empty() == false) {
+            const string normalized(Core::File::Normalize(fileToService.substr(_webServerFilePath.length()), !allowUnsafePath));
+
+            result = (normalized.empty() == false);
+
+            // All the ways to spell the path to the same file, share an entry.
+            key = _webServerFilePath + normalized;
+        }
+
+        // Unsafe paths resolve differently, these are not kept.
+        if ((result == true) && ((allowUnsafePath == true) || (_assets.Get(key, asset) == false))) {
+            asset.File = fileToService;
+            asset.ContentType = type;
+            asset.Encoding = encoding;
+
+            if (asset.File.Exists() == true) {
+                asset.Tag = EntityTag(asset.File);
+
+                if (encoding == Web::ENCODING_UNKNOWN) {
+                    asset.Compressed = fileToService + _T(".gz");
+
+                    if (asset.Compressed.Exists() == true) {
+                        asset.CompressedTag = EntityTag(asset.Compressed);
+                    }
+                }
+
+                if (allowUnsafePath == false) {
+                    _assets.Add(key, asset);
+                }
+            }
+        }
+
+        return (result);
+    }
+
+    void Service::FileToServe(const string& webServiceRequest, Web::Response& response, const bool allowUnsafePath)
+    {
+        WebAssets::Asset asset;
+
+        if (Locate(webServiceRequest, asset, allowUnsafePath) == true) {
+            Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
+
+            *fileBody = asset.File;
+            response.ContentType = asset.ContentType;
+            if (asset.Encoding != Web::ENCODING_UNKNOWN) {
+                response.ContentEncoding = asset.Encoding;
+            }
+            response.Body<Web::FileBody>(fileBody);
+        } else {
+            response.ErrorCode = Web::STATUS_BAD_REQUEST;
+            response.Message = "Invalid Request";
+        }
+    }
+
+    void Service::FileToServe(const Web::Request& request, Web::Response& response, const bool allowUnsafePath)
+    {
+        WebAssets::Asset asset;
+
+        if (Locate(request.Path, asset, allowUnsafePath) == false) {
+            response.ErrorCode = Web::STATUS_BAD_REQUEST;
+            response.Message = "Invalid Request";
+        } else {
+            const bool compressed = ((asset.Compressed.Exists() == true) && (request.AcceptEncoding.IsSet() == true) && (request.AcceptEncoding.Value() == Web::ENCODING_GZIP));
+            const Core::File& file(compressed == true ? asset.Compressed : asset.File);
+            const string& tag(compressed == true ? asset.CompressedTag : asset.Tag);
+            const Web::EncodingTypes encoding(compressed == true ? Web::ENCODING_GZIP : asset.Encoding);
+
+            response.ContentType = asset.ContentType;
+
+            if (asset.Compressed.Exists() == true) {
+                // What is sent depends on the Accept-Encoding, caches in between should know.
+                response.Vary = _T("Accept-Encoding");
+            }
+
+            if (file.Exists() == true) {
+                response.ETag = tag;
+                response.Modified = file.ModificationTime();
+            }
+
+            if ((file.Exists() == true) && (request.IsModified(tag, file.ModificationTime()) == false)) {
+                response.ErrorCode = Web::STATUS_NOT_MODIFIED;
+                response.Message = _T("Not Modified");
+            } else {
                 Core::ProxyType<Web::FileBody> fileBody(IFactories::Instance().FileBody());
-                *fileBody = fileToService;
-                response.ContentType = result;
+
+                *fileBody = file;
                 if (encoding != Web::ENCODING_UNKNOWN) {
                     response.ContentEncoding = encoding;
                 }
                 response.Body<Web::FileBody>(fileBody);
-            } else {
-                response.ErrorCode = Web::STATUS_BAD_REQUEST;
-                response.Message = "Invalid Request";
             }
         }
     }
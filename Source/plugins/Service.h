@@ -148,6 +148,97 @@ namespace PluginHost {
             std::list<uint8_t> _versions;
         };
 
+        // Files served by the web server of this service, keyed on their normalized path. What is needed
+        // to serve them is kept until anything changes in the directories they are in, for at most
+        // MaxAssets files.
+        class EXTERNAL WebAssets : public Core::FileSystemMonitor::ICallback {
+        public:
+            class Asset {
+            public:
+                Asset()
+                    : File()
+                    , ContentType(Web::MIME_UNKNOWN)
+                    , Encoding(Web::ENCODING_UNKNOWN)
+                    , Tag()
+                    , Compressed()
+                    , CompressedTag()
+                {
+                }
+                Asset(const Asset& copy)
+                    : File(copy.File)
+                    , ContentType(copy.ContentType)
+                    , Encoding(copy.Encoding)
+                    , Tag(copy.Tag)
+                    , Compressed(copy.Compressed)
+                    , CompressedTag(copy.CompressedTag)
+                {
+                }
+                Asset& operator=(const Asset& RHS)
+                {
+                    File = RHS.File;
+                    ContentType = RHS.ContentType;
+                    Encoding = RHS.Encoding;
+                    Tag = RHS.Tag;
+                    Compressed = RHS.Compressed;
+                    CompressedTag = RHS.CompressedTag;
+
+                    return (*this);
+                }
+                ~Asset() = default;
+
+            public:
+                Core::File File;
+                Web::MIMETypes ContentType;
+                Web::EncodingTypes Encoding;
+                string Tag;
+
+                // A gzipped copy of the file next to it (<file>.gz), served if the client accepts it.
+                Core::File Compressed;
+                string CompressedTag;
+            };
+
+        private:
+            using Assets = std::unordered_map<string, Asset>;
+
+        public:
+            static constexpr uint16_t MaxAssets = 256;
+
+            WebAssets(WebAssets&&) = delete;
+            WebAssets(const WebAssets&) = delete;
+            WebAssets& operator=(WebAssets&&) = delete;
+            WebAssets& operator=(const WebAssets&) = delete;
+
+            WebAssets()
+                : _lock()
+                , _changed(false)
+                , _assets()
+                , _directories()
+            {
+            }
+            ~WebAssets() override
+            {
+                Clear();
+            }
+
+        public:
+            bool Get(const string& path, Asset& asset);
+            void Add(const string& path, const Asset& asset);
+            void Clear();
+
+        private:
+            // Called from the monitor, with its lock taken, so only flag it here.
+            void Updated() override
+            {
+                _changed = true;
+            }
+
+        private:
+            Core::CriticalSection _lock;
+            std::atomic<bool> _changed;
+            Assets _assets;
+            std::list<string> _directories;
+        };
+
     public:
         // This object is created by the instance that instantiates the plugins. As the lifetime
         // of this object is controlled by the server, instantiating this object, do not allow
@@ -164,6 +255,7 @@ namespace PluginHost {
             #endif
             , _state(DEACTIVATED)
             , _config(plugin, webPrefix, persistentPath, dataPath, volatilePath)
+            , _assets()
             , _notifiers()
         {
             if ( (plugin.StartMode.IsSet() == true) && (plugin.StartMode.Value() == PluginHost::IShell::startmode::UNAVAILABLE) ) {
@@ -281,6 +373,7 @@ namespace PluginHost {
             // The postFixURL should *NOT* contain a starting or trailing slash!!!
             // We signal the request to service web files via a non-empty _webServerFilePath.
             _webURLPath = postFixURL;
+            _assets.Clear();
 
             if (fileRootPath.empty() == true) {
                 _webServerFilePath = _config.DataPath() + postFixURL + '/';
@@ -296,6 +389,7 @@ namespace PluginHost {
             // We signal the request to ervice web files via a non-empty _webServerFilePath.
             _webServerFilePath.clear();
             _webURLPath.clear();
+            _assets.Clear();
         }
 
         inline const Plugin::Config& Configuration() const
@@ -411,6 +505,13 @@ namespace PluginHost {
 
         void FileToServe(const string& webServiceRequest, Web::Response& response, bool allowUnsafePath);
 
+        // Also answers conditional requests (If-None-Match/If-Modified-Since) with a 304 and serves
+        // the gzipped copy of a file, if there is one and the client accepts it.
+        void FileToServe(const Web::Request& request, Web::Response& response, bool allowUnsafePath);
+
+    private:
+        bool Locate(const string& webServiceRequest, WebAssets::Asset& asset, bool allowUnsafePath);
+
     private:
         mutable Core::CriticalSection _adminLock;
 
@@ -429,6 +530,7 @@ namespace PluginHost {
         // contain the URL path and the start of the path location on disk.
         string _webURLPath;
         string _webServerFilePath;
+        WebAssets _assets;
 
         // Keep track of people who want to be notified of changes.
         Channels _notifiers;
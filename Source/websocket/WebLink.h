@@ -93,6 +93,10 @@ namespace Web {
                     _lock.Unlock();
                 }
             }
+            bool Splice(const Core::File::Handle file, const uint64_t offset, const uint32_t length) override
+            {
+                return (_parent.Splice(file, offset, length));
+            }
 
         private:
             ThisClass& _parent;
@@ -193,15 +197,25 @@ namespace Web {
                 return (*this);
             }
             // Methods to extract and insert data into the socket buffers
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            // The web serializers work in frames of at most 64KB.
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 _activity = true;
-                return (_parent.SendData( dataFrame, maxSendSize));
+                return (_parent.SendData(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
+                uint32_t result = 0;
+                uint16_t handled;
+
                 _activity = true;
-                return (_parent.ReceiveData(dataFrame, receivedSize));
+
+                do {
+                    handled = _parent.ReceiveData(&(dataFrame[result]), static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF))));
+                    result += handled;
+                } while ((handled != 0) && (result < receivedSize));
+
+                return (result);
             }
             // Signal a state change, Opened, Closed or Accepted
             void StateChange() override
@@ -351,6 +365,31 @@ POP_WARNING()
             return (_serializerImpl.Serialize(dataFrame, receivedSize));
         }
 
+        // A transformed body has to pass through the transformation, otherwise a file body can be sent
+        // by the kernel, if the link is a plain socket.
+        template <typename CLASSNAME = TRANSFORM>
+        inline typename Core::TypeTraits::enable_if<hasTransform<CLASSNAME, uint16_t, BaseSerializer&, uint8_t*, const uint16_t>::value, bool>::type
+        Splice(const Core::File::Handle, const uint64_t, const uint32_t)
+        {
+            return (false);
+        }
+
+        template <typename CLASSNAME = TRANSFORM>
+        inline typename Core::TypeTraits::enable_if<!hasTransform<CLASSNAME, uint16_t, BaseSerializer&, uint8_t*, const uint16_t>::value, bool>::type
+        Splice(const Core::File::Handle file, const uint64_t offset, const uint32_t length)
+        {
+            return (Splice(file, offset, length, TemplateIntToType<Core::TypeTraits::same_or_inherits<Core::SocketPort, LINK>::value>()));
+        }
+
+        bool Splice(const Core::File::Handle file, const uint64_t offset, const uint32_t length, const TemplateIntToType<true>&)
+        {
+            return (_channel.Link().Splice(file, offset, length));
+        }
+        bool Splice(const Core::File::Handle, const uint64_t, const uint32_t, const TemplateIntToType<false>&)
+        {
+            return (false);
+        }
+
     private:
         SerializerImpl _serializerImpl;
         DeserializerImpl _deserialiserImpl;
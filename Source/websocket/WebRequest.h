@@ -95,8 +95,55 @@ namespace Web {
         virtual void End() const = 0;
 
         // The Serialize and Deserialize methods allow the content to be serialized/deserialized.
-        virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */) const = 0;
-        virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */) = 0;
+        // Implement the pair taking 32 bits lengths, so a body held in memory can be handed over in
+        // one pass. The pair taking 16 bits lengths is deprecated, if that is the one implemented, it
+        // is fed in windows of at most 64KB.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        virtual uint32_t Serialize(uint8_t stream[], const uint32_t maxLength) const
+        {
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t loaded;
+
+            do {
+                window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                loaded = Serialize(&(stream[result]), window);
+                result += loaded;
+            } while ((loaded == window) && (result < maxLength));
+
+            return (result);
+        }
+        virtual uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength)
+        {
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t loaded;
+
+            do {
+                window = static_cast<uint16_t>(std::min(maxLength - result, static_cast<uint32_t>(0xFFFF)));
+                loaded = Deserialize(&(stream[result]), window);
+                result += loaded;
+            } while ((loaded == window) && (result < maxLength));
+
+            return (result);
+        }
+        DEPRECATED virtual uint16_t Serialize(uint8_t stream[], const uint16_t maxLength) const
+        {
+            return (static_cast<uint16_t>(Serialize(stream, static_cast<uint32_t>(maxLength))));
+        }
+        DEPRECATED virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
+        {
+            return (static_cast<uint16_t>(Deserialize(stream, static_cast<uint32_t>(maxLength))));
+        }
+POP_WARNING()
+
+        // A body that lives in a file can hand out the file and the position its content starts at,
+        // after Serialize() prepared it, so the link can send it without reading it. Returning false
+        // means the content has to be pulled through Serialize(stream, maxLength).
+        virtual bool Descriptor(Core::File::Handle& /* file */, uint64_t& /* offset */) const
+        {
+            return (false);
+        }
     };
 
     class EXTERNAL Signature {
@@ -283,7 +330,9 @@ namespace Web {
             MAN,
             M_X,
             S_T,
-			AUTHORIZATION
+			AUTHORIZATION,
+            IF_NONE_MATCH,
+            IF_MODIFIED_SINCE
         };
 
         enum type {
@@ -325,7 +374,8 @@ namespace Web {
                 PAIR_KEY = 6,
                 PAIR_VALUE = 7,
                 BODY = 8,
-                REPORT = 9
+                REPORT = 9,
+                SPLICE = 10
             };
             const static uint16_t EOL_MARKER = 0x8000;
 
@@ -349,6 +399,13 @@ namespace Web {
         public:
             virtual void Serialized(const Web::Request& element) = 0;
 
+            // Offered once the headers are serialized, if the body lives in a file. Return true if the
+            // link sends this part of the file itself, right after the bytes serialized so far.
+            virtual bool Splice(const Core::File::Handle /* file */, const uint64_t /* offset */, const uint32_t /* length */)
+            {
+                return (false);
+            }
+
             void Flush()
             {
                 _lock.Lock();
@@ -437,7 +494,22 @@ POP_WARNING()
             {
                 _lock.Lock();
 
-                uint16_t usedSize = _parser.Deserialize(stream, maxLength);
+                uint16_t usedSize = 0;
+
+                // Complete header blocks are scanned in place, partial ones and bodies go through the parser.
+                while ((usedSize < maxLength) && (_state == VERB) && (_parser.IsIdle() == true)) {
+                    uint16_t scanned = Scan(&stream[usedSize], maxLength - usedSize);
+
+                    if (scanned == 0) {
+                        break;
+                    }
+
+                    usedSize += scanned;
+                }
+
+                if (usedSize < maxLength) {
+                    usedSize += _parser.Deserialize(&stream[usedSize], maxLength - usedSize);
+                }
 
                 _lock.Unlock();
 
@@ -461,6 +533,10 @@ POP_WARNING()
             void EndOfLine();
             void EndOfPassThrough();
 
+            uint16_t Scan(const uint8_t stream[], const uint16_t maxLength);
+            void Value(const Core::TextFragment& value);
+            void EndOfHeaders();
+
         private:
             Core::CriticalSection _lock;
             Web::Request* _current;
@@ -499,6 +575,12 @@ POP_WARNING()
         static const TCHAR NOTIFY[];
 
         static const TCHAR* ToString(const type value);
+
+        // Evaluates If-None-Match (weak comparison) or, if that is absent, If-Modified-Since against the
+        // current (quoted) entity tag and modification time of what is requested. If this returns false,
+        // a 304 Not Modified will do.
+        bool IsModified(const string& tag, const Core::Time& modified) const;
+
         static void ToString(const Request& realObject, string& text)
         {
             bool ready = false;
@@ -619,6 +701,8 @@ POP_WARNING()
             MX.Clear();
             ST.Clear();
             WebToken.Clear();
+            IfNoneMatch.Clear();
+            IfModifiedSince.Clear();
 
             if (_body.IsValid() == true) {
                 _body.Release();
@@ -657,6 +741,8 @@ POP_WARNING()
         Core::OptionalType<string> ST;
         Core::OptionalType<uint32_t> MX;
         Core::OptionalType<Authorization> WebToken;
+        Core::OptionalType<string> IfNoneMatch;
+        Core::OptionalType<Core::Time> IfModifiedSince;
 
         inline bool HasBody() const
         {
@@ -95,12 +95,14 @@ namespace Web {
             ALLOW,
             WEBSOCKET_ACCEPT,
             WEBSOCKET_PROTOCOL,
+            WEBSOCKET_EXTENSIONS,
             LOCATION,
             WAKEUP,
             U_S_N,
             S_T,
             CACHE_CONTROL,
-            APPLICATION_URL
+            APPLICATION_URL,
+            VARY
         };
 
         enum upgrade {
@@ -125,7 +127,8 @@ namespace Web {
                 PAIR_KEY = 4,
                 PAIR_VALUE = 5,
                 BODY = 6,
-                REPORT = 7
+                REPORT = 7,
+                SPLICE = 8
             };
 
             const static uint16_t EOL_MARKER = 0x8000;
@@ -150,6 +153,13 @@ namespace Web {
         public:
             virtual void Serialized(const Web::Response& element) = 0;
 
+            // Offered once the headers are serialized, if the body lives in a file. Return true if the
+            // link sends this part of the file itself, right after the bytes serialized so far.
+            virtual bool Splice(const Core::File::Handle /* file */, const uint64_t /* offset */, const uint32_t /* length */)
+            {
+                return (false);
+            }
+
             void Flush()
             {
                 _lock.Lock();
@@ -389,6 +399,7 @@ POP_WARNING()
             ContentLength.Clear();
             ContentEncoding.Clear();
             WebSocketAccept.Clear();
+            WebSocketExtensions.Clear();
             AccessControlOrigin.Clear();
             AccessControlMethod.Clear();
             AccessControlHeaders.Clear();
@@ -403,6 +414,7 @@ POP_WARNING()
             WakeUp.Clear();
             CacheControl.Clear();
             ApplicationURL.Clear();
+            Vary.Clear();
 
             if (_body.IsValid() == true) {
                 _body.Release();
@@ -437,8 +449,10 @@ POP_WARNING()
         Core::OptionalType<string> WakeUp;
         Core::OptionalType<string> ETag;
         Core::OptionalType<string> WebSocketProtocol;
+        Core::OptionalType<string> WebSocketExtensions;
         Core::OptionalType<string> CacheControl;
         Core::OptionalType<Core::URL> ApplicationURL;
+        Core::OptionalType<string> Vary;
 
         inline bool HasBody() const
         {
@@ -63,6 +63,8 @@ static const TCHAR __ST[] = _T("ST:");
 static const TCHAR __MAN[] = _T("MAN:");
 static const TCHAR __MX[] = _T("MX:");
 static const TCHAR __AUTHORIZATION[] = _T("AUTHORIZATION:");
+static const TCHAR __IF_NONE_MATCH[] = _T("IF-NONE-MATCH:");
+static const TCHAR __IF_MODIFIED_SINCE[] = _T("IF-MODIFIED-SINCE:");
 
 static const TCHAR __DATE[] = _T("DATE:");
 static const TCHAR __SERVER[] = _T("SERVER:");
@@ -85,6 +87,7 @@ static const TCHAR __LOCATION[] = _T("LOCATION:");
 static const TCHAR __WAKEUP[] = _T("WAKEUP:");
 static const TCHAR __CACHE_CONTROL[] = _T("CACHE-CONTROL:");
 static const TCHAR __APPLICATION_URL[] = _T("APPLICATION-URL:");
+static const TCHAR __VARY[] = _T("VARY:");
 
 static const TCHAR __CHARACTER_SET[] = _T("CHARSET=");
 
@@ -228,10 +231,13 @@ ENUM_CONVERSION_BEGIN(Web::Request::keywords)
     { Web::Request::WEBSOCKET_KEY, __TXT(__WEBSOCKET_KEY) },
     { Web::Request::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
     { Web::Request::WEBSOCKET_VERSION, __TXT(__WEBSOCKET_VERSION) },
+    { Web::Request::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Request::MAN, __TXT(__MAN) },
     { Web::Request::M_X, __TXT(__MX) },
     { Web::Request::S_T, __TXT(__ST) },
     { Web::Request::AUTHORIZATION, __TXT(__AUTHORIZATION) },
+    { Web::Request::IF_NONE_MATCH, __TXT(__IF_NONE_MATCH) },
+    { Web::Request::IF_MODIFIED_SINCE, __TXT(__IF_MODIFIED_SINCE) },
 
 ENUM_CONVERSION_END(Web::Request::keywords)
 
@@ -272,12 +278,14 @@ ENUM_CONVERSION_BEGIN(Web::Response::keywords)
     { Web::Response::ACCESS_CONTROL_MAX_AGE, __TXT(__ACCESS_CONTROL_MAX_AGE) },
     { Web::Response::WEBSOCKET_ACCEPT, __TXT(__WEBSOCKET_ACCEPT) },
     { Web::Response::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
+    { Web::Response::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Response::LOCATION, __TXT(__LOCATION) },
     { Web::Response::WAKEUP, __TXT(__WAKEUP) },
     { Web::Response::U_S_N, __TXT(__USN) },
     { Web::Response::S_T, __TXT(__ST) },
     { Web::Response::CACHE_CONTROL, __TXT(__CACHE_CONTROL) },
     { Web::Response::APPLICATION_URL, __TXT(__APPLICATION_URL) },
+    { Web::Response::VARY, __TXT(__VARY) },
 
 ENUM_CONVERSION_END(Web::Response::keywords)
 
@@ -359,6 +367,41 @@ namespace Web
         return (Core::EnumerateType<type>(value).Data());
     }
 
+    bool Request::IsModified(const string& tag, const Core::Time& modified) const
+    {
+        bool result = true;
+
+        ASSERT((tag.length() >= 2) && (tag[0] == '\"') && (tag[tag.length() - 1] == '\"'));
+
+        if (IfNoneMatch.IsSet() == true) {
+            // The tags are compared without their quotes, the parser already took off the first pair.
+            const Core::TextFragment bare(tag, 1, static_cast<uint32_t>(tag.length() - 2));
+            Core::TextSegmentIterator entries(Core::TextFragment(IfNoneMatch.Value()), true, ',');
+
+            while ((result == true) && (entries.Next() == true)) {
+                Core::TextFragment entry(entries.Current());
+
+                entry.TrimBegin(_T(" \t"));
+                entry.TrimEnd(_T(" \t"));
+
+                // Weak comparison applies, so a weak validator matches as well.
+                if ((entry.Length() > 2) && (entry[0] == 'W') && (entry[1] == '/')) {
+                    entry = Core::TextFragment(entry, 2, entry.Length() - 2);
+                }
+                if ((entry.Length() >= 2) && (entry[0] == '\"') && (entry[entry.Length() - 1] == '\"')) {
+                    entry = Core::TextFragment(entry, 1, entry.Length() - 2);
+                }
+
+                result = ((entry != _T("*")) && (entry != bare));
+            }
+        } else if (IfModifiedSince.IsSet() == true) {
+            // The header has a resolution of seconds.
+            result = ((modified.Ticks() / Core::Time::MicroSecondsPerSecond) > (IfModifiedSince.Value().Ticks() / Core::Time::MicroSecondsPerSecond));
+        }
+
+        return (result);
+    }
+
     bool EndsWithCaseInsensitive(const string& mainStr, const string& toMatch)
     {
         auto it = toMatch.begin();
@@ -511,6 +554,243 @@ namespace Web
         }
     }
 
+    static void Assign(Core::OptionalType<string>& field, const Core::TextFragment& value)
+    {
+        // Fill the existing string, no temporary copy of the value is made.
+        if (field.IsSet() == false) {
+            field = string();
+        }
+
+        field.Value().assign(value.Data(), value.Length());
+    }
+
+    static void ToLocation(const Core::TextFragment& url, Request& request)
+    {
+        const TCHAR* text = url.Data();
+        const uint32_t length = url.Length();
+        uint32_t index = 0;
+
+        while ((index < length) && (text[index] != '?') && (text[index] != '#')) {
+            index++;
+        }
+
+        request.Path.assign(text, index);
+        request.Query.Clear();
+        request.Fragment.Clear();
+
+        if ((index < length) && (text[index] == '?')) {
+            const uint32_t start = ++index;
+
+            while ((index < length) && (text[index] != '#')) {
+                index++;
+            }
+
+            Assign(request.Query, Core::TextFragment(&text[start], index - start));
+        }
+
+        if (index < length) {
+            index++;
+            Assign(request.Fragment, Core::TextFragment(&text[index], length - index));
+        }
+    }
+
+    static bool ToVerb(const Core::TextFragment& text, Request::type& verb)
+    {
+        const TCHAR* candidate = nullptr;
+
+        // The length and first character tell the methods apart, a single compare confirms it.
+        switch (text.Length()) {
+        case 3:
+            switch (text[0]) {
+            case 'G': candidate = Request::GET; verb = Request::HTTP_GET; break;
+            case 'P': candidate = Request::PUT; verb = Request::HTTP_PUT; break;
+            default: break;
+            }
+            break;
+        case 4:
+            switch (text[0]) {
+            case 'H': candidate = Request::HEAD; verb = Request::HTTP_HEAD; break;
+            case 'P': candidate = Request::POST; verb = Request::HTTP_POST; break;
+            default: break;
+            }
+            break;
+        case 5:
+            switch (text[0]) {
+            case 'P': candidate = Request::PATCH; verb = Request::HTTP_PATCH; break;
+            case 'T': candidate = Request::TRACE; verb = Request::HTTP_TRACE; break;
+            default: break;
+            }
+            break;
+        case 6:
+            switch (text[0]) {
+            case 'D': candidate = Request::DELETE; verb = Request::HTTP_DELETE; break;
+            case 'N': candidate = Request::NOTIFY; verb = Request::HTTP_NOTIFY; break;
+            default: break;
+            }
+            break;
+        case 7:
+            switch (text[0]) {
+            case 'O': candidate = Request::OPTIONS; verb = Request::HTTP_OPTIONS; break;
+            case 'C': candidate = Request::CONNECT; verb = Request::HTTP_CONNECT; break;
+            default: break;
+            }
+            break;
+        case 8:
+            if (text[0] == 'M') {
+                candidate = Request::MSEARCH; verb = Request::HTTP_MSEARCH;
+            }
+            break;
+        default:
+            break;
+        }
+
+        return ((candidate != nullptr) && (text.EqualText(candidate, 0, text.Length(), true) == true));
+    }
+
+    static bool ToKeyword(const Core::TextFragment& text, Request::keywords& keyword)
+    {
+        const TCHAR* candidate = nullptr;
+
+        // Header names are case insensitive. The length and (mostly) the first character
+        // tell the known ones apart, a single compare confirms it.
+        switch (text.Length()) {
+        case 2:
+            switch (::toupper(text[0])) {
+            case 'M': candidate = __MX; keyword = Request::M_X; break;
+            case 'S': candidate = __ST; keyword = Request::S_T; break;
+            default: break;
+            }
+            break;
+        case 3:
+            candidate = __MAN; keyword = Request::MAN;
+            break;
+        case 4:
+            candidate = __HOST; keyword = Request::HOST;
+            break;
+        case 6:
+            switch (::toupper(text[0])) {
+            case 'A': candidate = __ACCEPT; keyword = Request::ACCEPT; break;
+            case 'O': candidate = __ORIGIN; keyword = Request::ORIGIN; break;
+            default: break;
+            }
+            break;
+        case 7:
+            candidate = __UPGRADE; keyword = Request::UPGRADE;
+            break;
+        case 10:
+            switch (::toupper(text[0])) {
+            case 'C': candidate = __CONNECTION; keyword = Request::CONNECTION; break;
+            case 'U': candidate = __USERAGENT; keyword = Request::USERAGENT; break;
+            default: break;
+            }
+            break;
+        case 12:
+            // CONTENT-TYPE and CONTENT-HMAC
+            switch (::toupper(text[8])) {
+            case 'T': candidate = __CONTENT_TYPE; keyword = Request::CONTENT_TYPE; break;
+            case 'H': candidate = __CONTENT_SIGNATURE; keyword = Request::CONTENT_SIGNATURE; break;
+            default: break;
+            }
+            break;
+        case 13:
+            switch (::toupper(text[0])) {
+            case 'A': candidate = __AUTHORIZATION; keyword = Request::AUTHORIZATION; break;
+            case 'I': candidate = __IF_NONE_MATCH; keyword = Request::IF_NONE_MATCH; break;
+            default: break;
+            }
+            break;
+        case 14:
+            candidate = __CONTENT_LENGTH; keyword = Request::CONTENT_LENGTH;
+            break;
+        case 15:
+            // ACCEPT-ENCODING and ACCEPT-LANGUAGE
+            switch (::toupper(text[7])) {
+            case 'E': candidate = __ACCEPT_ENCODING; keyword = Request::ACCEPT_ENCODING; break;
+            case 'L': candidate = __LANGUAGE; keyword = Request::LANGUAGE; break;
+            default: break;
+            }
+            break;
+        case 16:
+            candidate = __CONTENT_ENCODING; keyword = Request::CONTENT_ENCODING;
+            break;
+        case 17:
+            switch (::toupper(text[0])) {
+            case 'T': candidate = __TRANSFER_ENCODING; keyword = Request::TRANSFER_ENCODING; break;
+            case 'S': candidate = __WEBSOCKET_KEY; keyword = Request::WEBSOCKET_KEY; break;
+            case 'I': candidate = __IF_MODIFIED_SINCE; keyword = Request::IF_MODIFIED_SINCE; break;
+            default: break;
+            }
+            break;
+        case 21:
+            candidate = __WEBSOCKET_VERSION; keyword = Request::WEBSOCKET_VERSION;
+            break;
+        case 22:
+            candidate = __WEBSOCKET_PROTOCOL; keyword = Request::WEBSOCKET_PROTOCOL;
+            break;
+        case 24:
+            candidate = __WEBSOCKET_EXTENSIONS; keyword = Request::WEBSOCKET_EXTENSIONS;
+            break;
+        case 29:
+            candidate = __ACCESS_CONTROL_REQUEST_METHOD; keyword = Request::ACCESS_CONTROL_REQUEST_METHOD;
+            break;
+        case 30:
+            candidate = __ACCESS_CONTROL_REQUEST_HEADERS; keyword = Request::ACCESS_CONTROL_REQUEST_HEADERS;
+            break;
+        default:
+            break;
+        }
+
+        // The keyword texts carry the trailing colon, it is not part of the compare.
+        return ((candidate != nullptr) && (text.EqualText(candidate, 0, text.Length(), false) == true));
+    }
+
+    static bool ToVersion(const Core::TextFragment& text, Request& request)
+    {
+        bool result = false;
+
+        if ((text.Length() >= 5) && (text[0] == 'H') && (text[1] == 'T') && (text[2] == 'T') && (text[3] == 'P') && (text[4] == '/')) {
+            const TCHAR* version = &(text.Data()[5]);
+            const uint32_t length = text.Length() - 5;
+            uint8_t number;
+
+            uint32_t usedChars = Core::Unsigned8::Convert(version, std::min(length, 3u), number, BASE_DECIMAL);
+
+            if (usedChars > 0) {
+                request.MajorVersion = number;
+
+                if ((usedChars < length) && (version[usedChars] == '.')) {
+                    const uint32_t offset = usedChars + 1;
+
+                    usedChars = Core::Unsigned8::Convert(&version[offset], std::min(length - offset, 3u), number, BASE_DECIMAL);
+
+                    if (usedChars > 0) {
+                        request.MinorVersion = number;
+                    }
+                }
+            }
+
+            result = true;
+        }
+
+        return (result);
+    }
+
+    // Returns the line at offset, without its line ending, and moves offset past it.
+    static Core::TextFragment NextLine(const TCHAR text[], uint16_t& offset, const uint16_t end)
+    {
+        const uint16_t start = offset;
+        const TCHAR* feed = static_cast<const TCHAR*>(::memchr(&text[start], '\n', end - start));
+        uint16_t length = (feed != nullptr ? static_cast<uint16_t>(feed - &text[start]) : (end - start));
+
+        offset = start + length + (feed != nullptr ? 1 : 0);
+
+        if ((length > 0) && (text[start + length - 1] == '\r')) {
+            length--;
+        }
+
+        return (Core::TextFragment(&text[start], length));
+    }
+
     uint16_t Request::Serializer::Serialize(uint8_t stream[], const uint16_t maxLength)
     {
         uint16_t current = 0;
@@ -831,6 +1111,16 @@ namespace Web
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __RANGE : _T("Range:"));
                             _value = _current->Range.Value();
                             _offset = 0;
+                        } else if ((_keyIndex <= 25) && (_current->IfNoneMatch.IsSet() == true)) {
+                            _keyIndex = 26;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __IF_NONE_MATCH : _T("If-None-Match:"));
+                            _value = _current->IfNoneMatch.Value();
+                            _offset = 0;
+                        } else if ((_keyIndex <= 26) && (_current->IfModifiedSince.IsSet() == true)) {
+                            _keyIndex = 27;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __IF_MODIFIED_SINCE : _T("If-Modified-Since:"));
+                            _value = _current->IfModifiedSince.Value().ToRFC1123(false);
+                            _offset = 0;
                         }
                     }
 
@@ -847,7 +1137,7 @@ namespace Web
                         }
                     } else {
                         // seems we posted all keywords.. Time for the body..
-                        _state = BODY | EOL_MARKER;
+                        _state = (_bodyLength > 0 ? SPLICE : BODY) | EOL_MARKER;
                         _offset = 0;
                     }
 
@@ -873,6 +1163,21 @@ namespace Web
                     }
                     break;
                 }
+                case SPLICE: {
+                    Core::File::Handle file;
+                    uint64_t offset;
+
+                    ASSERT(_current->_body.IsValid() == true);
+
+                    // If the link takes the file, we are done here, it follows what is in the stream.
+                    if ((_current->_body->Descriptor(file, offset) == true) && (Splice(file, offset, _bodyLength) == true)) {
+                        _bodyLength = 0;
+                        _state = REPORT;
+                    } else {
+                        _state = BODY;
+                    }
+                    break;
+                }
                 case BODY: {
                     if (_bodyLength != 0) {
                         ASSERT(maxLength >= current);
@@ -1049,7 +1354,7 @@ namespace Web
                             _offset = 0;
                         } else if ((_keyIndex <= 2) && (_current->Modified.IsSet() == true)) {
                             _keyIndex = 3;
-                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __MODIFIED : _T("Modified:"));
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __MODIFIED : _T("Last-Modified:"));
                             _value = _current->Modified.Value().ToRFC1123(false);
                             _offset = 0;
                         } else if ((_keyIndex <= 3) && (_current->Connection.IsSet() == true)) {
@@ -1084,8 +1389,13 @@ namespace Web
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_PROTOCOL : _T("Sec-WebSocket-Protocol:"));
                             _value = _current->WebSocketProtocol.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 9) && (_current->Allowed.IsSet() == true)) {
+                        } else if ((_keyIndex <= 9) && (_current->WebSocketExtensions.IsSet() == true)) {
                             _keyIndex = 10;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_EXTENSIONS : _T("Sec-WebSocket-Extensions:"));
+                            _value = _current->WebSocketExtensions.Value();
+                            _offset = 0;
+                        } else if ((_keyIndex <= 10) && (_current->Allowed.IsSet() == true)) {
+                            _keyIndex = 11;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ALLOW : _T("Allow:"));
                             _value = _T("");
                             _offset = 0;
@@ -1104,18 +1414,18 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 10) && (_current->AccessControlHeaders.IsSet() == true)) {
-                            _keyIndex = 11;
+                        } else if ((_keyIndex <= 11) && (_current->AccessControlHeaders.IsSet() == true)) {
+                            _keyIndex = 12;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_HEADERS : _T("Access-Control-Allow-Headers:"));
                             _value = _current->AccessControlHeaders.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 11) && (_current->AccessControlOrigin.IsSet() == true)) {
-                            _keyIndex = 12;
+                        } else if ((_keyIndex <= 12) && (_current->AccessControlOrigin.IsSet() == true)) {
+                            _keyIndex = 13;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_ORIGIN : _T("Access-Control-Allow-Origin:"));
                             _value = _current->AccessControlOrigin.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 12) && (_current->AccessControlMethod.IsSet() == true)) {
-                            _keyIndex = 13;
+                        } else if ((_keyIndex <= 13) && (_current->AccessControlMethod.IsSet() == true)) {
+                            _keyIndex = 14;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_METHODS : _T("Access-Control-Allow-Methods:"));
                             _value = _T("");
                             _offset = 0;
@@ -1134,17 +1444,17 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 13) && (_current->AccessControlMaxAge.IsSet() == true)) {
-                            _keyIndex = 14;
+                        } else if ((_keyIndex <= 14) && (_current->AccessControlMaxAge.IsSet() == true)) {
+                            _keyIndex = 15;
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_current->AccessControlMaxAge.Value());
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_MAX_AGE : _T("Access-Control-Max-Age:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 14) && (_current->ContentType.IsSet() == true)) {
+                        } else if ((_keyIndex <= 15) && (_current->ContentType.IsSet() == true)) {
                             Core::EnumerateType<MIMETypes> enumValue(_current->ContentType.Value());
 
-                            _keyIndex = 15;
+                            _keyIndex = 16;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_TYPE : _T("Content-Type:"));
                             _value = enumValue.Data();
                             if (_current->ContentCharacterSet.IsSet() == true) {
@@ -1154,59 +1464,64 @@ namespace Web
                             }
 
                             _offset = 0;
-                        } else if ((_keyIndex <= 15) && (_current->ContentEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 16) && (_current->ContentEncoding.IsSet() == true)) {
                             Core::EnumerateType<EncodingTypes> enumValue(_current->ContentEncoding.Value());
 
-                            _keyIndex = 16;
+                            _keyIndex = 17;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_ENCODING : _T("Content-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 16) && (_current->TransferEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 17) && (_current->TransferEncoding.IsSet() == true)) {
                             Core::EnumerateType<TransferTypes> enumValue(_current->TransferEncoding.Value());
 
-                            _keyIndex = 17;
+                            _keyIndex = 18;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __TRANSFER_ENCODING : _T("Transfer-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 17) && (_current->Location.IsSet() == true)) {
-                            _keyIndex = 18;
+                        } else if ((_keyIndex <= 18) && (_current->Location.IsSet() == true)) {
+                            _keyIndex = 19;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __LOCATION : _T("Location:"));
                             _value = _current->Location.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 18) && (_current->WakeUp.IsSet() == true)) {
-                            _keyIndex = 19;
+                        } else if ((_keyIndex <= 19) && (_current->WakeUp.IsSet() == true)) {
+                            _keyIndex = 20;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WAKEUP : _T("Wakeup:"));
                             _value = _current->WakeUp.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 19) && (_current->USN.IsSet() == true)) {
-                            _keyIndex = 20;
+                        } else if ((_keyIndex <= 20) && (_current->USN.IsSet() == true)) {
+                            _keyIndex = 21;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __USN : _T("USN:"));
                             _value = _current->USN.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 20) && (_current->ST.IsSet() == true)) {
-                            _keyIndex = 21;
+                        } else if ((_keyIndex <= 21) && (_current->ST.IsSet() == true)) {
+                            _keyIndex = 22;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ST : _T("ST:"));
                             _value = _current->ST.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 21) && (_current->CacheControl.IsSet() == true)) {
-                            _keyIndex = 22;
+                        } else if ((_keyIndex <= 22) && (_current->CacheControl.IsSet() == true)) {
+                            _keyIndex = 23;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CACHE_CONTROL : _T("Cache-Control:"));
                             _value = _current->CacheControl.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 22) && (_current->ApplicationURL.IsSet() == true)) {
-                            _keyIndex = 23;
+                        } else if ((_keyIndex <= 23) && (_current->ApplicationURL.IsSet() == true)) {
+                            _keyIndex = 24;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __APPLICATION_URL : _T("Application-URL:"));
                             _value = _current->ApplicationURL.Value().Text();
                             _offset = 0;
-                        } else if ((_keyIndex <= 23) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
-                            _keyIndex = (_bodyLength > 0 ? 24 : 25);
+                        } else if ((_keyIndex <= 24) && (_current->Vary.IsSet() == true)) {
+                            _keyIndex = 25;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __VARY : _T("Vary:"));
+                            _value = _current->Vary.Value();
+                            _offset = 0;
+                        } else if ((_keyIndex <= 25) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
+                            _keyIndex = (_bodyLength > 0 ? 26 : 27);
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_bodyLength);
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_LENGTH : _T("Content-Length:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 24) && (_current->ContentSignature.IsSet() == true)) {
-                            _keyIndex = 25;
+                        } else if ((_keyIndex <= 26) && (_current->ContentSignature.IsSet() == true)) {
+                            _keyIndex = 27;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_SIGNATURE : _T("Content-HMAC:"));
                             FromSignature(_current->ContentSignature.Value(), _value);
                             _offset = 0;
@@ -1227,7 +1542,7 @@ namespace Web
                     } else {
                         _offset = 0;
                         // seems we posted all keywords.. Time for the body..
-                        _state = BODY | EOL_MARKER;
+                        _state = (_bodyLength > 0 ? SPLICE : BODY) | EOL_MARKER;
                     }
 
                     break;
@@ -1252,6 +1567,21 @@ namespace Web
                     }
                     break;
                 }
+                case SPLICE: {
+                    Core::File::Handle file;
+                    uint64_t offset;
+
+                    ASSERT(_current->_body.IsValid() == true);
+
+                    // If the link takes the file, we are done here, it follows what is in the stream.
+                    if ((_current->_body->Descriptor(file, offset) == true) && (Splice(file, offset, _bodyLength) == true)) {
+                        _bodyLength = 0;
+                        _state = REPORT;
+                    } else {
+                        _state = BODY;
+                    }
+                    break;
+                }
                 case BODY: {
                     if (_bodyLength != 0) {
                         ASSERT(maxLength >= current);
@@ -1316,11 +1646,11 @@ namespace Web
                         _zlibResult = ret;
                     }
 
-                    parsed = _current->_body->Deserialize(out, static_cast<uint16_t>(sizeof(out) - _zlib.avail_out));
+                    parsed = _current->_body->Deserialize(out, static_cast<uint32_t>(sizeof(out) - _zlib.avail_out));
 
                 } while ((_zlib.avail_out == 0) && (_zlibResult == Z_OK));
             } else if (_zlibResult == static_cast<uint32_t>(~0)) {
-                parsed = _current->_body->Deserialize(stream, maxLength);
+                parsed = _current->_body->Deserialize(stream, static_cast<uint32_t>(maxLength));
             }
         }
 
@@ -1329,18 +1659,16 @@ namespace Web
 
     void Request::Deserializer::Parse(const string& buffer, const bool /* quoted */)
     {
-
-        _lock.Lock();
-
-        // Word complete check and set......
+        // Only called from within Deserialize(), that already holds the lock.
         switch (_state) {
         case VERB: {
-            Core::EnumerateType<Request::type> type(buffer.c_str(), true);
-            if ((type.IsSet() == false) || ((_current = Element()) == nullptr)) {
+            Request::type verb;
+
+            if ((ToVerb(Core::TextFragment(buffer.c_str(), static_cast<uint32_t>(buffer.length())), verb) == false) || ((_current = Element()) == nullptr)) {
                 _parser.FlushLine();
             } else {
                 // Seems like we have a hit. Collect a new entry and start setting it.
-                _current->Verb = type.Value();
+                _current->Verb = verb;
                 _parser.CollectWord();
                 _state = URL;
             }
@@ -1348,54 +1676,14 @@ namespace Web
             break;
         }
         case URL: {
-            // See if there is a '?' mark in this entry
-            size_t query = buffer.find('?', 0);
-            size_t fragment = buffer.find('#', 0);
-
-            if ((query == string::npos) && (fragment == string::npos)) {
-                _current->Path = buffer;
-                _current->Query.Clear();
-                _current->Fragment.Clear();
-            } else if (fragment == string::npos) {
-                _current->Path = buffer.substr(0, query);
-                _current->Query = buffer.substr(query + 1, buffer.size() - query);
-                _current->Fragment.Clear();
-            } else if (query == string::npos) {
-                _current->Path = buffer.substr(0, fragment);
-                _current->Fragment = buffer.substr(fragment + 1, buffer.size() - fragment);
-                _current->Query.Clear();
-            } else if (query < fragment) {
-                _current->Path = buffer.substr(0, query);
-                _current->Query = buffer.substr(query + 1, buffer.size() - query);
-                _current->Fragment = buffer.substr(fragment + 1, buffer.size() - fragment);
-            } else {
-                _current->Path = buffer.substr(0, fragment);
-                _current->Fragment = buffer.substr(fragment + 1, buffer.size() - fragment);
-                _current->Query = buffer.substr(query + 1, buffer.size() - query);
-            }
+            ToLocation(Core::TextFragment(buffer.c_str(), static_cast<uint32_t>(buffer.length())), *_current);
 
             // It should still be in CollectWord mode.. Continue..
             _state = VERSION;
             break;
         }
         case VERSION: {
-            if ((buffer[0] == 'H') && (buffer[1] == 'T') && (buffer[2] == 'T') && (buffer[3] == 'P') && (buffer[4] == '/')) {
-                uint8_t number;
-
-                uint32_t usedChars = Core::Unsigned8::Convert(&(buffer.c_str()[5]), 3, number, BASE_DECIMAL);
-
-                if (usedChars > 0) {
-                    _current->MajorVersion = number;
-
-                    if (buffer[usedChars + 5] == '.') {
-                        usedChars = Core::Unsigned8::Convert(&(buffer.c_str()[5 + 1 + usedChars]), 3, number, BASE_DECIMAL);
-
-                        if (usedChars > 0) {
-                            _current->MinorVersion = number;
-                        }
-                    }
-                }
-
+            if (ToVersion(Core::TextFragment(buffer.c_str(), static_cast<uint32_t>(buffer.length())), *_current) == true) {
                 // Valid, extracted the version numbers..
                 _state = PAIR_KEY;
             }
@@ -1403,50 +1691,14 @@ namespace Web
         }
         case PAIR_KEY: {
             if (buffer.size() == 0) {
-                bool chunked = (_current->TransferEncoding.IsSet() == true) && (_current->TransferEncoding.Value() != TRANSFER_UNKNOWN);
-
-                // Empty line means we are starting the BODY
-                if (chunked || ((_current->ContentLength.IsSet() == true) && (_current->ContentLength.Value() > 0))) {
-                    // Allow the Deserializer to "instantiate"/link the right Body to the response:
-                    if (LinkBody(*_current) == true) {
-                        _current->Body<Web::IBody>()->Deserialize();
-                    }
-
-                    // Depending on the ContentEncoding, we need to prepare the data..
-                    if ((_current->ContentEncoding.IsSet()) && (_current->ContentEncoding.Value() != EncodingTypes::ENCODING_UNKNOWN)) {
-                        /* allocate inflate state */
-                        _zlib.zalloc = nullptr;
-                        _zlib.zfree = nullptr;
-                        _zlib.opaque = nullptr;
-                        _zlib.avail_in = 0;
-                        _zlib.next_in = nullptr;
-                        _zlibResult = inflateInit2(&_zlib, 16 + MAX_WBITS);
-                    } else {
-                        _zlibResult = static_cast<uint32_t>(~0);
-                    }
-
-                    if (chunked == false) {
-                        _parser.PassThrough(_current->ContentLength.Value());
-                    } else {
-                        _parser.CollectLine();
-                        _state = CHUNK_INIT;
-                    }
-                } else {
-                    // There is no body following this according to the length.
-                    // Dispatch the Request
-                    Deserialized(*_current);
-                    _current = nullptr;
-                    _state = VERSION;
-                }
+                EndOfHeaders();
             } else {
-                // See if we recognise this word...
-                Core::EnumerateType<Request::keywords> keyWord(buffer.c_str(), true);
-                if (keyWord.IsSet() == false) {
+                // See if we recognise this word, it is collected up to and including the colon.
+                if ((buffer.back() != ':') || (ToKeyword(Core::TextFragment(buffer.c_str(), static_cast<uint32_t>(buffer.length() - 1)), _keyWord) == false)) {
                     //TRACE_L1("Could not resolve keyword %s", buffer.c_str());
                     _parser.FlushLine();
                 } else {
                     // Seems like we have a hit. Collect a new entry and start setting it.
-                    _keyWord = keyWord.Value();
                     _parser.CollectLine();
                     _state = PAIR_VALUE;
                 }
@@ -1454,157 +1706,324 @@ namespace Web
             break;
         }
         case PAIR_VALUE: {
-            switch (_keyWord) {
-            case Request::HOST:
-                _current->Host = buffer;
-                break;
-            case Request::ACCEPT:
-                _current->Accept = buffer;
-                break;
-            case Request::USERAGENT:
-                _current->UserAgent = buffer;
-                break;
-            case Request::ENCODING:
-                _current->Encoding = buffer;
-                break;
-            case Request::LANGUAGE:
-                _current->Language = buffer;
-                break;
-            case Request::ORIGIN:
-                _current->Origin = buffer;
-                break;
-            case Request::WEBSOCKET_PROTOCOL:
-                _current->WebSocketProtocol = ProtocolsArray(buffer);
-                break;
-            case Request::WEBSOCKET_KEY:
-                _current->WebSocketKey = buffer;
-                break;
-            case Request::WEBSOCKET_EXTENSIONS:
-                _current->WebSocketExtensions = buffer;
-                break;
-            case Request::ACCESS_CONTROL_REQUEST_HEADERS:
-                _current->AccessControlHeaders = buffer;
-                break;
-            case Request::MAN:
-                _current->Man = buffer;
-                break;
-            case Request::S_T:
-                _current->ST = buffer;
-                break;
-            case Request::M_X:
-                _current->MX = Core::NumberType<uint32_t>(buffer.c_str(), static_cast<uint32_t>(buffer.length())).Value();
-                break;
-            case Request::AUTHORIZATION:
-                _current->WebToken = ToAuthorization(buffer);
-                break;
-            case Request::CONTENT_SIGNATURE:
-                _current->ContentSignature = ToSignature(buffer);
-                break;
-            case Request::CONTENT_TYPE:
-                ParseContentType(buffer, _current->ContentType, _current->ContentCharacterSet);
-                break;
-            case Request::CONTENT_ENCODING: {
-                Core::EnumerateType<EncodingTypes> enumValue(buffer.c_str(), false);
+            Value(Core::TextFragment(buffer.c_str(), static_cast<uint32_t>(buffer.length())));
+            break;
+        }
+        case CHUNK_INIT: {
+            uint32_t chunkedSize = Core::NumberType<uint32_t, false, BASE_HEXADECIMAL>(Core::TextFragment(buffer));
+            if (chunkedSize == 0) {
+                _state = BODY_END;
+                _parser.FlushLine();
+            } else {
+                _parser.PassThrough(chunkedSize);
+            }
+            break;
+        }
+        case CHUNK_END:
+        case BODY_END:
+            break;
+        }
+    }
 
-                if (enumValue.IsSet() == true) {
-                    _current->ContentEncoding = enumValue.Value();
-                } else {
-                    _current->ContentEncoding = ENCODING_UNKNOWN;
+    uint16_t Request::Deserializer::Scan(const uint8_t stream[], const uint16_t maxLength)
+    {
+        const TCHAR* text = reinterpret_cast<const TCHAR*>(stream);
+        uint16_t offset = 0;
+        uint16_t end = 0;
+
+        // Only a complete header block is taken, up to and including the empty line that closes it.
+        while ((end == 0) && (offset < maxLength)) {
+            const TCHAR* feed = static_cast<const TCHAR*>(::memchr(&text[offset], '\n', maxLength - offset));
+
+            if (feed == nullptr) {
+                offset = maxLength;
+            } else {
+                const uint16_t next = static_cast<uint16_t>(feed - text) + 1;
+
+                if (((next - offset) == 1) || (((next - offset) == 2) && (text[offset] == '\r'))) {
+                    end = next;
                 }
-                break;
+
+                offset = next;
             }
-            case Request::ACCEPT_ENCODING: {
-                // We only allow for GZIP, right now, so see if it is an allowed format, if so, use it.
-                Core::TextSegmentIterator entries(Core::TextFragment(buffer), true, ',');
+        }
 
-                while (entries.Next() != false) {
-                    if (entries.Current().EqualText(__ENCODING_GZIP, 0, ((sizeof(__ENCODING_GZIP) / sizeof(TCHAR)) - 1), false) == true) {
-                        _current->AcceptEncoding = ENCODING_GZIP;
-                    }
-                }
-                break;
+        if (end != 0) {
+            // Request line: <verb> <url> HTTP/<major>.<minor>
+            offset = 0;
+            Core::TextFragment line(NextLine(text, offset, end));
+            const TCHAR* data = line.Data();
+            const uint32_t length = line.Length();
+            uint32_t index = 0;
+            Request::type verb;
+
+            while ((index < length) && (data[index] != ' ')) {
+                index++;
             }
-            case Request::TRANSFER_ENCODING: {
-                Core::EnumerateType<TransferTypes> enumValue(buffer.c_str(), false);
 
-                if (enumValue.IsSet() == true) {
-                    _current->TransferEncoding = enumValue.Value();
-                } else {
-                    _current->TransferEncoding = TRANSFER_UNKNOWN;
-                }
-                break;
+            Core::TextFragment method(data, index);
+
+            while ((index < length) && (data[index] == ' ')) {
+                index++;
             }
-            case Request::CONNECTION: {
-                Core::EnumerateType<Request::connection> enumValue(buffer.c_str(), false);
-                if (enumValue.IsSet() == true) {
-                    _current->Connection = enumValue.Value();
-                } else if (Request::ScanForKeyword(buffer, Request::connection::CONNECTION_UPGRADE) == true) {
-                    _current->Connection = Request::connection::CONNECTION_UPGRADE;
-                } else {
-                    _current->Connection = Request::CONNECTION_UNKNOWN;
-                }
-                break;
+
+            const uint32_t start = index;
+
+            while ((index < length) && (data[index] != ' ')) {
+                index++;
             }
-            case Request::UPGRADE: {
-                Core::EnumerateType<Request::upgrade> enumValue(buffer.c_str(), false);
 
-                if (enumValue.IsSet() == true) {
-                    _current->Upgrade = enumValue.Value();
-                } else {
-                    _current->Upgrade = Request::UPGRADE_UNKNOWN;
-                }
-                break;
+            Core::TextFragment url(&data[start], index - start);
+
+            while ((index < length) && (data[index] == ' ')) {
+                index++;
             }
-            case Request::WEBSOCKET_VERSION: {
-                uint32_t number = 0;
 
-                if (Core::Unsigned32::Convert(buffer.c_str(), static_cast<uint32_t>(buffer.size()), number, BASE_DECIMAL) > 0) {
-                    _current->WebSocketVersion = number;
+            Core::TextFragment version(&data[index], length - index);
+
+            // Anything out of the ordinary is left to the parser, it knows how to deal with it.
+            if ((ToVerb(method, verb) == false) || (version.Length() < 5) || (Core::TextFragment(version, 0, 5).EqualText(_T("HTTP/"), 0, 5, true) == false) || ((_current = Element()) == nullptr)) {
+                end = 0;
+            } else {
+                _current->Verb = verb;
+                ToLocation(url, *_current);
+                ToVersion(version, *_current);
+
+                while (offset < end) {
+                    line = NextLine(text, offset, end);
+                    data = line.Data();
+                    index = 0;
+
+                    while ((index < line.Length()) && (data[index] != ':')) {
+                        index++;
+                    }
+
+                    // Only the headers that have a place in the request are materialized.
+                    if ((index < line.Length()) && (ToKeyword(Core::TextFragment(data, index), _keyWord) == true)) {
+                        Core::TextFragment value(&data[index + 1], line.Length() - index - 1);
+
+                        value.TrimBegin(_T(" \t"));
+                        value.TrimEnd(_T(" \t"));
+
+                        if ((value.Length() > 0) && ((value[0] == '\"') || (value[0] == '\''))) {
+                            // Like the parser does, a value that starts with a quote loses the quotes around that part.
+                            const TCHAR quote = value[0];
+                            uint32_t close = 1;
+
+                            while ((close < value.Length()) && (value[close] != quote)) {
+                                close += (value[close] == '\\' ? 2 : 1);
+                            }
+
+                            if (close >= (value.Length() - 1)) {
+                                Value(Core::TextFragment(value, 1, std::min(close, value.Length()) - 1));
+                            } else {
+                                string unquoted(&(value.Data()[1]), close - 1);
+
+                                unquoted.append(&(value.Data()[close + 1]), value.Length() - close - 1);
+
+                                Value(Core::TextFragment(unquoted));
+                            }
+                        } else {
+                            Value(value);
+                        }
+                    }
                 }
-                break;
+
+                EndOfHeaders();
             }
-            case Request::CONTENT_LENGTH: {
-                uint32_t number = 0;
+        }
 
-                if (Core::Unsigned32::Convert(buffer.c_str(), static_cast<uint32_t>(buffer.size()), number, BASE_DECIMAL) > 0) {
-                    _current->ContentLength = number;
-                }
-                break;
+        return (end);
+    }
+
+    void Request::Deserializer::Value(const Core::TextFragment& value)
+    {
+        switch (_keyWord) {
+        case Request::HOST:
+            Assign(_current->Host, value);
+            break;
+        case Request::ACCEPT:
+            Assign(_current->Accept, value);
+            break;
+        case Request::USERAGENT:
+            Assign(_current->UserAgent, value);
+            break;
+        case Request::ENCODING:
+            Assign(_current->Encoding, value);
+            break;
+        case Request::LANGUAGE:
+            Assign(_current->Language, value);
+            break;
+        case Request::ORIGIN:
+            Assign(_current->Origin, value);
+            break;
+        case Request::WEBSOCKET_PROTOCOL:
+            _current->WebSocketProtocol = ProtocolsArray(value.Text());
+            break;
+        case Request::WEBSOCKET_KEY:
+            Assign(_current->WebSocketKey, value);
+            break;
+        case Request::WEBSOCKET_EXTENSIONS:
+            Assign(_current->WebSocketExtensions, value);
+            break;
+        case Request::ACCESS_CONTROL_REQUEST_HEADERS:
+            Assign(_current->AccessControlHeaders, value);
+            break;
+        case Request::MAN:
+            Assign(_current->Man, value);
+            break;
+        case Request::S_T:
+            Assign(_current->ST, value);
+            break;
+        case Request::M_X:
+            _current->MX = Core::NumberType<uint32_t>(value.Data(), value.Length()).Value();
+            break;
+        case Request::AUTHORIZATION:
+            _current->WebToken = ToAuthorization(value.Text());
+            break;
+        case Request::IF_NONE_MATCH:
+            Assign(_current->IfNoneMatch, value);
+            break;
+        case Request::IF_MODIFIED_SINCE: {
+            Core::Time time;
+
+            if (time.FromString(value.Text(), true) == true) {
+                _current->IfModifiedSince = time;
             }
-            case Request::ACCESS_CONTROL_REQUEST_METHOD: {
-                uint16_t value = 0;
-                Core::TextSegmentIterator index(Core::TextFragment(buffer), true, ',');
-                while (index.Next()) {
-                    Core::EnumerateType<Request::type> enumerate(index.Current().Text().c_str(), false);
 
-                    if (enumerate.IsSet() == true) {
-                        value |= enumerate.Value();
-                    }
-                }
+            break;
+        }
+        case Request::CONTENT_SIGNATURE:
+            _current->ContentSignature = ToSignature(value.Text());
+            break;
+        case Request::CONTENT_TYPE:
+            ParseContentType(value.Text(), _current->ContentType, _current->ContentCharacterSet);
+            break;
+        case Request::CONTENT_ENCODING: {
+            Core::EnumerateType<EncodingTypes> enumValue(value, false);
 
-                _current->AccessControlMethod = value;
+            if (enumValue.IsSet() == true) {
+                _current->ContentEncoding = enumValue.Value();
+            } else {
+                _current->ContentEncoding = ENCODING_UNKNOWN;
+            }
+            break;
+        }
+        case Request::ACCEPT_ENCODING: {
+            // We only allow for GZIP, right now, so see if it is an allowed format, if so, use it.
+            Core::TextSegmentIterator entries(value, true, ',');
 
-                break;
+            while (entries.Next() != false) {
+                if (entries.Current().EqualText(__ENCODING_GZIP, 0, ((sizeof(__ENCODING_GZIP) / sizeof(TCHAR)) - 1), false) == true) {
+                    _current->AcceptEncoding = ENCODING_GZIP;
+                }
             }
+            break;
+        }
+        case Request::TRANSFER_ENCODING: {
+            Core::EnumerateType<TransferTypes> enumValue(value, false);
+
+            if (enumValue.IsSet() == true) {
+                _current->TransferEncoding = enumValue.Value();
+            } else {
+                _current->TransferEncoding = TRANSFER_UNKNOWN;
             }
             break;
         }
-        case CHUNK_INIT: {
-            uint32_t chunkedSize = Core::NumberType<uint32_t, false, BASE_HEXADECIMAL>(Core::TextFragment(buffer));
-            if (chunkedSize == 0) {
-                _state = BODY_END;
-                _parser.FlushLine();
+        case Request::CONNECTION: {
+            Core::EnumerateType<Request::connection> enumValue(value, false);
+            if (enumValue.IsSet() == true) {
+                _current->Connection = enumValue.Value();
+            } else if (Request::ScanForKeyword(value.Text(), Request::connection::CONNECTION_UPGRADE) == true) {
+                _current->Connection = Request::connection::CONNECTION_UPGRADE;
             } else {
-                _parser.PassThrough(chunkedSize);
+                _current->Connection = Request::CONNECTION_UNKNOWN;
             }
             break;
         }
-        case CHUNK_END:
-        case BODY_END:
+        case Request::UPGRADE: {
+            Core::EnumerateType<Request::upgrade> enumValue(value, false);
+
+            if (enumValue.IsSet() == true) {
+                _current->Upgrade = enumValue.Value();
+            } else {
+                _current->Upgrade = Request::UPGRADE_UNKNOWN;
+            }
             break;
         }
+        case Request::WEBSOCKET_VERSION: {
+            uint32_t number = 0;
 
-        _lock.Unlock();
+            if (Core::Unsigned32::Convert(value.Data(), value.Length(), number, BASE_DECIMAL) > 0) {
+                _current->WebSocketVersion = number;
+            }
+            break;
+        }
+        case Request::CONTENT_LENGTH: {
+            uint32_t number = 0;
+
+            if (Core::Unsigned32::Convert(value.Data(), value.Length(), number, BASE_DECIMAL) > 0) {
+                _current->ContentLength = number;
+            }
+            break;
+        }
+        case Request::ACCESS_CONTROL_REQUEST_METHOD: {
+            uint16_t methods = 0;
+            Core::TextSegmentIterator index(value, true, ',');
+            while (index.Next()) {
+                Core::EnumerateType<Request::type> enumerate(index.Current(), false);
+
+                if (enumerate.IsSet() == true) {
+                    methods |= enumerate.Value();
+                }
+            }
+
+            _current->AccessControlMethod = methods;
+
+            break;
+        }
+        }
+    }
+
+    void Request::Deserializer::EndOfHeaders()
+    {
+        bool chunked = (_current->TransferEncoding.IsSet() == true) && (_current->TransferEncoding.Value() != TRANSFER_UNKNOWN);
+
+        // Empty line means we are starting the BODY
+        if (chunked || ((_current->ContentLength.IsSet() == true) && (_current->ContentLength.Value() > 0))) {
+            // Allow the Deserializer to "instantiate"/link the right Body to the response:
+            if (LinkBody(*_current) == true) {
+                _current->Body<Web::IBody>()->Deserialize();
+            }
+
+            // Depending on the ContentEncoding, we need to prepare the data..
+            if ((_current->ContentEncoding.IsSet()) && (_current->ContentEncoding.Value() != EncodingTypes::ENCODING_UNKNOWN)) {
+                /* allocate inflate state */
+                _zlib.zalloc = nullptr;
+                _zlib.zfree = nullptr;
+                _zlib.opaque = nullptr;
+                _zlib.avail_in = 0;
+                _zlib.next_in = nullptr;
+                _zlibResult = inflateInit2(&_zlib, 16 + MAX_WBITS);
+            } else {
+                _zlibResult = static_cast<uint32_t>(~0);
+            }
+
+            _state = PAIR_KEY;
+
+            if (chunked == false) {
+                _parser.PassThrough(_current->ContentLength.Value());
+            } else {
+                _parser.CollectLine();
+                _state = CHUNK_INIT;
+            }
+        } else {
+            // There is no body following this according to the length.
+            // Dispatch the Request
+            Deserialized(*_current);
+            _current = nullptr;
+            _state = VERB;
+        }
     }
 
     void Request::Deserializer::EndOfPassThrough()
@@ -1712,11 +2131,11 @@ namespace Web
                         _zlibResult = ret;
                     }
 
-                    parsed = _current->_body->Deserialize(out, static_cast<uint16_t>(sizeof(out) - _zlib.avail_out));
+                    parsed = _current->_body->Deserialize(out, static_cast<uint32_t>(sizeof(out) - _zlib.avail_out));
 
                 } while ((_zlib.avail_out == 0) && (_zlibResult == Z_OK));
             } else if (_zlibResult == static_cast<uint32_t>(~0)) {
-                parsed = _current->_body->Deserialize(stream, maxLength);
+                parsed = _current->_body->Deserialize(stream, static_cast<uint32_t>(maxLength));
             }
         }
 
@@ -1849,6 +2268,9 @@ namespace Web
             case Response::WEBSOCKET_PROTOCOL:
                 _current->WebSocketProtocol = buffer;
                 break;
+            case Response::WEBSOCKET_EXTENSIONS:
+                _current->WebSocketExtensions = buffer;
+                break;
             case Response::CONTENT_SIGNATURE:
                 _current->ContentSignature = ToSignature(buffer);
                 break;
@@ -1870,6 +2292,9 @@ namespace Web
             case Response::CACHE_CONTROL:
                 _current->CacheControl = buffer;
                 break;
+            case Response::VARY:
+                _current->Vary = buffer;
+                break;
             case Response::CONTENT_TYPE:
                 ParseContentType(buffer, _current->ContentType, _current->ContentCharacterSet);
                 break;
@@ -1956,7 +2381,7 @@ namespace Web
                 Core::Time time;
 
                 if (time.FromString(buffer, true) == true) {
-                    _current->Date = time;
+                    _current->Modified = time;
                 }
 
                 break;
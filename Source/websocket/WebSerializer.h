@@ -60,9 +60,10 @@ namespace Web {
             string::clear();
             return (static_cast<uint32_t>(~0));
         }
-        uint16_t Serialize(uint8_t stream[], const uint16_t maxLength) const override
+        uint32_t Serialize(uint8_t stream[], const uint32_t maxLength) const override
         {
-            uint16_t size = static_cast<uint16_t>(maxLength > (string::length() * sizeof(TCHAR)) ? (string::length() * sizeof(TCHAR)) : (sizeof(TCHAR) == 1 ? maxLength : (maxLength & 0xFFFE)));
+            const uint32_t remaining = static_cast<uint32_t>(string::length() * sizeof(TCHAR)) - _lastPosition;
+            uint32_t size = (maxLength > remaining ? remaining : (sizeof(TCHAR) == 1 ? maxLength : (maxLength & 0xFFFFFFFE)));
 
             if (size > 0) {
                 ::memcpy(stream, &(reinterpret_cast<const uint8_t*>(string::c_str())[_lastPosition]), size);
@@ -71,9 +72,9 @@ namespace Web {
 
             return size;
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
         {
-            uint16_t index = 0;
+            uint32_t index = 0;
 
             while (index < maxLength) {
                 string::operator+=(stream[index]);
@@ -126,9 +127,9 @@ namespace Web {
             _hash.Reset();
             return (TextBody::Deserialize());
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
         {
-            uint16_t deserialized = TextBody::Deserialize(stream, maxLength);
+            uint32_t deserialized = TextBody::Deserialize(stream, maxLength);
 
             // Also pass it through our hashing algorithm.
             if (deserialized) {
@@ -193,13 +194,20 @@ namespace Web {
             _opened = (Core::File::IsOpen() == false);
             return (((_opened == false) || (Core::File::Create() == true)) ? static_cast<uint32_t>(~0) : 0);
         }
-        uint16_t Serialize(uint8_t stream[], const uint16_t maxLength) const override
+        uint32_t Serialize(uint8_t stream[], const uint32_t maxLength) const override
         {
             return Core::File::Read(stream, maxLength);
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        bool Descriptor(Core::File::Handle& file, uint64_t& offset) const override
         {
-            uint16_t write = Core::File::Write(stream, maxLength);
+            file = static_cast<Core::File::Handle>(const_cast<FileBody&>(*this));
+            offset = static_cast<uint64_t>(Core::File::Position());
+
+            return (Core::File::IsOpen());
+        }
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
+        {
+            uint32_t write = Core::File::Write(stream, maxLength);
             if (!write) {
                 _startPosition = Core::NumberType<int32_t>::Max();
             }
@@ -273,7 +281,7 @@ namespace Web {
         {
             return (_hash);
         }
-        uint16_t Serialize(uint8_t stream[], const uint16_t maxLength) const override
+        uint32_t Serialize(uint8_t stream[], const uint32_t maxLength) const override
         {
             return Core::File::Read(stream, maxLength);
         }
@@ -283,9 +291,9 @@ namespace Web {
         {
             return (FileBody::Deserialize());
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
         {
-            uint16_t deserialized = FileBody::Deserialize(stream, maxLength);
+            uint32_t deserialized = FileBody::Deserialize(stream, maxLength);
 
             // Also pass it through our hashing algorithm.
             if (deserialized == maxLength) {
@@ -356,9 +364,10 @@ namespace Web {
             _error.Clear();
             return (static_cast<uint32_t>(~0));
         }
-        uint16_t Serialize(uint8_t stream[], const uint16_t maxLength) const override
+        uint32_t Serialize(uint8_t stream[], const uint32_t maxLength) const override
         {
-            uint16_t size = static_cast<uint16_t>(maxLength > (_body.length() * sizeof(TCHAR)) ? (_body.length() * sizeof(TCHAR)) : (sizeof(TCHAR) == 1 ? maxLength : (maxLength & 0xFFFE)));
+            const uint32_t remaining = static_cast<uint32_t>(_body.length() * sizeof(TCHAR)) - _lastPosition;
+            uint32_t size = (maxLength > remaining ? remaining : (sizeof(TCHAR) == 1 ? maxLength : (maxLength & 0xFFFFFFFE)));
 
             if (size > 0) {
                 ::memcpy(stream, &(reinterpret_cast<const uint8_t*>(_body.c_str())[_lastPosition]), size);
@@ -366,7 +375,7 @@ namespace Web {
             }
             return size;
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
         {
             return static_cast<Core::JSON::IElement&>(*this).Deserialize(reinterpret_cast<const char*>(stream), maxLength, _offset, _error);
         }
@@ -418,9 +427,9 @@ namespace Web {
 
             return (JSONBodyType<JSONOBJECT>::Deserialize());
         }
-        uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
+        uint32_t Deserialize(const uint8_t stream[], const uint32_t maxLength) override
         {
-            uint16_t deserialized = JSONBodyType<JSONOBJECT>::Deserialize(stream, maxLength);
+            uint32_t deserialized = JSONBodyType<JSONOBJECT>::Deserialize(stream, maxLength);
 
             // Also pass it through our hashing algorithm.
             if (deserialized == maxLength) {
@@ -37,6 +37,7 @@ namespace Web {
 
         static const uint8_t CONTINUATION_FRAME = 0x00;
         static const uint8_t FINISHING_FRAME = 0x80;
+        static const uint8_t COMPRESSED_FRAME = 0x40;
         static const uint8_t TYPE_FRAME = 0x0F;
         static const uint8_t MASKING_FRAME = 0x80;
         static const uint8_t CONTROL_FRAME = 0x08;
@@ -119,13 +120,16 @@ namespace Web {
                     dataFrame[3] = (usedSize & 0xFF);
                 }
 
+                const uint8_t opCode = (SendInProgress() == true ? CONTINUATION_FRAME : ((TYPE_FRAME & _setFlags) | (_sendCompressed == true ? COMPRESSED_FRAME : 0x00)));
+
                 if (usedSize < maxSendSize) {
                     // Seems like not all available space is used, so I guess we are ready..
-                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = FINISHING_FRAME | opCode;
                     _progressInfo &= (~0x40);
+                    _sendCompressed = false;
                 } else {
                     // There is more to come, this is just part of a bigger picture
-                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = opCode;
                     _progressInfo |= (0x40);
                 }
 
@@ -161,6 +165,36 @@ namespace Web {
             return (result);
         }
 
+        uint8_t Protocol::Header(uint8_t* dataFrame, const uint16_t payloadSize, const bool final, uint8_t maskKey[4])
+        {
+            uint8_t result = 2;
+
+            dataFrame[0] = (final == true ? FINISHING_FRAME : 0x00) | (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+
+            if (payloadSize <= 125) {
+                dataFrame[1] = ((_setFlags & MASKING_FRAME) | payloadSize);
+            } else {
+                dataFrame[1] = ((_setFlags & MASKING_FRAME) | 126);
+                dataFrame[2] = (payloadSize >> 8);
+                dataFrame[3] = (payloadSize & 0xFF);
+                result = 4;
+            }
+
+            if ((_setFlags & MASKING_FRAME) != 0) {
+                GenerateMaskKey(maskKey);
+                ::memcpy(&dataFrame[result], maskKey, 4);
+                result += 4;
+            }
+
+            if (final == true) {
+                _progressInfo &= (~0x40);
+            } else {
+                _progressInfo |= 0x40;
+            }
+
+            return (result);
+        }
+
         uint16_t Protocol::Decoder(uint8_t* dataFrame, uint16_t& receivedSize)
         {
             uint16_t actualHeader = 0;
@@ -208,6 +242,11 @@ namespace Web {
                 } else {
                     _frameType = static_cast<frameType>(dataFrame[0] & TYPE_FRAME);
 
+                    // The first frame of a data message tells if the whole message is compressed.
+                    if ((_frameType != 0) && ((_frameType & CONTROL_FRAME) == 0)) {
+                        _receiveCompressed = ((dataFrame[0] & COMPRESSED_FRAME) != 0);
+                    }
+
                     // Continuation frame is only allowed if a receive is in progress...
                     if (ReceiveInProgress() == true) {
                         if (_frameType == 0) {
@@ -278,6 +317,371 @@ namespace Web {
 
             return (actualHeader);
         }
+
+        static const TCHAR PerMessageDeflate[] = _T("permessage-deflate");
+        static const uint8_t DeflateTail[] = { 0x00, 0x00, 0xFF, 0xFF };
+        static constexpr uint16_t InflateChunk = 4096;
+
+        // The parameters of one permessage-deflate offer or response, e.g.: permessage-deflate; client_max_window_bits=10
+        // A window size of 0 means the parameter was not present, 1 means present without a value.
+        struct DeflateParameters {
+            uint8_t serverMaxWindowBits;
+            uint8_t clientMaxWindowBits;
+            bool serverNoContextTakeover;
+            bool clientNoContextTakeover;
+        };
+
+        static string Trim(const string& text)
+        {
+            const size_t start = text.find_first_not_of(_T(" \t\""));
+            const size_t end = text.find_last_not_of(_T(" \t\""));
+
+            return (start == string::npos ? string() : text.substr(start, (end - start) + 1));
+        }
+
+        static bool ParseWindowBits(const string& value, uint8_t& bits)
+        {
+            bool result = false;
+
+            if (value.empty() == true) {
+                result = (bits == 0);
+                bits = 1;
+            } else if ((bits == 0) && (value.length() <= 2) && (value.find_first_not_of(_T("0123456789")) == string::npos)) {
+                const uint32_t number = Core::NumberType<uint32_t>(value.c_str(), static_cast<uint32_t>(value.length())).Value();
+
+                if ((number >= 8) && (number <= 15)) {
+                    bits = static_cast<uint8_t>(number);
+                    result = true;
+                }
+            }
+
+            return (result);
+        }
+
+        // Returns false if this is not a permessage-deflate extension or if a parameter is unknown, duplicate or invalid.
+        static bool ParseDeflate(const string& extension, DeflateParameters& parameters)
+        {
+            size_t start = extension.find(';');
+            bool result = (Trim(extension.substr(0, start)) == PerMessageDeflate);
+
+            ::memset(&parameters, 0, sizeof(parameters));
+
+            while ((result == true) && (start != string::npos)) {
+                const size_t end = extension.find(';', start + 1);
+                const string parameter(extension.substr(start + 1, (end == string::npos ? string::npos : end - start - 1)));
+                const size_t assign = parameter.find('=');
+                const string key(Trim(parameter.substr(0, assign)));
+                const string value(assign == string::npos ? string() : Trim(parameter.substr(assign + 1)));
+
+                if (key == _T("server_no_context_takeover")) {
+                    result = ((value.empty() == true) && (parameters.serverNoContextTakeover == false));
+                    parameters.serverNoContextTakeover = true;
+                } else if (key == _T("client_no_context_takeover")) {
+                    result = ((value.empty() == true) && (parameters.clientNoContextTakeover == false));
+                    parameters.clientNoContextTakeover = true;
+                } else if (key == _T("server_max_window_bits")) {
+                    result = ((value.empty() == false) && (ParseWindowBits(value, parameters.serverMaxWindowBits) == true));
+                } else if (key == _T("client_max_window_bits")) {
+                    result = ParseWindowBits(value, parameters.clientMaxWindowBits);
+                } else {
+                    result = false;
+                }
+
+                start = end;
+            }
+
+            return (result);
+        }
+
+        Deflate::Deflate()
+            : _settings()
+            , _enabled(false)
+            , _active(false)
+            , _noContextTakeover(false)
+            , _peerNoContextTakeover(false)
+            , _deflater()
+            , _inflater()
+            , _outbound()
+            , _size(0)
+            , _offset(0)
+            , _final(false)
+            , _inbound()
+            , _tail(false)
+            , _draining(false)
+            , _statistics()
+        {
+            ::memset(&_statistics, 0, sizeof(_statistics));
+        }
+
+        Deflate::~Deflate()
+        {
+            Reset();
+        }
+
+        string Deflate::Offer() const
+        {
+            string result(PerMessageDeflate);
+
+            result += _T("; client_max_window_bits");
+
+            if (_settings.clientMaxWindowBits < 15) {
+                result += '=' + Core::NumberType<uint8_t>(_settings.clientMaxWindowBits).Text();
+            }
+            if (_settings.serverMaxWindowBits < 15) {
+                result += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(_settings.serverMaxWindowBits).Text();
+            }
+            if (_settings.serverNoContextTakeover == true) {
+                result += _T("; server_no_context_takeover");
+            }
+            if (_settings.clientNoContextTakeover == true) {
+                result += _T("; client_no_context_takeover");
+            }
+
+            return (result);
+        }
+
+        bool Deflate::Accept(const string& offers, string& response)
+        {
+            size_t start = 0;
+
+            ASSERT(_active == false);
+
+            response.clear();
+
+            // Offers are listed in order of preference, take the first one we can live with.
+            while ((_enabled == true) && (_active == false) && (start != string::npos)) {
+                const size_t end = offers.find(',', start);
+                DeflateParameters offer;
+
+                if (ParseDeflate(offers.substr(start, (end == string::npos ? string::npos : end - start)), offer) == true) {
+                    const uint8_t serverBits = std::min(_settings.serverMaxWindowBits, (offer.serverMaxWindowBits > 1 ? offer.serverMaxWindowBits : static_cast<uint8_t>(15)));
+
+                    // zlib can not deflate with a window of 2^8, decline and try the next offer.
+                    if (serverBits >= 9) {
+                        const bool noContextTakeover = (offer.serverNoContextTakeover || _settings.serverNoContextTakeover);
+                        const bool peerNoContextTakeover = (offer.clientNoContextTakeover || _settings.clientNoContextTakeover);
+
+                        response = PerMessageDeflate;
+
+                        if (noContextTakeover == true) {
+                            response += _T("; server_no_context_takeover");
+                        }
+                        if (peerNoContextTakeover == true) {
+                            response += _T("; client_no_context_takeover");
+                        }
+                        if ((offer.serverMaxWindowBits != 0) || (serverBits < 15)) {
+                            response += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(serverBits).Text();
+                        }
+                        if ((offer.clientMaxWindowBits != 0) && (_settings.clientMaxWindowBits < 15)) {
+                            const uint8_t clientBits = std::min(_settings.clientMaxWindowBits, (offer.clientMaxWindowBits > 1 ? offer.clientMaxWindowBits : static_cast<uint8_t>(15)));
+
+                            response += _T("; client_max_window_bits=") + Core::NumberType<uint8_t>(clientBits).Text();
+                        }
+
+                        Activate(serverBits, noContextTakeover, peerNoContextTakeover);
+                    }
+                }
+
+                start = (end == string::npos ? end : end + 1);
+            }
+
+            return (_active);
+        }
+
+        bool Deflate::Confirm(const string& response)
+        {
+            bool result = true;
+            ASSERT(_active == false);
+
+            if (response.empty() == false) {
+                DeflateParameters answer;
+
+                // The server is only allowed to accept what we offered.
+                if ((_enabled == false) || (response.find(',') != string::npos) || (ParseDeflate(response, answer) == false) || (answer.clientMaxWindowBits == 1)) {
+                    result = false;
+                } else {
+                    const uint8_t clientBits = std::min(_settings.clientMaxWindowBits, (answer.clientMaxWindowBits != 0 ? answer.clientMaxWindowBits : static_cast<uint8_t>(15)));
+
+                    if (clientBits < 9) {
+                        result = false;
+                    } else {
+                        Activate(clientBits, (answer.clientNoContextTakeover || _settings.clientNoContextTakeover), answer.serverNoContextTakeover);
+                    }
+                }
+            }
+
+            return (result);
+        }
+
+        void Deflate::Reset()
+        {
+            if (_active == true) {
+                deflateEnd(&_deflater);
+                inflateEnd(&_inflater);
+
+                _active = false;
+                _size = 0;
+                _offset = 0;
+                _final = false;
+                _tail = false;
+                _draining = false;
+            }
+        }
+
+        void Deflate::Activate(const uint8_t windowBits, const bool noContextTakeover, const bool peerNoContextTakeover)
+        {
+            ::memset(&_deflater, 0, sizeof(_deflater));
+            ::memset(&_inflater, 0, sizeof(_inflater));
+
+            // Negative window bits, a raw deflate stream without zlib header and trailer.
+            if (deflateInit2(&_deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                TRACE_L1("Could not initialize the deflater, window bits: %d", windowBits);
+            } else if (inflateInit2(&_inflater, -15) != Z_OK) {
+                TRACE_L1("Could not initialize the inflater, window bits: %d", 15);
+                deflateEnd(&_deflater);
+            } else {
+                _active = true;
+                _noContextTakeover = noContextTakeover;
+                _peerNoContextTakeover = peerNoContextTakeover;
+                _inbound.resize(InflateChunk);
+            }
+        }
+
+        void Deflate::Compress(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            const uint64_t start = Core::Time::Now().Ticks();
+
+            ASSERT((_active == true) && (Pending() == 0));
+
+            _size = 0;
+            _offset = 0;
+            _final = final;
+
+            _deflater.next_in = const_cast<uint8_t*>(data);
+            _deflater.avail_in = length;
+
+            // Every fragment is sync flushed, so without new input there is nothing to deflate (zlib would report
+            // a Z_BUF_ERROR). A message that ended on a fragment boundary is closed with a final frame holding just
+            // the header byte of an empty stored block, the receiver completes it with the tail (RFC 7692, 7.2.3.6).
+            if ((length == 0) && (final == true)) {
+                if (_outbound.empty() == true) {
+                    _outbound.resize(1024);
+                }
+
+                _outbound[0] = 0x00;
+                _size = 1;
+            }
+            else if (length != 0) {
+                // A sync flush pushes out all input, if the buffer was too small, there is more to come.
+                do {
+                    if ((_outbound.size() - _size) < 64) {
+                        _outbound.resize(_outbound.size() + std::max(static_cast<uint32_t>(length / 2), static_cast<uint32_t>(1024)));
+                    }
+
+                    _deflater.next_out = &(_outbound[_size]);
+                    _deflater.avail_out = static_cast<uInt>(_outbound.size() - _size);
+
+                    deflate(&_deflater, Z_SYNC_FLUSH);
+
+                    _size = static_cast<uint32_t>(_outbound.size() - _deflater.avail_out);
+
+                } while (_deflater.avail_out == 0);
+            }
+
+            if (final == true) {
+                // The message ends with the empty block of the sync flush, the receiver restores it.
+                if ((_size >= sizeof(DeflateTail)) && (::memcmp(&(_outbound[_size - sizeof(DeflateTail)]), DeflateTail, sizeof(DeflateTail)) == 0)) {
+                    _size -= sizeof(DeflateTail);
+                }
+
+                if (_noContextTakeover == true) {
+                    deflateReset(&_deflater);
+                }
+
+                _statistics.messagesOut++;
+            }
+
+            _statistics.rawOut += length;
+            _statistics.deflatedOut += _size;
+            _statistics.ticksOut += (Core::Time::Now().Ticks() - start);
+        }
+
+        uint16_t Deflate::Compressed(uint8_t data[], const uint16_t maxLength, bool& final)
+        {
+            const uint16_t result = static_cast<uint16_t>(std::min(Pending(), static_cast<uint32_t>(maxLength)));
+
+            ::memcpy(data, &(_outbound[_offset]), result);
+
+            _offset += result;
+
+            final = ((_final == true) && (Pending() == 0));
+
+            return (result);
+        }
+
+        void Deflate::Decompress(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            ASSERT(_active == true);
+
+            _inflater.next_in = const_cast<uint8_t*>(data);
+            _inflater.avail_in = length;
+            _tail = final;
+            _draining = true;
+
+            _statistics.deflatedIn += length;
+        }
+
+        uint16_t Deflate::Decompressed(uint8_t*& data)
+        {
+            uint16_t result = 0;
+
+            // Deflate blocks might span fragments, so some input can be consumed without any output.
+            while ((result == 0) && (_draining == true)) {
+                const uint64_t start = Core::Time::Now().Ticks();
+
+                if ((_inflater.avail_in == 0) && (_tail == true)) {
+                    _inflater.next_in = const_cast<uint8_t*>(DeflateTail);
+                    _inflater.avail_in = sizeof(DeflateTail);
+                    _tail = false;
+                    _statistics.messagesIn++;
+                }
+
+                _inflater.next_out = _inbound.data();
+                _inflater.avail_out = static_cast<uInt>(_inbound.size());
+
+                const int status = inflate(&_inflater, Z_SYNC_FLUSH);
+
+                if ((status != Z_OK) && (status != Z_BUF_ERROR) && (status != Z_STREAM_END)) {
+                    TRACE_L1("Inflating a message failed: %d", status);
+                    _inflater.avail_in = 0;
+                    _tail = false;
+                    _draining = false;
+                } else {
+                    result = static_cast<uint16_t>(_inbound.size() - _inflater.avail_out);
+                    data = _inbound.data();
+
+                    // The peer closed the stream with a final block, a new message starts a new one.
+                    if (status == Z_STREAM_END) {
+                        inflateReset(&_inflater);
+                    }
+
+                    // As long as the output buffer is filled up, there might be more.
+                    if ((_inflater.avail_out != 0) && (_inflater.avail_in == 0) && (_tail == false)) {
+                        _draining = false;
+
+                        if ((_peerNoContextTakeover == true) && (_inflater.next_in == &(DeflateTail[sizeof(DeflateTail)]))) {
+                            inflateReset(&_inflater);
+                        }
+                    }
+
+                    _statistics.rawIn += result;
+                }
+
+                _statistics.ticksIn += (Core::Time::Now().Ticks() - start);
+            }
+
+            return (result);
+        }
     }
 }
 }
@@ -63,6 +63,8 @@ namespace Web {
                 , _pendingReceiveBytes(0)
                 , _frameType(TEXT)
                 , _controlStatus(0)
+                , _sendCompressed(false)
+                , _receiveCompressed(false)
             {
                 ::memset(_scrambleKey, 0, sizeof(_scrambleKey));
             }
@@ -122,10 +124,24 @@ namespace Web {
             {
                 return ((_setFlags & 0x80) != 0);
             }
+            // The next message encoded carries a compressed payload, flagged by RSV1 on its first frame (RFC 7692).
+            void CompressMessage()
+            {
+                ASSERT(SendInProgress() == false);
+                _sendCompressed = true;
+            }
+            bool IsCompressedMessage() const
+            {
+                return (_receiveCompressed);
+            }
 
             uint16_t Encoder(uint8_t* dataFrame, const uint16_t maxSendSize, const uint16_t usedSize);
             uint16_t Decoder(uint8_t* dataFrame, uint16_t& receivedSize);
 
+            // Only the header of a data frame carrying payloadSize bytes, the payload follows separately.
+            // If masking is enabled, the payload must be scrambled with the returned maskKey.
+            uint8_t Header(uint8_t* dataFrame, const uint16_t payloadSize, const bool final, uint8_t maskKey[4]);
+
         private:
             inline void GenerateMaskKey(uint8_t *maskKey)
             {
@@ -145,6 +161,114 @@ namespace Web {
             frameType _frameType;
             uint8_t _scrambleKey[4];
             uint8_t _controlStatus;
+            bool _sendCompressed;
+            bool _receiveCompressed;
+        };
+
+        // The permessage-deflate extension (RFC 7692), a compression context in each direction of a link.
+        class EXTERNAL Deflate {
+        public:
+            struct Settings {
+                Settings()
+                    : serverMaxWindowBits(15)
+                    , clientMaxWindowBits(15)
+                    , serverNoContextTakeover(false)
+                    , clientNoContextTakeover(false)
+                    , threshold(128)
+                {
+                }
+
+                // Between 9 and 15, the window size used by zlib is never smaller than 2^9.
+                uint8_t serverMaxWindowBits;
+                uint8_t clientMaxWindowBits;
+                // Forget the history after every message, costs ratio but saves memory in between messages.
+                bool serverNoContextTakeover;
+                bool clientNoContextTakeover;
+                // Messages smaller than this (in bytes) are sent as is.
+                uint16_t threshold;
+            };
+
+            struct Statistics {
+                uint32_t messagesOut;
+                uint64_t rawOut;
+                uint64_t deflatedOut;
+                uint64_t ticksOut; // uS spent compressing
+                uint32_t messagesIn;
+                uint64_t deflatedIn;
+                uint64_t rawIn;
+                uint64_t ticksIn; // uS spent decompressing
+            };
+
+        public:
+            Deflate(const Deflate&) = delete;
+            Deflate& operator=(const Deflate&) = delete;
+
+            Deflate();
+            ~Deflate();
+
+        public:
+            void Configure(const Settings& settings)
+            {
+                ASSERT((settings.serverMaxWindowBits >= 9) && (settings.serverMaxWindowBits <= 15));
+                ASSERT((settings.clientMaxWindowBits >= 9) && (settings.clientMaxWindowBits <= 15));
+
+                _settings = settings;
+                _enabled = true;
+            }
+            bool IsEnabled() const
+            {
+                return (_enabled);
+            }
+            bool IsActive() const
+            {
+                return (_active);
+            }
+            uint16_t Threshold() const
+            {
+                return (_settings.threshold);
+            }
+            uint32_t Pending() const
+            {
+                return (_size - _offset);
+            }
+            const Statistics& Counters() const
+            {
+                return (_statistics);
+            }
+
+            // Handshake, the client offers, the server accepts (and answers) and the client confirms the answer.
+            string Offer() const;
+            bool Accept(const string& offers, string& response);
+            bool Confirm(const string& response);
+            void Reset();
+
+            // Outbound, the compressed message is collected per fragment and can then be framed in chunks.
+            void Compress(const uint8_t data[], const uint16_t length, const bool final);
+            uint16_t Compressed(uint8_t data[], const uint16_t maxLength, bool& final);
+
+            // Inbound, a fragment as received, the decompressed data is then taken out in chunks until none is left.
+            void Decompress(const uint8_t data[], const uint16_t length, const bool final);
+            uint16_t Decompressed(uint8_t*& data);
+
+        private:
+            void Activate(const uint8_t windowBits, const bool noContextTakeover, const bool peerNoContextTakeover);
+
+        private:
+            Settings _settings;
+            bool _enabled;
+            bool _active;
+            bool _noContextTakeover;
+            bool _peerNoContextTakeover;
+            z_stream _deflater;
+            z_stream _inflater;
+            std::vector<uint8_t> _outbound;
+            uint32_t _size;
+            uint32_t _offset;
+            bool _final;
+            std::vector<uint8_t> _inbound;
+            bool _tail;
+            bool _draining;
+            Statistics _statistics;
         };
 
         class EXTERNAL RequestAllocator : public Core::ProxyPoolType<Web::Request> {
@@ -302,6 +426,10 @@ namespace Web {
 
                     // TRACE_L1("Released the ref object %s [%p]\n", typeid(typename OUTBOUND::BaseElement).name(), &static_cast<typename OUTBOUND::BaseElement&>(*realItem));
                 }
+                bool Splice(const Core::File::Handle file, const uint64_t offset, const uint32_t length) override
+                {
+                    return (_parent.Splice(file, offset, length, TemplateIntToType<Core::TypeTraits::same_or_inherits<Core::SocketPort, ACTUALLINK>::value>()));
+                }
 
             private:
                 ThisClass& _parent;
@@ -390,6 +518,9 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _payload(nullptr)
+                , _payloadLength(0)
+                , _deflate()
             {
             }
             template <typename... Args>
@@ -407,6 +538,9 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _payload(nullptr)
+                , _payloadLength(0)
+                , _deflate()
             {
             }
 POP_WARNING()
@@ -479,6 +613,21 @@ POP_WARNING()
             {
                 _handler.Masking(masking);
             }
+            void Compression(const WebSocket::Deflate::Settings& settings)
+            {
+                _adminLock.Lock();
+
+                // Only takes effect on the next upgrade.
+                _deflate.Configure(settings);
+
+                _adminLock.Unlock();
+            }
+            WebSocket::Deflate::Statistics Compression() const
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(_adminLock);
+
+                return (_deflate.Counters());
+            }
             void Ping()
             {
                 _pingFireTime = Core::Time::Now().Ticks();
@@ -562,8 +711,27 @@ POP_WARNING()
                 return (result);
             }
 
-            // Methods to extract and insert data into the socket buffers
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            // Methods to extract and insert data into the socket buffers, the websocket frames
+            // are built and parsed in windows of at most 64KB.
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
+            {
+                return (SendFrames(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
+            }
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
+            {
+                uint32_t result = 0;
+                uint16_t handled;
+
+                do {
+                    handled = ReceiveFrames(&(dataFrame[result]), static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF))));
+                    result += handled;
+                } while ((handled != 0) && (result < receivedSize));
+
+                return (result);
+            }
+
+        private:
+            uint16_t SendFrames(uint8_t* dataFrame, const uint16_t maxSendSize)
             {
                 uint16_t result = 0;
 
@@ -573,8 +741,16 @@ POP_WARNING()
                     _state |= WRITE_ACTIVITY;
 
                 if ((_state & WEBSOCKET) != 0) {
-                    if (maxSendSize > 8) {
-                        result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 8));
+                    if ((_payloadLength == 0) && (_handler.SendInProgress() == false)) {
+                        _payloadLength = _parent.SendPayload(_payload);
+                    }
+
+                    if (_deflate.IsActive() == true) {
+                        result = SendCompressed(dataFrame, maxSendSize);
+                    } else if (_payloadLength != 0) {
+                        result = SendPayload(dataFrame, maxSendSize, TemplateIntToType<Core::TypeTraits::same_or_inherits<Core::SocketPort, ACTUALLINK>::value>());
+                    } else if (maxSendSize > 8) {
+                        result = static_cast<uint16_t>(_parent.SendData(&(dataFrame[4]), static_cast<uint32_t>(maxSendSize - 8)));
 
                         result = _handler.Encoder(dataFrame, (maxSendSize - 8), result);
                     }
@@ -590,7 +766,7 @@ POP_WARNING()
 
                 return (result);
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            uint16_t ReceiveFrames(uint8_t* dataFrame, const uint16_t receivedSize)
             {
                 uint16_t result = 0;
 
@@ -677,9 +853,25 @@ POP_WARNING()
 
                                 result += static_cast<uint16_t>(headerSize + payloadSizeInControlFrame); // actualDataSize
 
+                            } else if ((_handler.IsCompressedMessage() == true) && (_deflate.IsActive() == true)) {
+                                // The last fragment completes the message, the inflater needs to know to flush it all.
+                                const bool final = ((_handler.IsCompleteMessage() == true) && (_handler.ReceiveInProgress() == false));
+
+                                if ((actualDataSize != 0) || (final == true)) {
+                                    uint8_t* inflated;
+                                    uint16_t length;
+
+                                    _deflate.Decompress(&(dataFrame[result + headerSize]), actualDataSize, final);
+
+                                    while ((length = _deflate.Decompressed(inflated)) != 0) {
+                                        _parent.ReceiveData(inflated, static_cast<uint32_t>(length));
+                                    }
+                                }
+
+                                result += (headerSize + actualDataSize);
                             } else {
                                 if (actualDataSize != 0) {
-                                   _parent.ReceiveData(&(dataFrame[result + headerSize]), actualDataSize);
+                                   _parent.ReceiveData(&(dataFrame[result + headerSize]), static_cast<uint32_t>(actualDataSize));
                                 }
 
                                 result += (headerSize + actualDataSize);
@@ -699,6 +891,7 @@ POP_WARNING()
                 return (result);
             }
 
+        public:
             // Signal a state change, Opened, Closed, Accepted or Error
             void StateChange() override
             {
@@ -707,6 +900,8 @@ POP_WARNING()
                 // If the connection is closed by peer 'during' socket write, cleanup response message
                 if (IsClosed() == true) {
                     _serializerImpl.Flush();
+                    _payloadLength = 0;
+                    _deflate.Reset();
                 }
 
                 _parent.StateChange();
@@ -853,6 +1048,12 @@ POP_WARNING()
                                 ASSERT(_protocol.Size() == 1);
                                 _webSocketMessage->WebSocketProtocol = _protocol.First();
                             }
+
+                            string extensions;
+
+                            if ((element->WebSocketExtensions.IsSet() == true) && (_deflate.Accept(element->WebSocketExtensions.Value(), extensions) == true)) {
+                                _webSocketMessage->WebSocketExtensions = extensions;
+                            }
                         }
                     }
 
@@ -914,6 +1115,9 @@ POP_WARNING()
                     if (protocol.empty() == false) {
                         _webSocketMessage->WebSocketProtocol = Web::ProtocolsArray(protocol);
                     }
+                    if (_deflate.IsEnabled() == true) {
+                        _webSocketMessage->WebSocketExtensions = _deflate.Offer();
+                    }
 
                     _query = query;
                     _path = path;
@@ -939,6 +1143,17 @@ POP_WARNING()
 
                     _adminLock.Lock();
 
+                    if (_deflate.Confirm(element->WebSocketExtensions.IsSet() == true ? element->WebSocketExtensions.Value() : string()) == false) {
+                        // The server settled on extensions we can not honour, we can not talk to it.
+                        TRACE_L1("Unsupported websocket extensions: %s", element->WebSocketExtensions.Value().c_str());
+
+                        _adminLock.Unlock();
+
+                        Close(0);
+
+                        return;
+                    }
+
                     // Seems like we succeeded, turn on the link..
                     _state = (_state & 0xF0) | WEBSOCKET;
 
@@ -957,6 +1172,122 @@ POP_WARNING()
                 }
             }
 
+            // File bodies of web messages are sent by the kernel on a plain socket. Other links, e.g.
+            // TLS, need the content to pass through them, so the body is read as before.
+            bool Splice(const Core::File::Handle file, const uint64_t offset, const uint32_t length, const TemplateIntToType<true>&)
+            {
+                return (ACTUALLINK::Splice(file, offset, length));
+            }
+            bool Splice(const Core::File::Handle, const uint64_t, const uint32_t, const TemplateIntToType<false>&)
+            {
+                return (false);
+            }
+
+            // A payload handed out by the parent is framed in chunks of at most 64KB. On a plain
+            // socket, unmasked chunks are gathered from the payload memory, without a copy.
+            uint16_t SendPayload(uint8_t* dataFrame, const uint16_t maxSendSize, const TemplateIntToType<true>&)
+            {
+                uint16_t result = 0;
+
+                if (_handler.Masking() == true) {
+                    result = CopyPayload(dataFrame, maxSendSize);
+                } else if (maxSendSize >= 4) {
+                    const uint16_t chunk = static_cast<uint16_t>(std::min(_payloadLength, static_cast<uint32_t>(0xFFFF)));
+                    uint8_t maskKey[4];
+
+                    result = _handler.Header(dataFrame, chunk, (chunk == _payloadLength), maskKey);
+
+                    ACTUALLINK::Gather(_payload, chunk);
+
+                    _payload += chunk;
+                    _payloadLength -= chunk;
+                }
+
+                return (result);
+            }
+            uint16_t SendPayload(uint8_t* dataFrame, const uint16_t maxSendSize, const TemplateIntToType<false>&)
+            {
+                return (CopyPayload(dataFrame, maxSendSize));
+            }
+            uint16_t CopyPayload(uint8_t* dataFrame, const uint16_t maxSendSize)
+            {
+                uint16_t result = 0;
+
+                if (maxSendSize > 8) {
+                    const uint16_t chunk = static_cast<uint16_t>(std::min(_payloadLength, static_cast<uint32_t>(maxSendSize - 8)));
+                    uint8_t maskKey[4];
+
+                    result = _handler.Header(dataFrame, chunk, (chunk == _payloadLength), maskKey);
+
+                    if (_handler.Masking() == true) {
+                        for (uint16_t index = 0; index < chunk; index++) {
+                            dataFrame[result + index] = (_payload[index] ^ maskKey[index & 0x3]);
+                        }
+                    } else {
+                        ::memcpy(&(dataFrame[result]), _payload, chunk);
+                    }
+
+                    result += chunk;
+                    _payload += chunk;
+                    _payloadLength -= chunk;
+                }
+
+                return (result);
+            }
+
+            // With permessage-deflate, each chunk of a message (from SendData or a payload) is compressed as a
+            // whole, and sent in one or more frames. Messages below the threshold are sent as is.
+            uint16_t SendCompressed(uint8_t* dataFrame, const uint16_t maxSendSize)
+            {
+                uint16_t result = 0;
+
+                if (maxSendSize > 9) {
+                    const uint16_t capacity = (maxSendSize - 8);
+                    bool compressed = (_deflate.Pending() != 0);
+
+                    if (compressed == false) {
+                        const uint8_t* source = &(dataFrame[4]);
+                        bool final;
+
+                        if (_payloadLength != 0) {
+                            result = static_cast<uint16_t>(std::min(_payloadLength, static_cast<uint32_t>(capacity)));
+                            final = (result == _payloadLength);
+                            source = _payload;
+
+                            _payload += result;
+                            _payloadLength -= result;
+                        } else {
+                            result = static_cast<uint16_t>(_parent.SendData(&(dataFrame[4]), static_cast<uint32_t>(capacity)));
+                            final = (result < capacity);
+                        }
+
+                        if ((_handler.SendInProgress() == true) || ((result != 0) && ((final == false) || (result >= std::min(_deflate.Threshold(), capacity))))) {
+                            if (_handler.SendInProgress() == false) {
+                                _handler.CompressMessage();
+                            }
+
+                            _deflate.Compress(source, result, final);
+                            compressed = true;
+                        } else if (source != &(dataFrame[4])) {
+                            ::memcpy(&(dataFrame[4]), source, result);
+                        }
+                    }
+
+                    if (compressed == true) {
+                        bool final;
+
+                        result = _deflate.Compressed(&(dataFrame[4]), (capacity - 1), final);
+
+                        // The encoder marks the frame as final if it does not use the full size.
+                        result = _handler.Encoder(dataFrame, (final == true ? capacity : result), result);
+                    } else {
+                        result = _handler.Encoder(dataFrame, capacity, result);
+                    }
+                }
+
+                return (result);
+            }
+
         private:
             WebSocket::Protocol _handler;
             ParentClass& _parent;
@@ -971,6 +1302,9 @@ POP_WARNING()
             string _commandData;
             Core::ProxyType<typename OUTBOUND::BaseElement> _webSocketMessage;
             uint64_t _pingFireTime;
+            const uint8_t* _payload;
+            uint32_t _payloadLength;
+            WebSocket::Deflate _deflate;
         };
 
     public:
@@ -1053,6 +1387,14 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        void Compression(const WebSocket::Deflate::Settings& settings)
+        {
+            _channel.Compression(settings);
+        }
+        WebSocket::Deflate::Statistics Compression() const
+        {
+            return (_channel.Compression());
+        }
         void ResetActivity()
         {
             return (_channel.ResetActivity());
@@ -1160,11 +1502,49 @@ POP_WARNING()
         virtual void LinkBody(Core::ProxyType<INBOUND>& element) = 0;
         virtual void Received(Core::ProxyType<INBOUND>& element) = 0;
         virtual void Send(const Core::ProxyType<OUTBOUND>& element) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
         virtual void StateChange() = 0;
         virtual bool IsIdle() const = 0;
 
+        // Implement the SendData/ReceiveData taking 32 bits lengths. The pair taking 16 bits lengths is
+        // deprecated, if that is the one implemented, it is fed in windows of at most 64KB.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            return (SendData(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
+        }
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t handled;
+
+            do {
+                window = static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF)));
+                handled = ReceiveData(&(dataFrame[result]), window);
+                result += handled;
+            } while ((handled == window) && (result < receivedSize));
+
+            return (result);
+        }
+        DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+        }
+        DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+        }
+POP_WARNING()
+
+        // Zero copy alternative to SendData, for messages that are already in memory. Return the next
+        // message and its length, it is framed and sent from there and must remain valid until this
+        // method is called again. Returning 0 means there is none, SendData is called instead.
+        virtual uint32_t SendPayload(const uint8_t*& payload)
+        {
+            payload = nullptr;
+            return (0);
+        }
+
     protected:
         void Lock() const {
             _channel.Lock();
@@ -1205,11 +1585,15 @@ POP_WARNING()
             ~Handler() override = default;
 
         public:
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            uint32_t SendPayload(const uint8_t*& payload) override
+            {
+                return (_parent.SendPayload(payload));
+            }
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -1320,6 +1704,14 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        void Compression(const WebSocket::Deflate::Settings& settings)
+        {
+            _channel.Compression(settings);
+        }
+        WebSocket::Deflate::Statistics Compression() const
+        {
+            return (_channel.Compression());
+        }
         uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
@@ -1347,8 +1739,41 @@ POP_WARNING()
 
         virtual bool IsIdle() const = 0;
         virtual void StateChange() = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+
+        // The payload is exchanged like on the WebSocketLinkType, the 16 bits pair is deprecated.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            return (SendData(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
+        }
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t handled;
+
+            do {
+                window = static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF)));
+                handled = ReceiveData(&(dataFrame[result]), window);
+                result += handled;
+            } while ((handled == window) && (result < receivedSize));
+
+            return (result);
+        }
+        DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+        }
+        DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+        }
+POP_WARNING()
+        virtual uint32_t SendPayload(const uint8_t*& payload)
+        {
+            payload = nullptr;
+            return (0);
+        }
 
     private:
         Handler<LINK> _channel;
@@ -1378,11 +1803,15 @@ POP_WARNING()
             ~Handler() override = default;
 
         public:
-            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
             {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
-            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            uint32_t SendPayload(const uint8_t*& payload) override
+            {
+                return (_parent.SendPayload(payload));
+            }
+            uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
             {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -1482,6 +1911,14 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        void Compression(const WebSocket::Deflate::Settings& settings)
+        {
+            _channel.Compression(settings);
+        }
+        WebSocket::Deflate::Statistics Compression() const
+        {
+            return (_channel.Compression());
+        }
         uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
@@ -1509,8 +1946,41 @@ POP_WARNING()
 
         virtual bool IsIdle() const = 0;
         virtual void StateChange() = 0;
-        virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
-        virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
+
+        // The payload is exchanged like on the WebSocketLinkType, the 16 bits pair is deprecated.
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        virtual uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize)
+        {
+            return (SendData(dataFrame, static_cast<uint16_t>(std::min(maxSendSize, static_cast<uint32_t>(0xFFFF)))));
+        }
+        virtual uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize)
+        {
+            uint32_t result = 0;
+            uint16_t window;
+            uint16_t handled;
+
+            do {
+                window = static_cast<uint16_t>(std::min(receivedSize - result, static_cast<uint32_t>(0xFFFF)));
+                handled = ReceiveData(&(dataFrame[result]), window);
+                result += handled;
+            } while ((handled == window) && (result < receivedSize));
+
+            return (result);
+        }
+        DEPRECATED virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            return (static_cast<uint16_t>(SendData(dataFrame, static_cast<uint32_t>(maxSendSize))));
+        }
+        DEPRECATED virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
+        {
+            return (static_cast<uint16_t>(ReceiveData(dataFrame, static_cast<uint32_t>(receivedSize))));
+        }
+POP_WARNING()
+        virtual uint32_t SendPayload(const uint8_t*& payload)
+        {
+            payload = nullptr;
+            return (0);
+        }
 
     private:
         Handler<LINK> _channel;
@@ -0,0 +1,236 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2021 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define MODULE_NAME COMRPCLatency
+
+#include <core/core.h>
+#include <com/com.h>
+
+#include <sys/wait.h>
+
+MODULE_NAME_DECLARATION(BUILD_REFERENCE)
+
+using namespace Thunder;
+
+// Measures the round trip of small COM-RPC calls between a client and a host in
+// another process. With COMRPC_SHARED_MEMORY enabled, the calls go through the
+// shared memory rings negotiated at announce time, otherwise over the socket.
+namespace Latency {
+    struct IEcho : virtual public Core::IUnknown {
+        enum { ID = 0x80000101 };
+        virtual uint32_t Echo(const uint32_t value) = 0;
+    };
+}
+
+class EchoImplementation : public Latency::IEcho {
+public:
+    EchoImplementation() = default;
+    ~EchoImplementation() override = default;
+
+    uint32_t Echo(const uint32_t value) override
+    {
+        return (value);
+    }
+
+    BEGIN_INTERFACE_MAP(EchoImplementation)
+        INTERFACE_ENTRY(Latency::IEcho)
+    END_INTERFACE_MAP
+};
+
+ProxyStub::MethodHandler EchoStubMethods[] = {
+    // virtual uint32_t Echo(const uint32_t) = 0
+    [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+        RPC::Data::Input& input(message->Parameters());
+        RPC::Data::Frame::Reader reader(input.Reader());
+        const uint32_t param0 = reader.Number<uint32_t>();
+
+        Latency::IEcho* implementation = reinterpret_cast<Latency::IEcho*>(input.Implementation());
+        ASSERT(implementation != nullptr);
+        const uint32_t output = implementation->Echo(param0);
+
+        RPC::Data::Frame::Writer writer(message->Response().Writer());
+        writer.Number<const uint32_t>(output);
+    },
+    nullptr
+};
+
+class EchoProxy final : public ProxyStub::UnknownProxyType<Latency::IEcho> {
+public:
+    EchoProxy(const Core::ProxyType<Core::IPCChannel>& channel, Core::instance_id implementation, const bool otherSideInformed)
+        : BaseClass(channel, implementation, otherSideInformed)
+    {
+    }
+
+    uint32_t Echo(const uint32_t param0) override
+    {
+        IPCMessage newMessage(static_cast<const ProxyStub::UnknownProxy&>(*this).Message(0));
+
+        RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+        writer.Number<const uint32_t>(param0);
+
+        uint32_t output{};
+        if ((output = static_cast<const ProxyStub::UnknownProxy&>(*this).Invoke(newMessage)) == Core::ERROR_NONE) {
+            RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+            output = reader.Number<uint32_t>();
+        }
+
+        return (output);
+    }
+};
+
+namespace {
+
+    static class Instantiation {
+    public:
+        Instantiation()
+        {
+            RPC::Administrator::Instance().Announce<Latency::IEcho, EchoProxy, ProxyStub::UnknownStubType<Latency::IEcho, EchoStubMethods>>();
+        }
+    } ProxyStubRegistration;
+
+}
+
+class Host : public RPC::Communicator {
+public:
+    Host() = delete;
+    Host(const Host&) = delete;
+    Host& operator=(const Host&) = delete;
+
+    Host(const Core::NodeId& source)
+        : RPC::Communicator(source, _T(""))
+    {
+        Open(Core::infinite);
+    }
+    ~Host() override
+    {
+        Close(Core::infinite);
+    }
+
+private:
+    void* Acquire(const string& /* className */, const uint32_t interfaceId, const uint32_t /* versionId */) override
+    {
+        void* result = nullptr;
+
+        if (interfaceId == Latency::IEcho::ID) {
+            result = Core::ServiceType<EchoImplementation>::Create<Latency::IEcho>();
+        }
+
+        return (result);
+    }
+};
+
+static void Report(const char label[], std::vector<uint64_t>& samples)
+{
+    std::sort(samples.begin(), samples.end());
+
+    uint64_t total = 0;
+    for (const uint64_t sample : samples) {
+        total += sample;
+    }
+
+    const size_t count = samples.size();
+
+    printf("%s, %u calls (us): min %.2f | avg %.2f | p50 %.2f | p99 %.2f | max %.2f\n", label, static_cast<uint32_t>(count),
+        samples[0] / 1000.0,
+        (total / static_cast<double>(count)) / 1000.0,
+        samples[count / 2] / 1000.0,
+        samples[(count * 99) / 100] / 1000.0,
+        samples[count - 1] / 1000.0);
+}
+
+static uint64_t Nanoseconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((static_cast<uint64_t>(now.tv_sec) * 1000000000) + now.tv_nsec);
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t calls = 100000;
+    const Core::NodeId connector(_T("/tmp/comrpclatency"));
+
+    if (argc > 1) {
+        calls = static_cast<uint32_t>(atoi(argv[1]));
+    }
+
+    int pipes[2];
+    VARIABLE_IS_NOT_USED int status = ::pipe(pipes);
+
+    pid_t child = ::fork();
+
+    if (child == 0) {
+        char signal;
+        ::close(pipes[1]);
+
+        {
+            Host host(connector);
+
+            // Serve until the client closes its end.
+            VARIABLE_IS_NOT_USED ssize_t done = ::read(pipes[0], &signal, sizeof(signal));
+        }
+
+        Core::Singleton::Dispose();
+        ::_exit(0);
+    }
+
+    ::close(pipes[0]);
+
+    // Give the host the time to open its socket.
+    SleepMs(500);
+
+    {
+        Core::ProxyType<RPC::InvokeServerType<1, 0, 4>> engine = Core::ProxyType<RPC::InvokeServerType<1, 0, 4>>::Create();
+        Core::ProxyType<RPC::CommunicatorClient> client = Core::ProxyType<RPC::CommunicatorClient>::Create(connector, Core::ProxyType<Core::IIPCServer>(engine));
+
+        Latency::IEcho* echo = client->Open<Latency::IEcho>(_T("Echo"));
+
+        if (echo == nullptr) {
+            printf("Could not reach the host on %s\n", connector.HostName().c_str());
+        } else {
+            std::vector<uint64_t> samples(calls);
+
+            // Warm up the proxies, pools and caches first.
+            for (uint32_t index = 0; index < std::min(calls, 1000u); index++) {
+                echo->Echo(index);
+            }
+
+            for (uint32_t index = 0; index < calls; index++) {
+                const uint64_t start = Nanoseconds();
+                VARIABLE_IS_NOT_USED const uint32_t value = echo->Echo(index);
+                samples[index] = Nanoseconds() - start;
+
+                ASSERT(value == index);
+            }
+
+            Report((client->IsShared() == true ? "shared memory" : "socket"), samples);
+
+            echo->Release();
+        }
+
+        client->Close(Core::infinite);
+    }
+
+    ::close(pipes[1]);
+    ::waitpid(child, nullptr, 0);
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
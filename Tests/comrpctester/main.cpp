@@ -91,12 +91,12 @@ public:
 
 private:
     // Methods to extract and insert data into the socket buffers
-    uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+    uint32_t SendData(uint8_t* dataFrame, const uint32_t maxSendSize) override
     {
-        uint16_t result = 0;
+        uint32_t result = 0;
         _adminLock.Lock();
         if (_loaded > 0) {
-            result = std::min(maxSendSize, _loaded);
+            result = std::min(maxSendSize, static_cast<uint32_t>(_loaded));
             ::memcpy(dataFrame, _buffer, result);
             if (result == _loaded) {
                 _loaded = 0;
@@ -109,7 +109,7 @@ private:
         _adminLock.Unlock();
         return (result);
     }
-    uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+    uint32_t ReceiveData(uint8_t* dataFrame, const uint32_t receivedSize) override
     {
         if (receivedSize == 0) {
             printf("Received is called without any data!\n");
@@ -690,4 +690,4 @@ int main(int argc, char** argv)
     }
 
     return (result);
-}
\ No newline at end of file
+}
@@ -192,8 +192,8 @@ namespace Core {
        CyclicBufferTest(const CyclicBufferTest&) = delete;
         CyclicBufferTest& operator=(const CyclicBufferTest&) = delete;
 
-       CyclicBufferTest(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite)
-            : ::Thunder::Core::CyclicBuffer(fileName, mode, bufferSize, overwrite)
+       CyclicBufferTest(const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite, const bool mirrored = false)
+            : ::Thunder::Core::CyclicBuffer(fileName, mode, bufferSize, overwrite, mirrored)
         {
         }
        CyclicBufferTest(::Thunder::Core::DataElementFile& dataElementFile, const bool initiator, const uint32_t offset, const uint32_t bufferSize, const bool overwrite)
@@ -594,6 +594,191 @@ namespace Core {
         // Remove after usage before destruction
         buffer.Close();
     }
+    TEST(Core_CyclicBuffer, Mirrored)
+    {
+        std::string bufferName {"cyclicbuffer01"};
+        const uint32_t mode =
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE |
+            ::Thunder::Core::File::Mode::SHAREABLE;
+        const uint32_t pageSize = ::Thunder::Core::SystemInfo::Instance().GetPageSize();
+
+        ::Thunder::Core::CyclicBuffer buffer(bufferName.c_str(), mode, 100, false, true);
+        EXPECT_EQ(buffer.IsValid(), true);
+        EXPECT_EQ(buffer.IsMirrored(), true);
+        // The data takes whole pages.
+        EXPECT_EQ(buffer.Size(), pageSize);
+
+        // Move the head close to the end, so the next write wraps.
+        std::vector<uint8_t> filler(pageSize - 10, 'F');
+        EXPECT_EQ(buffer.Write(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+        EXPECT_EQ(buffer.Read(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+
+        const char testData[] = "123456789012345678901234567890";
+        EXPECT_EQ(buffer.Write(reinterpret_cast<const uint8_t*>(testData), sizeof(testData)), sizeof(testData));
+
+        // Another user of the same buffer picks up the layout.
+        ::Thunder::Core::CyclicBuffer other(bufferName.c_str(), mode, 0, false);
+        EXPECT_EQ(other.IsValid(), true);
+        EXPECT_EQ(other.IsMirrored(), true);
+        EXPECT_EQ(other.Used(), sizeof(testData));
+
+        char peeked[sizeof(testData)] = {};
+        EXPECT_EQ(other.Peek(reinterpret_cast<uint8_t*>(peeked), sizeof(peeked)), sizeof(testData));
+        EXPECT_STREQ(peeked, testData);
+
+        char read[sizeof(testData)] = {};
+        EXPECT_EQ(buffer.Read(reinterpret_cast<uint8_t*>(read), sizeof(read)), sizeof(testData));
+        EXPECT_STREQ(read, testData);
+        EXPECT_EQ(other.Used(), 0u);
+
+        // Remove after usage before destruction
+        buffer.Close();
+    }
+    TEST(Core_CyclicBuffer, Spans)
+    {
+        std::string bufferName {"cyclicbuffer01"};
+        const uint32_t mode =
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE |
+            ::Thunder::Core::File::Mode::SHAREABLE;
+        const char testData[] = "123456789012345678901234567890";
+
+        for (const bool mirrored : { true, false }) {
+            ::Thunder::Core::CyclicBuffer buffer(bufferName.c_str(), mode, 100, false, mirrored);
+            EXPECT_EQ(buffer.IsMirrored(), mirrored);
+
+            uint32_t length = 0;
+            EXPECT_EQ(buffer.ReadSpan(length), nullptr);
+            EXPECT_EQ(length, 0u);
+
+            uint8_t* span = buffer.ReserveSpan(sizeof(testData));
+            ASSERT_NE(span, nullptr);
+            ::memcpy(span, testData, sizeof(testData));
+            EXPECT_EQ(buffer.Used(), 0u);
+            EXPECT_EQ(buffer.CommitSpan(), sizeof(testData));
+            EXPECT_EQ(buffer.Used(), sizeof(testData));
+
+            const uint8_t* entry = buffer.ReadSpan(length);
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(length, sizeof(testData));
+            EXPECT_STREQ(reinterpret_cast<const char*>(entry), testData);
+            EXPECT_EQ(buffer.Used(), sizeof(testData));
+            EXPECT_EQ(buffer.ReleaseSpan(), true);
+            EXPECT_EQ(buffer.Used(), 0u);
+
+            // Move the head close to the end, so the next span wraps.
+            std::vector<uint8_t> filler(buffer.Size() - sizeof(testData) - 10, 'F');
+            EXPECT_EQ(buffer.Write(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+            EXPECT_EQ(buffer.Read(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+
+            span = buffer.ReserveSpan(sizeof(testData));
+
+            if (mirrored == false) {
+                // Not contiguous, so not handed out.
+                EXPECT_EQ(span, nullptr);
+            } else {
+                ASSERT_NE(span, nullptr);
+                ::memcpy(span, testData, sizeof(testData));
+                EXPECT_EQ(buffer.CommitSpan(), sizeof(testData));
+
+                entry = buffer.ReadSpan(length);
+                ASSERT_NE(entry, nullptr);
+                EXPECT_EQ(length, sizeof(testData));
+                EXPECT_STREQ(reinterpret_cast<const char*>(entry), testData);
+                EXPECT_EQ(buffer.ReleaseSpan(), true);
+                EXPECT_EQ(buffer.Used(), 0u);
+            }
+
+            // Remove after usage before destruction
+            buffer.Close();
+        }
+    }
+    TEST(Core_CyclicBuffer, Spans_Refused)
+    {
+        std::string bufferName {"cyclicbuffer01"};
+        const uint32_t mode =
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE |
+            ::Thunder::Core::File::Mode::SHAREABLE;
+
+        ::Thunder::Core::CyclicBuffer buffer(bufferName.c_str(), mode, 100, false, true);
+
+        // Nothing reserved, nothing to commit.
+        EXPECT_EQ(buffer.CommitSpan(), 0u);
+        EXPECT_EQ(buffer.Used(), 0u);
+
+        // Fill it up, no span for what does not fit. The length equals ERROR_INVALID_INPUT_LENGTH.
+        std::vector<uint8_t> filler(buffer.Size() - 10, 'F');
+        EXPECT_EQ(buffer.Write(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+
+        EXPECT_EQ(buffer.ReserveSpan(::Thunder::Core::ERROR_INVALID_INPUT_LENGTH), nullptr);
+        EXPECT_EQ(buffer.CommitSpan(), 0u);
+        EXPECT_EQ(buffer.Used(), filler.size());
+
+        EXPECT_EQ(buffer.Read(filler.data(), static_cast<uint32_t>(filler.size())), filler.size());
+        EXPECT_EQ(buffer.Used(), 0u);
+
+        // Another reservation is pending, the length equals ERROR_ILLEGAL_STATE.
+        const uint8_t data[::Thunder::Core::ERROR_ILLEGAL_STATE] = { 'a', 'b', 'c', 'd', 'e' };
+        EXPECT_EQ(buffer.Reserve(sizeof(data)), sizeof(data));
+
+        uint8_t* span = buffer.ReserveSpan(::Thunder::Core::ERROR_ILLEGAL_STATE);
+        EXPECT_EQ(span, nullptr);
+
+        EXPECT_EQ(buffer.Write(data, sizeof(data)), sizeof(data));
+        EXPECT_EQ(buffer.Used(), sizeof(data));
+        EXPECT_EQ(buffer.CommitSpan(), 0u);
+        EXPECT_EQ(buffer.Used(), sizeof(data));
+
+        // Once the reservation is done, spans are handed out again.
+        span = buffer.ReserveSpan(::Thunder::Core::ERROR_ILLEGAL_STATE);
+        ASSERT_NE(span, nullptr);
+        ::memcpy(span, data, sizeof(data));
+        EXPECT_EQ(buffer.CommitSpan(), sizeof(data));
+        EXPECT_EQ(buffer.Used(), 2 * sizeof(data));
+
+        // Remove after usage before destruction
+        buffer.Close();
+    }
+    TEST(Core_CyclicBuffer, Spans_WithOverWrite)
+    {
+        std::string bufferName {"cyclicbuffer01"};
+        const uint32_t mode =
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE |
+            ::Thunder::Core::File::Mode::SHAREABLE;
+
+        CyclicBufferTest buffer(bufferName.c_str(), mode, 100, true, true);
+        EXPECT_EQ(buffer.IsMirrored(), true);
+
+        // Entries are prefixed by their size, so they can be overwritten as a whole.
+        const uint16_t size = static_cast<uint16_t>((buffer.Size() * 2) / 3);
+
+        uint8_t* span = buffer.ReserveSpan(size);
+        ASSERT_NE(span, nullptr);
+        ::memcpy(span, &size, sizeof(size));
+        ::memset(&span[sizeof(size)], 'A', size - sizeof(size));
+        EXPECT_EQ(buffer.CommitSpan(), size);
+
+        uint32_t length = 0;
+        const uint8_t* entry = buffer.ReadSpan(length);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(length, size);
+
+        // The writer claims the entry that is still being read.
+        span = buffer.ReserveSpan(size);
+        ASSERT_NE(span, nullptr);
+        ::memcpy(span, &size, sizeof(size));
+        ::memset(&span[sizeof(size)], 'B', size - sizeof(size));
+        EXPECT_EQ(buffer.CommitSpan(), size);
+
+        EXPECT_EQ(buffer.ReleaseSpan(), false);
+        EXPECT_EQ(buffer.Used(), size);
+
+        // Remove after usage before destruction
+        buffer.Close();
+    }
     TEST(Core_CyclicBuffer, Using_DataElementFile)
     {
         const uint32_t mode =
@@ -1543,6 +1728,81 @@ namespace Core {
         EXPECT_EQ(buffer.IsLocked(), false);
         buffer.Close();
     }
+    TEST(Core_CyclicBuffer, Wait_ForData)
+    {
+        string bufferName = "cyclicbuffer01";
+        uint32_t cyclicBufferSize = 10;
+
+       ::Thunder::Core::CyclicBuffer buffer(bufferName.c_str(),
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE  |
+            ::Thunder::Core::File::Mode::SHAREABLE, cyclicBufferSize, false);
+
+        EXPECT_EQ(buffer.Wait(10), ::Thunder::Core::ERROR_TIMEDOUT);
+
+        const uint8_t data[] = "abc";
+        std::thread writer([&buffer, &data]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            buffer.Write(data, sizeof(data));
+        });
+
+        EXPECT_EQ(buffer.Wait(), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(buffer.Used(), sizeof(data));
+        writer.join();
+
+        // Data present, so no waiting at all.
+        EXPECT_EQ(buffer.Wait(0), ::Thunder::Core::ERROR_NONE);
+        buffer.Flush();
+
+        std::thread alerter([&buffer]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            buffer.Alert();
+        });
+
+        EXPECT_EQ(buffer.Wait(), ::Thunder::Core::ERROR_ASYNC_ABORTED);
+        alerter.join();
+
+        buffer.Close();
+    }
+    TEST(Core_CyclicBuffer, WaitForRoom)
+    {
+        string bufferName = "cyclicbuffer01";
+        uint32_t cyclicBufferSize = 10;
+
+       ::Thunder::Core::CyclicBuffer buffer(bufferName.c_str(),
+            ::Thunder::Core::File::Mode::USER_READ | ::Thunder::Core::File::Mode::USER_WRITE |
+            ::Thunder::Core::File::Mode::GROUP_READ | ::Thunder::Core::File::Mode::GROUP_WRITE  |
+            ::Thunder::Core::File::Mode::SHAREABLE, cyclicBufferSize, false);
+
+        // Empty, so no waiting at all.
+        EXPECT_EQ(buffer.WaitForRoom(4, 0), ::Thunder::Core::ERROR_NONE);
+
+        const uint8_t data[] = "abcdefg";
+        EXPECT_EQ(buffer.Write(data, sizeof(data)), sizeof(data));
+        EXPECT_EQ(buffer.WaitForRoom(4, 10), ::Thunder::Core::ERROR_TIMEDOUT);
+
+        std::thread reader([&buffer]() {
+            uint8_t loaded[8];
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            EXPECT_EQ(buffer.Read(loaded, sizeof(loaded)), sizeof(loaded));
+        });
+
+        EXPECT_EQ(buffer.WaitForRoom(4, ::Thunder::Core::infinite), ::Thunder::Core::ERROR_NONE);
+        EXPECT_GT(buffer.Free(), 4u);
+        reader.join();
+
+        EXPECT_EQ(buffer.Write(data, sizeof(data)), sizeof(data));
+
+        std::thread alerter([&buffer]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            buffer.Alert();
+        });
+
+        EXPECT_EQ(buffer.WaitForRoom(4, ::Thunder::Core::infinite), ::Thunder::Core::ERROR_ASYNC_ABORTED);
+        alerter.join();
+
+        buffer.Close();
+    }
     
     TEST(Core_CyclicBuffer, DISABLED_LockUnLock_FromParentAndForks)
     {
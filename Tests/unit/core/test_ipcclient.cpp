@@ -87,6 +87,308 @@ namespace Core {
         ::Thunder::Core::Singleton::Dispose();
     }
 
+    typedef ::Thunder::Core::IPCMessageType<11, ::Thunder::Core::IPC::ScalarType<uint32_t>, ::Thunder::Core::IPC::ScalarType<uint32_t>> AttachMessage;
+    typedef ::Thunder::Core::IPCMessageType<12, ::Thunder::Core::IPC::ScalarType<uint32_t>, ::Thunder::Core::IPC::ScalarType<uint32_t>> DoubleMessage;
+    typedef ::Thunder::Core::IPCMessageType<13, ::Thunder::Core::IPC::ScalarType<string>, ::Thunder::Core::IPC::ScalarType<uint32_t>> SizeMessage;
+
+    static const string sharedRingName = _T("/tmp/testserversharedpath.rings");
+
+    // Attaches the server side of the channel to the rings the client created.
+    class HandleAttachMessage : public ::Thunder::Core::IIPCServer {
+    public:
+        HandleAttachMessage(const HandleAttachMessage&) = delete;
+        HandleAttachMessage& operator=(const HandleAttachMessage&) = delete;
+
+        HandleAttachMessage() = default;
+        ~HandleAttachMessage() override = default;
+
+    public:
+        void Procedure(::Thunder::Core::IPCChannel& source, ::Thunder::Core::ProxyType<::Thunder::Core::IIPC>& data) override
+        {
+            ::Thunder::Core::ProxyType<AttachMessage> message(data);
+
+            message->Response() = source.Attach(sharedRingName, false, message->Parameters().Value());
+            source.ReportResponse(data);
+        }
+    };
+
+    class HandleDoubleMessage : public ::Thunder::Core::IIPCServer {
+    public:
+        HandleDoubleMessage(const HandleDoubleMessage&) = delete;
+        HandleDoubleMessage& operator=(const HandleDoubleMessage&) = delete;
+
+        HandleDoubleMessage() = default;
+        ~HandleDoubleMessage() override = default;
+
+    public:
+        void Procedure(::Thunder::Core::IPCChannel& source, ::Thunder::Core::ProxyType<::Thunder::Core::IIPC>& data) override
+        {
+            ::Thunder::Core::ProxyType<DoubleMessage> message(data);
+
+            // Tell the client which path the call took: odd if the shared memory path is in use.
+            message->Response() = (message->Parameters().Value() * 2) + (source.IsShared() == true ? 1 : 0);
+            source.ReportResponse(data);
+        }
+    };
+
+    class HandleSizeMessage : public ::Thunder::Core::IIPCServer {
+    public:
+        HandleSizeMessage(const HandleSizeMessage&) = delete;
+        HandleSizeMessage& operator=(const HandleSizeMessage&) = delete;
+
+        HandleSizeMessage() = default;
+        ~HandleSizeMessage() override = default;
+
+    public:
+        void Procedure(::Thunder::Core::IPCChannel& source, ::Thunder::Core::ProxyType<::Thunder::Core::IIPC>& data) override
+        {
+            ::Thunder::Core::ProxyType<SizeMessage> message(data);
+            const string& text(message->Parameters().Value());
+
+            // Report the length, or nothing if the parts did not come in in order.
+            message->Response() = ((text.empty() == false) && (text.find_first_not_of(text[0]) == string::npos) ? static_cast<uint32_t>(text.length()) : 0);
+            source.ReportResponse(data);
+        }
+    };
+
+    TEST(Core_IPC, IPCClientSharedPath)
+    {
+        constexpr uint32_t initHandshakeValue = 0, maxWaitTime = 4, maxWaitTimeMs = 4000, maxInitTime = 2000;
+        constexpr uint8_t maxRetries = 1;
+        constexpr uint32_t ringSize = 4096;
+
+        const std::string connector = _T("/tmp/testserversharedpath");
+
+        IPTestAdministrator::Callback callback_child = [&](IPTestAdministrator& testAdmin) {
+            ::Thunder::Core::NodeId serverNode(connector.c_str());
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> > factory(::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> >::Create());
+
+            factory->CreateFactory<AttachMessage>(1);
+            factory->CreateFactory<DoubleMessage>(2);
+            factory->CreateFactory<SizeMessage>(1);
+
+            ::Thunder::Core::IPCChannelServerType<::Thunder::Core::Void, false> serverChannel(serverNode, 512, factory);
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::IIPCServer> attachHandler(::Thunder::Core::ProxyType<HandleAttachMessage>::Create());
+            ::Thunder::Core::ProxyType<::Thunder::Core::IIPCServer> doubleHandler(::Thunder::Core::ProxyType<HandleDoubleMessage>::Create());
+            ::Thunder::Core::ProxyType<::Thunder::Core::IIPCServer> sizeHandler(::Thunder::Core::ProxyType<HandleSizeMessage>::Create());
+
+            serverChannel.Register(AttachMessage::Id(), attachHandler);
+            serverChannel.Register(DoubleMessage::Id(), doubleHandler);
+            serverChannel.Register(SizeMessage::Id(), sizeHandler);
+
+            ASSERT_EQ(serverChannel.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // A server cannot 'end' its life if clients are connected
+            ASSERT_EQ(testAdmin.Wait(initHandshakeValue), ::Thunder::Core::ERROR_NONE);
+
+            // Do not unregister any / the last handler prior the call of cleanup
+            serverChannel.Cleanup();
+
+            serverChannel.Unregister(SizeMessage::Id());
+            serverChannel.Unregister(DoubleMessage::Id());
+            serverChannel.Unregister(AttachMessage::Id());
+            sizeHandler.Release();
+            doubleHandler.Release();
+            attachHandler.Release();
+
+            factory->DestroyFactory<SizeMessage>();
+            factory->DestroyFactory<DoubleMessage>();
+            factory->DestroyFactory<AttachMessage>();
+
+            ASSERT_EQ(serverChannel.Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator::Callback callback_parent = [&](IPTestAdministrator& testAdmin) {
+            // A small delay so the child can be set up
+            SleepMs(maxInitTime);
+
+            ::Thunder::Core::NodeId clientNode(connector.c_str());
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> > factory(::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> >::Create());
+
+            factory->CreateFactory<AttachMessage>(1);
+            factory->CreateFactory<DoubleMessage>(2);
+            factory->CreateFactory<SizeMessage>(1);
+
+            ::Thunder::Core::IPCChannelClientType<::Thunder::Core::Void, false, false> clientChannel(clientNode, 512, factory);
+
+            ASSERT_EQ(clientChannel.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // Over the socket, as long as the rings are not established.
+            ::Thunder::Core::ProxyType<DoubleMessage> message(::Thunder::Core::ProxyType<DoubleMessage>::Create(::Thunder::Core::IPC::ScalarType<uint32_t>(1)));
+
+            EXPECT_EQ(clientChannel.Invoke(message, maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+            EXPECT_EQ(message->Response().Value(), static_cast<uint32_t>(2));
+
+            ASSERT_EQ(clientChannel.Attach(sharedRingName, true, ringSize), ::Thunder::Core::ERROR_NONE);
+            EXPECT_FALSE(clientChannel.IsShared());
+
+            ::Thunder::Core::ProxyType<AttachMessage> attach(::Thunder::Core::ProxyType<AttachMessage>::Create(::Thunder::Core::IPC::ScalarType<uint32_t>(ringSize)));
+
+            ASSERT_EQ(clientChannel.Invoke(attach, maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+            ASSERT_EQ(attach->Response().Value(), ::Thunder::Core::ERROR_NONE);
+
+            clientChannel.Established();
+            EXPECT_TRUE(clientChannel.IsShared());
+
+            // Many more calls than fit in the rings at once.
+            for (uint32_t index = 0; index < 1000; index++) {
+                message->Clear();
+                message->Parameters() = index;
+
+                EXPECT_EQ(clientChannel.Invoke(message, maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+                EXPECT_EQ(message->Response().Value(), (index * 2) + 1);
+            }
+
+            // Larger than the rings, it goes through them in parts.
+            ::Thunder::Core::ProxyType<SizeMessage> large(::Thunder::Core::ProxyType<SizeMessage>::Create(::Thunder::Core::IPC::ScalarType<string>(string(3 * ringSize, 'x'))));
+
+            EXPECT_EQ(clientChannel.Invoke(large, maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+            EXPECT_EQ(large->Response().Value(), 3 * ringSize);
+
+            clientChannel.Detach();
+            EXPECT_FALSE(clientChannel.IsShared());
+
+            factory->DestroyFactory<SizeMessage>();
+            factory->DestroyFactory<DoubleMessage>();
+            factory->DestroyFactory<AttachMessage>();
+
+            ASSERT_EQ(clientChannel.Source().Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // Signal the server it can 'end' its life
+            ASSERT_EQ(testAdmin.Signal(initHandshakeValue, maxRetries), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator testAdmin(callback_parent, callback_child, initHandshakeValue, maxWaitTime);
+
+        // Code after this line is executed by both parent and child
+
+        ::Thunder::Core::Singleton::Dispose();
+    }
+
+#ifdef __CORE_IPC_PIPELINING__
+    typedef ::Thunder::Core::IPCMessageType<10, ::Thunder::Core::IPC::ScalarType<uint32_t>, ::Thunder::Core::IPC::ScalarType<uint32_t>> SequenceMessage;
+
+    // Holds on to the calls until all of them arrived, and answers them in reverse order.
+    class HandleSequenceMessage : public ::Thunder::Core::IIPCServer {
+    public:
+        HandleSequenceMessage(const HandleSequenceMessage&) = delete;
+        HandleSequenceMessage& operator=(const HandleSequenceMessage&) = delete;
+
+        HandleSequenceMessage(const uint8_t expected)
+            : _expected(expected)
+            , _pending()
+        {
+        }
+        ~HandleSequenceMessage() override = default;
+
+    public:
+        void Procedure(::Thunder::Core::IPCChannel& source, ::Thunder::Core::ProxyType<::Thunder::Core::IIPC>& data) override
+        {
+            _pending.push_back(data);
+
+            if (_pending.size() == _expected) {
+                while (_pending.empty() == false) {
+                    ::Thunder::Core::ProxyType<SequenceMessage> message(_pending.back());
+
+                    message->Response() = (message->Parameters().Value() * 2);
+                    source.ReportResponse(_pending.back());
+
+                    _pending.pop_back();
+                }
+            }
+        }
+
+    private:
+        const uint8_t _expected;
+        std::vector<::Thunder::Core::ProxyType<::Thunder::Core::IIPC>> _pending;
+    };
+
+    TEST(Core_IPC, IPCClientPipelined)
+    {
+        constexpr uint32_t initHandshakeValue = 0, maxWaitTime = 4, maxWaitTimeMs = 4000, maxInitTime = 2000;
+        constexpr uint8_t maxRetries = 1;
+        constexpr uint8_t calls = 8;
+
+        const std::string connector = _T("/tmp/testserverpipelined");
+
+        IPTestAdministrator::Callback callback_child = [&](IPTestAdministrator& testAdmin) {
+            ::Thunder::Core::NodeId serverNode(connector.c_str());
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> > factory(::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> >::Create());
+
+            factory->CreateFactory<SequenceMessage>(calls);
+
+            ::Thunder::Core::IPCChannelServerType<::Thunder::Core::Void, false> serverChannel(serverNode, 512, factory);
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::IIPCServer> handler(::Thunder::Core::ProxyType<HandleSequenceMessage>::Create(calls));
+
+            serverChannel.Register(SequenceMessage::Id(), handler);
+
+            ASSERT_EQ(serverChannel.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // A server cannot 'end' its life if clients are connected
+            ASSERT_EQ(testAdmin.Wait(initHandshakeValue), ::Thunder::Core::ERROR_NONE);
+
+            // Do not unregister any / the last handler prior the call of cleanup
+            serverChannel.Cleanup();
+
+            serverChannel.Unregister(SequenceMessage::Id());
+            handler.Release();
+
+            factory->DestroyFactory<SequenceMessage>();
+
+            ASSERT_EQ(serverChannel.Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator::Callback callback_parent = [&](IPTestAdministrator& testAdmin) {
+            // A small delay so the child can be set up
+            SleepMs(maxInitTime);
+
+            ::Thunder::Core::NodeId clientNode(connector.c_str());
+
+            ::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> > factory(::Thunder::Core::ProxyType<::Thunder::Core::FactoryType<::Thunder::Core::IIPC, uint32_t> >::Create());
+
+            factory->CreateFactory<SequenceMessage>(calls);
+
+            ::Thunder::Core::IPCChannelClientType<::Thunder::Core::Void, false, false> clientChannel(clientNode, 512, factory);
+
+            ASSERT_EQ(clientChannel.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // All calls need to be on the channel at the same time, before the server answers any of them.
+            std::vector<std::thread> threads;
+
+            for (uint8_t index = 0; index < calls; index++) {
+                threads.emplace_back([&clientChannel, index, maxWaitTimeMs]() {
+                    ::Thunder::Core::ProxyType<SequenceMessage> message(::Thunder::Core::ProxyType<SequenceMessage>::Create(::Thunder::Core::IPC::ScalarType<uint32_t>(index + 1)));
+
+                    EXPECT_EQ(clientChannel.Invoke(message, maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+                    EXPECT_EQ(message->Response().Value(), static_cast<uint32_t>((index + 1) * 2));
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            factory->DestroyFactory<SequenceMessage>();
+
+            ASSERT_EQ(clientChannel.Source().Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            // Signal the server it can 'end' its life
+            ASSERT_EQ(testAdmin.Signal(initHandshakeValue, maxRetries), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator testAdmin(callback_parent, callback_child, initHandshakeValue, maxWaitTime);
+
+        // Code after this line is executed by both parent and child
+
+        ::Thunder::Core::Singleton::Dispose();
+    }
+#endif
+
 } // Core
 } // Tests
 } // Thunder
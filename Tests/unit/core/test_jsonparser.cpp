@@ -20,6 +20,7 @@
 #include <functional>
 #include <sstream>
 #include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -244,6 +245,36 @@ namespace Core {
         });
     }
 
+    TEST(JSONParser, VectorArray)
+    {
+        TestData data;
+        data.key = "key";
+        data.keyToPutInJson = "\"" + data.key + "\"";
+        data.value = "[1, 2, 3, 40000]";
+        data.valueToPutInJson = data.value;
+        ExecutePrimitiveJsonTest<::Thunder::Core::JSON::VectorType<::Thunder::Core::JSON::DecUInt32>>(
+            data, true, [](const ::Thunder::Core::JSON::VectorType<::Thunder::Core::JSON::DecUInt32>& v) {
+            EXPECT_EQ(4u, v.Length());
+            EXPECT_EQ(1u, v[0].Value());
+            EXPECT_EQ(40000u, v[3].Value());
+
+            uint32_t sum = 0;
+            ::Thunder::Core::JSON::VectorType<::Thunder::Core::JSON::DecUInt32>::ConstIterator index(v.Elements());
+            while (index.Next() == true) {
+                sum += index.Current().Value();
+            }
+            EXPECT_EQ(40006u, sum);
+
+            string text;
+            v.ToString(text);
+            EXPECT_EQ("[1,2,3,40000]", text);
+
+            ::Thunder::Core::JSON::VectorType<::Thunder::Core::JSON::DecUInt32> copy(v);
+            EXPECT_EQ(4u, copy.Length());
+            EXPECT_EQ(2u, copy[1].Value());
+        });
+    }
+
     TEST(JSONParser, NullArray)
     {
         TestData data;
@@ -2912,6 +2943,255 @@ namespace Core {
         }
     }
 
+    TEST(JSONParser, StringBeyond64KB)
+    {
+        const string value(200000, 'x');
+        ::Thunder::Core::JSON::String input;
+        ::Thunder::Core::JSON::String output;
+        string text;
+
+        input = value;
+        EXPECT_TRUE(input.ToString(text));
+        EXPECT_EQ(text.length(), value.length() + 2);
+
+        EXPECT_TRUE(output.FromString(text));
+        EXPECT_EQ(output.Value(), value);
+    }
+
+    TEST(JSONParser, StringSpecialCharacterAnyPosition)
+    {
+        // Every position within and around the blocks scanned at once.
+        const char specials[] = { '\"', '\\', '/', '\n', 0x01, 0x7F };
+
+        for (const char special : specials) {
+            for (uint32_t position = 0; position < 70; position++) {
+                string value(70, 'a');
+                value[position] = special;
+                value += "\xC3\xA9";
+
+                ::Thunder::Core::JSON::String input;
+                ::Thunder::Core::JSON::String output;
+                string text;
+
+                input = value;
+                EXPECT_TRUE(input.ToString(text));
+                EXPECT_EQ(text.substr(0, position + 1), "\"" + string(position, 'a'));
+                EXPECT_EQ(text[position + 1], '\\');
+
+                EXPECT_TRUE(output.FromString(text));
+                EXPECT_EQ(output.Value(), value);
+            }
+        }
+    }
+
+    TEST(JSONParser, StringSerializeInChunks)
+    {
+        const string value = string(40, 'a') + "\"quoted\" and \\ escaped/" + string(40, 'b');
+        ::Thunder::Core::JSON::String input;
+        string expected;
+
+        input = value;
+        EXPECT_TRUE(input.ToString(expected));
+
+        char buffer[5];
+        uint32_t offset = 0;
+        string text;
+
+        do {
+            const uint32_t loaded = input.Serialize(buffer, sizeof(buffer), offset);
+            text.append(buffer, loaded);
+        } while (offset != 0);
+
+        EXPECT_EQ(text, expected);
+    }
+
+    TEST(JSONParser, ContainerFieldIndex)
+    {
+        class Fields : public ::Thunder::Core::JSON::Container {
+        public:
+            Fields(const Fields&) = delete;
+            Fields& operator=(const Fields&) = delete;
+
+            Fields()
+                : ::Thunder::Core::JSON::Container()
+                , Zulu()
+                , Alpha()
+                , Mike()
+                , Extra()
+            {
+                Add(_T("zulu"), &Zulu);
+                Add(_T("alpha"), &Alpha);
+                Add(_T("mike"), &Mike);
+            }
+            ~Fields() override = default;
+
+            void Swap()
+            {
+                Remove(_T("mike"));
+                Add(_T("extra"), &Extra);
+            }
+
+        public:
+            ::Thunder::Core::JSON::DecUInt32 Zulu;
+            ::Thunder::Core::JSON::String Alpha;
+            ::Thunder::Core::JSON::Boolean Mike;
+            ::Thunder::Core::JSON::DecUInt32 Extra;
+        };
+
+        const string text = _T("{\"mike\":true,\"unknown\":1,\"alpha\":\"a\",\"zulu\":26,\"extra\":5}");
+
+        // Both instances use the index built for the type by the first one.
+        for (uint8_t run = 0; run < 2; run++) {
+            Fields fields;
+            EXPECT_TRUE(fields.FromString(text));
+            EXPECT_EQ(fields.Zulu.Value(), 26u);
+            EXPECT_STREQ(fields.Alpha.Value().c_str(), _T("a"));
+            EXPECT_TRUE(fields.Mike.Value());
+            EXPECT_FALSE(fields.Extra.IsSet());
+        }
+
+        // Changing the fields after the first parse falls back to a linear search.
+        Fields changed;
+        EXPECT_TRUE(changed.FromString(text));
+        changed.Clear();
+        changed.Swap();
+        EXPECT_TRUE(changed.FromString(text));
+        EXPECT_FALSE(changed.Mike.IsSet());
+        EXPECT_EQ(changed.Extra.Value(), 5u);
+
+        // An instance that differs from the type index before its first parse as well.
+        Fields different;
+        different.Swap();
+        EXPECT_TRUE(different.FromString(text));
+        EXPECT_FALSE(different.Mike.IsSet());
+        EXPECT_EQ(different.Extra.Value(), 5u);
+        EXPECT_EQ(different.Zulu.Value(), 26u);
+    }
+
+    TEST(JSONParser, ContainerFieldIndexConcurrent)
+    {
+        class Fields : public ::Thunder::Core::JSON::Container {
+        public:
+            Fields(const Fields&) = delete;
+            Fields& operator=(const Fields&) = delete;
+
+            Fields()
+                : ::Thunder::Core::JSON::Container()
+                , Yankee()
+                , Bravo()
+            {
+                Add(_T("yankee"), &Yankee);
+                Add(_T("bravo"), &Bravo);
+            }
+            ~Fields() override = default;
+
+        public:
+            ::Thunder::Core::JSON::DecUInt32 Yankee;
+            ::Thunder::Core::JSON::DecUInt32 Bravo;
+        };
+
+        const string text = _T("{\"bravo\":2,\"yankee\":25}");
+        std::atomic<uint32_t> failures(0);
+        std::vector<std::thread> threads;
+
+        // All threads race to build the index of the same type on their first lookup.
+        for (uint8_t index = 0; index < 4; index++) {
+            threads.emplace_back([&text, &failures]() {
+                for (uint16_t run = 0; run < 100; run++) {
+                    Fields fields;
+
+                    if ((fields.FromString(text) == false) || (fields.Yankee.Value() != 25) || (fields.Bravo.Value() != 2)) {
+                        failures++;
+                    }
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(failures.load(), 0u);
+    }
+
+    TEST(JSONParser, OpaqueParametersInChunks)
+    {
+        const string input = R"({"jsonrpc":"2.0","id":42,"method":"Test.1.set","params":{"name":"a \"b\" [c]","list":[1, 2,{"x":"}"}],"flag":true}})";
+        const string params = R"({"name":"a \"b\" [c]","list":[1,2,{"x":"}"}],"flag":true})";
+
+        // Feed the message in small pieces, so the opaque runs get split over calls.
+        for (uint8_t chunk = 1; chunk < 8; chunk++) {
+            ::Thunder::Core::JSONRPC::Message message;
+            ::Thunder::Core::OptionalType<::Thunder::Core::JSON::Error> error;
+            uint32_t offset = 0;
+            uint32_t handled = 0;
+
+            while (handled <= input.length()) {
+                const uint32_t size = std::min(static_cast<uint32_t>(chunk), static_cast<uint32_t>(input.length() + 1 - handled));
+                handled += static_cast<::Thunder::Core::JSON::IElement&>(message).Deserialize(&(input.c_str()[handled]), size, offset, error);
+                if (offset == 0) {
+                    break;
+                }
+            }
+
+            EXPECT_FALSE(error.IsSet());
+            EXPECT_EQ(message.Id.Value(), 42u);
+            EXPECT_STREQ(message.Parameters.Value().c_str(), params.c_str());
+        }
+
+        ::Thunder::Core::JSONRPC::Message response;
+        string result = R"({"value":1})";
+        string output;
+        response.Id = 42;
+        response.Result = std::move(result);
+        response.ToString(output);
+        EXPECT_STREQ(output.c_str(), R"({"jsonrpc":"2.0","id":42,"result":{"value":1}})");
+    }
+
+    // Implements the deprecated 16 bits variants only.
+    class LegacyElement : public ::Thunder::Core::JSON::IElement {
+    public:
+        LegacyElement() = default;
+        ~LegacyElement() override = default;
+
+        void Clear() override { }
+        bool IsSet() const override { return (true); }
+        bool IsNull() const override { return (false); }
+
+PUSH_WARNING(DISABLE_WARNING_DEPRECATED_USE)
+        using ::Thunder::Core::JSON::IElement::Serialize;
+        using ::Thunder::Core::JSON::IElement::Deserialize;
+
+        uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+        {
+            uint16_t result = 0;
+
+            if (maxLength >= 4) {
+                ::memcpy(stream, "true", 4);
+                offset = 0;
+                result = 4;
+            }
+
+            return (result);
+        }
+        uint16_t Deserialize(const char[], const uint16_t, uint32_t& offset, ::Thunder::Core::OptionalType<::Thunder::Core::JSON::Error>&) override
+        {
+            offset = 0;
+            return (0);
+        }
+POP_WARNING()
+    };
+
+    TEST(JSONParser, DeprecatedSerializeVariants)
+    {
+        char buffer[16];
+        uint32_t offset = 0;
+
+        LegacyElement legacy;
+        EXPECT_EQ(static_cast<const ::Thunder::Core::JSON::IElement&>(legacy).Serialize(buffer, static_cast<uint32_t>(sizeof(buffer)), offset), 4u);
+        EXPECT_EQ(string(buffer, 4), "true");
+    }
+
 } // Core
 } // Tests
 } // Thunder
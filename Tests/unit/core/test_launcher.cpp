@@ -0,0 +1,254 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#ifndef MODULE_NAME
+#include "../Module.h"
+#endif
+
+#include <core/core.h>
+#include <messaging/messaging.h>
+#include <Thunder/Launcher.h>
+
+namespace Thunder {
+namespace Tests {
+namespace Core {
+
+    class LauncherService {
+    public:
+        LauncherService() = delete;
+        LauncherService(const LauncherService&) = delete;
+        LauncherService& operator=(const LauncherService&) = delete;
+
+        LauncherService(const string& callsign, const uint32_t order, const uint32_t dependencies, const std::vector<uint8_t>& controls)
+            : _callsign(callsign)
+            , _order(order)
+            , _dependencies(dependencies)
+            , _controls(controls)
+            , _started(0)
+            , _completed(0)
+        {
+        }
+        ~LauncherService() = default;
+
+    public:
+        const string& Callsign() const
+        {
+            return (_callsign);
+        }
+        uint32_t StartupOrder() const
+        {
+            return (_order);
+        }
+        uint32_t SubSystemDependencies() const
+        {
+            return (_dependencies);
+        }
+        const std::vector<uint8_t>& SubSystemControl() const
+        {
+            return (_controls);
+        }
+        void Started(const uint32_t tick)
+        {
+            _started = tick;
+        }
+        void Completed(const uint32_t tick)
+        {
+            _completed = tick;
+        }
+        uint32_t Started() const
+        {
+            return (_started);
+        }
+        uint32_t Completed() const
+        {
+            return (_completed);
+        }
+
+    private:
+        const string _callsign;
+        const uint32_t _order;
+        const uint32_t _dependencies;
+        const std::vector<uint8_t> _controls;
+        uint32_t _started;
+        uint32_t _completed;
+    };
+
+    using LauncherServiceProxy = ::Thunder::Core::ProxyType<LauncherService>;
+
+    class LauncherTester : public ::Thunder::PluginHost::LauncherType<LauncherServiceProxy> {
+    public:
+        LauncherTester() = delete;
+        LauncherTester(const LauncherTester&) = delete;
+        LauncherTester& operator=(const LauncherTester&) = delete;
+
+        LauncherTester(const uint8_t slots)
+            : ::Thunder::PluginHost::LauncherType<LauncherServiceProxy>(slots)
+            , _lock()
+            , _tick(0)
+            , _running(0)
+            , _maxRunning(0)
+        {
+        }
+        ~LauncherTester() override = default;
+
+    public:
+        uint8_t MaxRunning() const
+        {
+            return (_maxRunning);
+        }
+
+    private:
+        void Launch(const LauncherServiceProxy& service) override
+        {
+            _lock.Lock();
+            service->Started(++_tick);
+            _running++;
+            _maxRunning = std::max(_maxRunning, _running);
+            _lock.Unlock();
+
+            // Give the others a chance to run next to this one.
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            _lock.Lock();
+            _running--;
+            service->Completed(++_tick);
+            _lock.Unlock();
+        }
+
+    private:
+        ::Thunder::Core::CriticalSection _lock;
+        uint32_t _tick;
+        uint8_t _running;
+        uint8_t _maxRunning;
+    };
+
+    class LauncherPool : public ::Thunder::Core::WorkerPool {
+    private:
+        class Dispatcher : public ::Thunder::Core::ThreadPool::IDispatcher {
+        public:
+            Dispatcher(const Dispatcher&) = delete;
+            Dispatcher& operator=(const Dispatcher&) = delete;
+
+            Dispatcher() = default;
+            ~Dispatcher() override = default;
+
+        private:
+            void Initialize() override { }
+            void Deinitialize() override { }
+            void Dispatch(::Thunder::Core::IDispatch* job) override
+            {
+                job->Dispatch();
+            }
+        };
+
+    public:
+        LauncherPool() = delete;
+        LauncherPool(const LauncherPool&) = delete;
+        LauncherPool& operator=(const LauncherPool&) = delete;
+
+        LauncherPool(const uint8_t threads)
+            : ::Thunder::Core::WorkerPool(threads, 0, 16, &_dispatcher)
+            , _dispatcher()
+        {
+            ::Thunder::Core::WorkerPool::Assign(this);
+            Run();
+        }
+        ~LauncherPool()
+        {
+            Stop();
+            ::Thunder::Core::WorkerPool::Assign(nullptr);
+        }
+
+    private:
+        Dispatcher _dispatcher;
+    };
+
+    TEST(Core_Launcher, ParallelWithDependencies)
+    {
+        LauncherPool pool(4);
+
+        // "first" controls subsystem 3, "second" depends on it, "third" is free to go right away. The
+        // next startup order levels have to wait for all of the first level.
+        LauncherServiceProxy first = LauncherServiceProxy::Create(_T("first"), 1, 0, std::vector<uint8_t>({ 3 }));
+        LauncherServiceProxy second = LauncherServiceProxy::Create(_T("second"), 1, (1 << 3), std::vector<uint8_t>());
+        LauncherServiceProxy third = LauncherServiceProxy::Create(_T("third"), 1, 0, std::vector<uint8_t>());
+        LauncherServiceProxy fourth = LauncherServiceProxy::Create(_T("fourth"), 2, 0, std::vector<uint8_t>());
+        LauncherServiceProxy fifth = LauncherServiceProxy::Create(_T("fifth"), 2, 0, std::vector<uint8_t>());
+        LauncherServiceProxy last = LauncherServiceProxy::Create(_T("last"), 3, 0, std::vector<uint8_t>());
+
+        LauncherTester launcher(3);
+
+        // Added out of order on purpose.
+        launcher.Add(last);
+        launcher.Add(fifth);
+        launcher.Add(second);
+        launcher.Add(fourth);
+        launcher.Add(third);
+        launcher.Add(first);
+
+        launcher.Follow();
+        launcher.Run();
+
+        for (const LauncherServiceProxy& service : { first, second, third, fourth, fifth, last }) {
+            EXPECT_NE(service->Started(), 0u) << service->Callsign();
+            EXPECT_GT(service->Completed(), service->Started()) << service->Callsign();
+        }
+
+        EXPECT_GT(second->Started(), first->Completed());
+
+        for (const LauncherServiceProxy& leader : { first, second, third }) {
+            EXPECT_GT(fourth->Started(), leader->Completed());
+            EXPECT_GT(fifth->Started(), leader->Completed());
+        }
+
+        EXPECT_GT(last->Started(), fourth->Completed());
+        EXPECT_GT(last->Started(), fifth->Completed());
+
+        EXPECT_GE(launcher.MaxRunning(), 2);
+        EXPECT_LE(launcher.MaxRunning(), 3);
+    }
+
+    TEST(Core_Launcher, CircularDependencies)
+    {
+        LauncherPool pool(2);
+
+        // Both control what the other depends upon, one of them must be started anyway.
+        LauncherServiceProxy first = LauncherServiceProxy::Create(_T("first"), 1, (1 << 4), std::vector<uint8_t>({ 3 }));
+        LauncherServiceProxy second = LauncherServiceProxy::Create(_T("second"), 1, (1 << 3), std::vector<uint8_t>({ 4 }));
+
+        LauncherTester launcher(2);
+
+        launcher.Add(first);
+        launcher.Add(second);
+
+        launcher.Follow();
+        launcher.Run();
+
+        EXPECT_NE(first->Started(), 0u);
+        EXPECT_NE(second->Started(), 0u);
+        EXPECT_EQ(launcher.MaxRunning(), 1);
+    }
+
+} // Core
+} // Tests
+} // Thunder
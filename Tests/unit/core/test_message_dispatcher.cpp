@@ -18,6 +18,7 @@
  */
 
 #include <fstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -75,6 +76,16 @@ namespace Core {
             ::Thunder::Core::Singleton::Dispose();
         }
 
+        // Pushed data is expected to be readable right away, also when it is staged per thread first.
+        static uint32_t Push(::Thunder::Messaging::MessageDataBuffer& dispatcher, const uint16_t length, const uint8_t* value)
+        {
+            uint32_t result = dispatcher.PushData(length, value);
+#ifdef MESSAGE_BATCHING_ENABLED
+            dispatcher.Flush();
+#endif
+            return (result);
+        }
+
         std::unique_ptr<::Thunder::Messaging::MessageDataBuffer> _dispatcher;
         string _identifier;
         string _basePath;
@@ -93,7 +104,7 @@ namespace Core {
         uint16_t readLength = sizeof(readData);
 
         //act
-        ASSERT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         //assert
@@ -111,7 +122,7 @@ namespace Core {
         uint16_t readLength = sizeof(readData);
 
         //act
-        ASSERT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_GENERAL);
 
         //assert
@@ -129,7 +140,7 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        ASSERT_EQ(writerDispatcher.PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(writerDispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(readerDispatcher.PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         ASSERT_EQ(readLength, sizeof(testData));
@@ -155,7 +166,7 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        ASSERT_EQ(writerDispatcher.PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(writerDispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(readerDispatcher.PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         ASSERT_EQ(readLength, sizeof(testData));
@@ -171,7 +182,7 @@ namespace Core {
         uint16_t readLength = sizeof(readData);
 
         //first read, write, assert
-        ASSERT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         ASSERT_EQ(readLength, sizeof(testData));
@@ -181,7 +192,7 @@ namespace Core {
         //second read, write, assert
         testData[0] = 40;
         readLength = sizeof(readData);
-        ASSERT_EQ(_dispatcher->PushData(1, testData), ::Thunder::Core::ERROR_NONE);
+        ASSERT_EQ(Push(*_dispatcher, 1, testData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
         ASSERT_EQ(readLength, 1);
         ASSERT_EQ(readData[0], 40);
@@ -214,7 +225,7 @@ namespace Core {
             SleepMs(maxInitTime);
 
             uint8_t testData[2] = { 13, 37 };
-            ASSERT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+            ASSERT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
 
             ASSERT_EQ(testAdmin.Wait(initHandshakeValue), ::Thunder::Core::ERROR_NONE);
         };
@@ -231,7 +242,7 @@ namespace Core {
         uint8_t fullBufferSimulation[DATA_SIZE + 1
             + sizeof(::Thunder::Core::CyclicBuffer::control)];
 
-        ASSERT_EQ(_dispatcher->PushData(sizeof(fullBufferSimulation), fullBufferSimulation), ::Thunder::Core::ERROR_WRITE_ERROR);
+        ASSERT_EQ(Push(*_dispatcher, sizeof(fullBufferSimulation), fullBufferSimulation), ::Thunder::Core::ERROR_WRITE_ERROR);
     }
 
     TEST_F(Core_MessageDispatcher, OffsetCutPushDataShouldFlushOldDataIfDoesNotFitOffsetCut)
@@ -242,11 +253,11 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(fullBufferSimulation), fullBufferSimulation), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(fullBufferSimulation), fullBufferSimulation), ::Thunder::Core::ERROR_NONE);
         // One element free space remaining
         // 2+2 bytes, 1 at tail position, 3 starting at position 0
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         // new data written, so the oldest data should be replaced
 
         // this is first entry and should be first popped (FIFO)
@@ -264,11 +275,11 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(onlyOffsetFitsSimulation), onlyOffsetFitsSimulation), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(onlyOffsetFitsSimulation), onlyOffsetFitsSimulation), ::Thunder::Core::ERROR_NONE);
         // Two elements free space remaining so offset of testData should fit at the end of the cyclic buffer,
         // and content of testData buffer should be at the beginning of the cyclic buffer
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         EXPECT_EQ(readLength, sizeof(testData));
@@ -283,11 +294,11 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(offsetPlusFitsSimulation), offsetPlusFitsSimulation), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(offsetPlusFitsSimulation), offsetPlusFitsSimulation), ::Thunder::Core::ERROR_NONE);
         // Three elements free space remaining, so the offset of testData should still fit at the end of the cyclic buffer,
         // as well as the first part of the testData buffer, but its second part should be at the beginning of the cyclic buffer
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
         EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
 
         EXPECT_EQ(readLength, sizeof(testData));
@@ -303,12 +314,12 @@ namespace Core {
         uint8_t readData[4];
         uint16_t readLength = sizeof(readData);
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(almostFullBufferSimulation), almostFullBufferSimulation), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(almostFullBufferSimulation), almostFullBufferSimulation), ::Thunder::Core::ERROR_NONE);
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(testData1), testData1), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(testData1), testData1), ::Thunder::Core::ERROR_NONE);
         // The cyclic buffer is now full
 
-        EXPECT_EQ(_dispatcher->PushData(sizeof(testData2), testData2), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(Push(*_dispatcher, sizeof(testData2), testData2), ::Thunder::Core::ERROR_NONE);
         // The cyclic buffer needs to flush the almostFullBufferSimulation to make space for testData2
 
         EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
@@ -322,6 +333,95 @@ namespace Core {
         EXPECT_EQ(readData[3], testData2[3]);
     }
 
+#ifdef MESSAGE_BATCHING_ENABLED
+    TEST_F(Core_MessageDispatcher, StagedDataIsPushedInOneBatchOnFlush)
+    {
+        uint8_t testData1[] = { 12, 11, 13, 21 };
+        uint8_t testData2[] = { 54, 62, 78 };
+        uint8_t readData[4];
+        uint16_t readLength = sizeof(readData);
+
+        EXPECT_EQ(_dispatcher->PushData(sizeof(testData1), testData1), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(_dispatcher->PushData(sizeof(testData2), testData2), ::Thunder::Core::ERROR_NONE);
+
+        // Still staged in this thread
+        EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_READ_ERROR);
+
+        _dispatcher->Flush();
+
+        readLength = sizeof(readData);
+        EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(readLength, sizeof(testData1));
+        EXPECT_EQ(readData[0], testData1[0]);
+        EXPECT_EQ(readData[3], testData1[3]);
+
+        readLength = sizeof(readData);
+        EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(readLength, sizeof(testData2));
+        EXPECT_EQ(readData[0], testData2[0]);
+        EXPECT_EQ(readData[2], testData2[2]);
+    }
+
+    TEST_F(Core_MessageDispatcher, StagedDataOfAnEndedThreadIsPushed)
+    {
+        uint8_t testData[] = { 13, 37 };
+        uint8_t readData[4];
+        uint16_t readLength = sizeof(readData);
+
+        std::thread writer([&]() {
+            EXPECT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        });
+        writer.join();
+
+        EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(readLength, sizeof(testData));
+        EXPECT_EQ(readData[0], testData[0]);
+        EXPECT_EQ(readData[1], testData[1]);
+    }
+
+    TEST_F(Core_MessageDispatcher, StagedDataIsPushedWhenTheThreadMovesToAnotherBuffer)
+    {
+        uint8_t testData[] = { 13, 37 };
+        uint8_t readData[4];
+        uint16_t readLength = sizeof(readData);
+
+        ::Thunder::Messaging::MessageDataBuffer other(_identifier, _instanceId + 1000, _basePath, DATA_SIZE, 0, true);
+        ASSERT_TRUE(other.IsValid());
+
+        EXPECT_EQ(_dispatcher->PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_TRUE(_dispatcher->HasStaged());
+
+        // This thread now stages for the other buffer, what it had staged so far should not get lost.
+        EXPECT_EQ(other.PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_FALSE(_dispatcher->HasStaged());
+        EXPECT_TRUE(other.HasStaged());
+
+        EXPECT_EQ(_dispatcher->PopData(readLength, readData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(readLength, sizeof(testData));
+        EXPECT_EQ(readData[0], testData[0]);
+        EXPECT_EQ(readData[1], testData[1]);
+    }
+
+    TEST_F(Core_MessageDispatcher, StagedDataThatCannotBeWrittenIsReported)
+    {
+        uint8_t testData[] = { 13, 37 };
+
+        // The server side never created this one, so there is no buffer to move the stage into.
+        ::Thunder::Messaging::MessageDataBuffer client(_identifier, _instanceId + 2000, _basePath, DATA_SIZE, 0, false);
+        ASSERT_FALSE(client.IsValid());
+
+        EXPECT_EQ(client.PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(client.PushData(sizeof(testData), testData), ::Thunder::Core::ERROR_NONE);
+        EXPECT_EQ(client.Dropped(), 0u);
+
+        EXPECT_EQ(client.Flush(), ::Thunder::Core::ERROR_WRITE_ERROR);
+        EXPECT_EQ(client.Dropped(), 2u);
+
+        // Nothing left to lose.
+        EXPECT_EQ(client.Flush(), ::Thunder::Core::ERROR_NONE);
+    }
+#endif
+
 } // Core
 } // Tests
 } // Thunder
@@ -977,6 +977,7 @@ PRINT_MODULES(__PRETTY_FUNCTION__, modules);
         ::Thunder::Core::Messaging::IStore::Tracing info(::Thunder::Core::Messaging::MessageInfo(metadata, ::Thunder::Core::Time::Now().Ticks()), _T("some_file"), 1337, EXPAND_AND_QUOTE(MODULE_NAME));
 
         ::Thunder::Messaging::MessageUnit::Instance().Push(info, &tm);
+        ::Thunder::Messaging::MessageUnit::Instance().Flush();
 
         // Instead 'flush' and continue
         client.SkipWaiting();
@@ -1082,6 +1083,51 @@ PRINT_MODULES(__PRETTY_FUNCTION__, modules);
         ::Thunder::Core::Singleton::Dispose();
     }
 
+    TEST(Core_Messaging_TextMessage, DeferredArgumentsRenderLikePrintf)
+    {
+        const TCHAR format[] = _T("%d|%-5i|%*u|%%|%s|%c|%08.3f|%llx|%lu|%s|%hhd");
+        string arguments;
+
+        ::Thunder::Core::Messaging::Formats::Pack(arguments, -42, 7, 6, 123u, "text", 'c', 3.14159, 0xBEEFULL, static_cast<unsigned long>(~0UL), static_cast<const char*>(nullptr), static_cast<int8_t>(-3));
+
+        string result;
+        ::Thunder::Core::Messaging::Formats::Render(result, format, arguments);
+
+        TCHAR expected[128];
+        ::snprintf(expected, sizeof(expected), "%d|%-5i|%*u|%%|%s|%c|%08.3f|%llx|%lu|%s|%hhd", -42, 7, 6, 123u, "text", 'c', 3.14159, 0xBEEFULL, static_cast<unsigned long>(~0UL), "(null)", static_cast<int8_t>(-3));
+
+        EXPECT_STREQ(result.c_str(), expected);
+
+        // Running out of arguments is not fatal
+        ::Thunder::Core::Messaging::Formats::Render(result, _T("%d and %d"), string());
+        EXPECT_STREQ(result.c_str(), _T("<?> and <?>"));
+    }
+
+    TEST(Core_Messaging_TextMessage, DeferredTextSurvivesSerialization)
+    {
+        ::Thunder::Trace::Information category(_T("value %d of %s at %5.2f"), 42, "text", 3.14159);
+        ::Thunder::Core::Messaging::TextMessage message(category);
+
+        uint8_t buffer[256];
+        const uint16_t length = message.Serialize(buffer, sizeof(buffer));
+        ASSERT_NE(length, 0);
+
+        ::Thunder::Core::Messaging::TextMessage received;
+        EXPECT_EQ(received.Deserialize(buffer, length), length);
+
+        if (received.Deferred() != 0) {
+            // Written by this process, so the format is known here as well
+            string format;
+            EXPECT_TRUE(::Thunder::Core::Messaging::Formats::Lookup(received.Deferred(), format));
+            EXPECT_STREQ(format.c_str(), _T("value %d of %s at %5.2f"));
+            received.Render(format);
+        }
+
+        EXPECT_STREQ(received.Data().c_str(), _T("value 42 of text at  3.14"));
+        EXPECT_STREQ(category.Data(), _T("value 42 of text at  3.14"));
+        EXPECT_STREQ(message.Data().c_str(), _T("value 42 of text at  3.14"));
+    }
+
 } // Core
 } // Tests
 } // Thunder
@@ -0,0 +1,131 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#ifndef MODULE_NAME
+#include "../Module.h"
+#endif
+
+#include <core/core.h>
+
+#include <thread>
+
+namespace Thunder {
+namespace Tests {
+namespace Core {
+
+    class ProxyPayload {
+    public:
+        ProxyPayload(const uint32_t value)
+            : _value(value)
+        {
+        }
+        ~ProxyPayload() = default;
+
+    public:
+        uint32_t Value() const
+        {
+            return (_value);
+        }
+
+    private:
+        uint32_t _value;
+    };
+
+    TEST(test_proxytype, create_and_release)
+    {
+        std::vector< ::Thunder::Core::ProxyType<ProxyPayload>> objects;
+
+        for (uint32_t index = 0; index < 200; index++) {
+            objects.push_back(::Thunder::Core::ProxyType<ProxyPayload>::Create(index));
+        }
+
+        for (uint32_t index = 0; index < objects.size(); index++) {
+            EXPECT_EQ(objects[index]->Value(), index);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(&(*objects[index])) % alignof(ProxyPayload), 0u);
+        }
+
+        objects.clear();
+    }
+
+    TEST(test_proxytype, additional_size)
+    {
+        for (uint32_t size = 1; size < 16384; size *= 3) {
+            ::Thunder::Core::ProxyType<ProxyPayload> object(::Thunder::Core::ProxyType<ProxyPayload>::CreateEx(size, size));
+
+            ASSERT_TRUE(object.IsValid());
+            EXPECT_EQ(object->Value(), size);
+        }
+    }
+
+    TEST(test_proxytype, release_on_other_thread)
+    {
+        std::vector< ::Thunder::Core::ProxyType<ProxyPayload>> objects;
+
+        for (uint32_t index = 0; index < 1000; index++) {
+            objects.push_back(::Thunder::Core::ProxyType<ProxyPayload>::Create(index));
+        }
+
+        std::thread consumer([&objects]() {
+            objects.clear();
+        });
+        consumer.join();
+
+        EXPECT_TRUE(objects.empty());
+
+        // Blocks handed back by the other thread must be reusable here.
+        ::Thunder::Core::ProxyType<ProxyPayload> object(::Thunder::Core::ProxyType<ProxyPayload>::Create(42));
+        EXPECT_EQ(object->Value(), 42u);
+    }
+
+#ifdef __CORE_PROXY_SLAB_ALLOCATOR__
+    TEST(test_proxytype, slab_statistics)
+    {
+        ::Thunder::Core::ProxyAllocator::Statistics before[::Thunder::Core::ProxyAllocator::Classes];
+        ::Thunder::Core::ProxyAllocator::Statistics after[::Thunder::Core::ProxyAllocator::Classes];
+
+        const uint32_t oversized = ::Thunder::Core::ProxyAllocator::Snapshot(before);
+
+        {
+            ::Thunder::Core::ProxyType<ProxyPayload> small(::Thunder::Core::ProxyType<ProxyPayload>::Create(1));
+            ::Thunder::Core::ProxyType<ProxyPayload> large(::Thunder::Core::ProxyType<ProxyPayload>::CreateEx(64 * 1024, 2));
+
+            EXPECT_EQ(::Thunder::Core::ProxyAllocator::Snapshot(after), oversized + 1);
+        }
+
+        uint32_t reserved = 0;
+
+        for (uint8_t index = 0; index < ::Thunder::Core::ProxyAllocator::Classes; index++) {
+            EXPECT_EQ(after[index].size, before[index].size);
+            EXPECT_GE(after[index].reserved, after[index].available);
+            reserved += after[index].reserved;
+
+            if (index > 0) {
+                EXPECT_GT(after[index].size, after[index - 1].size);
+            }
+        }
+
+        EXPECT_GT(reserved, 0u);
+    }
+#endif
+
+} // Core
+} // Tests
+} // Thunder
@@ -44,6 +44,176 @@ TEST(test_queue, simple_queue)
     obj1.Flush();
 }
 
+TEST(test_queue, lockfree_queue)
+{
+    ::Thunder::Core::LockFreeQueueType<int> obj1(2);
+    EXPECT_TRUE(obj1.Insert(20,300));
+    EXPECT_TRUE(obj1.Insert(30,300));
+    EXPECT_TRUE(obj1.IsFull());
+    EXPECT_FALSE(obj1.Insert(40,100));
+    EXPECT_TRUE(obj1.Post(40));
+    EXPECT_TRUE(obj1.HasEntry(30));
+    EXPECT_TRUE(obj1.Remove(30));
+    EXPECT_FALSE(obj1.HasEntry(30));
+    EXPECT_FALSE(obj1.Remove(30));
+    EXPECT_EQ(obj1.Length(),2u);
+
+    int total = 0;
+    obj1.Visit([&total](const int& element) { total += element; });
+    EXPECT_EQ(total, 60);
+
+    int a_Result = 0;
+    EXPECT_TRUE(obj1.Extract(a_Result,300));
+    EXPECT_EQ(a_Result, 20);
+    EXPECT_TRUE(obj1.Extract(a_Result,300));
+    EXPECT_EQ(a_Result, 40);
+    EXPECT_FALSE(obj1.Extract(a_Result,100));
+    EXPECT_TRUE(obj1.IsEmpty());
+
+    obj1.Post(50);
+    obj1.Disable();
+    EXPECT_FALSE(obj1.Post(60));
+    EXPECT_FALSE(obj1.Extract(a_Result,300));
+    obj1.Flush();
+    EXPECT_EQ(obj1.Length(),0u);
+    obj1.Enable();
+    EXPECT_TRUE(obj1.Post(70));
+    EXPECT_TRUE(obj1.Extract(a_Result,300));
+    EXPECT_EQ(a_Result, 70);
+}
+
+TEST(test_queue, lockfree_queue_concurrent)
+{
+    constexpr uint32_t Entries = 20000;
+    ::Thunder::Core::LockFreeQueueType<uint32_t> queue(16);
+    std::atomic<uint64_t> sum(0);
+    std::atomic<uint32_t> received(0);
+
+    std::vector<std::thread> threads;
+
+    for (uint8_t index = 0; index < 3; index++) {
+        threads.emplace_back([&]() {
+            uint32_t value;
+            while (queue.Extract(value, ::Thunder::Core::infinite) == true) {
+                sum += value;
+                if (++received == (2 * Entries)) {
+                    queue.Disable();
+                }
+            }
+        });
+    }
+    for (uint8_t index = 0; index < 2; index++) {
+        threads.emplace_back([&]() {
+            for (uint32_t value = 1; value <= Entries; value++) {
+                EXPECT_TRUE(queue.Insert(value, ::Thunder::Core::infinite));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(received.load(), 2 * Entries);
+    EXPECT_EQ(sum.load(), static_cast<uint64_t>(Entries) * (Entries + 1));
+}
+
+namespace {
+
+    // Tracks the moment an entry is handed over to a consumer: assigning into a "sink" marks the value as taken.
+    class Tracked {
+    public:
+        Tracked()
+            : _value(0)
+            , _taken(nullptr)
+        {
+        }
+        Tracked(const uint32_t value)
+            : _value(value)
+            , _taken(nullptr)
+        {
+        }
+        Tracked(std::atomic<bool>* taken)
+            : _value(0)
+            , _taken(taken)
+        {
+        }
+        Tracked(const Tracked& copy)
+            : _value(copy._value)
+            , _taken(nullptr)
+        {
+        }
+        Tracked& operator=(const Tracked& rhs)
+        {
+            if ((_taken != nullptr) && (rhs._value != 0)) {
+                // A slow handover, makes it more likely someone looks at the queue in the meantime.
+                std::this_thread::yield();
+                _taken[rhs._value].store(true);
+            }
+
+            _value = rhs._value;
+
+            return (*this);
+        }
+        bool operator==(const Tracked& rhs) const
+        {
+            return (_value == rhs._value);
+        }
+
+    private:
+        uint32_t _value;
+        std::atomic<bool>* _taken;
+    };
+
+}
+
+TEST(test_queue, lockfree_queue_remove_during_extract)
+{
+    constexpr uint32_t Entries = 20000;
+    ::Thunder::Core::LockFreeQueueType<Tracked> queue(16);
+    std::unique_ptr<std::atomic<bool>[]> taken(new std::atomic<bool>[Entries + 1]);
+    std::atomic<uint32_t> extracted(0);
+    uint32_t removed = 0;
+
+    for (uint32_t index = 0; index <= Entries; index++) {
+        taken[index].store(false);
+    }
+
+    std::vector<std::thread> threads;
+
+    for (uint8_t index = 0; index < 3; index++) {
+        threads.emplace_back([&]() {
+            Tracked value(taken.get());
+            while (queue.Extract(value, ::Thunder::Core::infinite) == true) {
+                extracted++;
+            }
+        });
+    }
+
+    // Like a Revoke: whatever can not be removed anymore, must have been handed over already.
+    for (uint32_t value = 1; value <= Entries; value++) {
+        EXPECT_TRUE(queue.Post(Tracked(value)));
+
+        if (queue.Remove(Tracked(value)) == true) {
+            removed++;
+        }
+        else {
+            EXPECT_TRUE(taken[value].load()) << value;
+        }
+    }
+
+    while ((removed + extracted.load()) != Entries) {
+        std::this_thread::yield();
+    }
+
+    queue.Disable();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(removed + extracted.load(), Entries);
+}
+
 } // Core
 } // Tests
 } // Thunder
@@ -285,6 +285,11 @@ namespace Exchange {
             Thunder::Tests::Core::Exchange::IAdder* adder = client->Open<Thunder::Tests::Core::Exchange::IAdder>(_T("Adder"));
             ASSERT_TRUE(adder != nullptr);
 
+#if defined(__CORE_COMRPC_SHARED_MEMORY__)
+            // The calls should take the shared memory rings offered in the announce message.
+            EXPECT_TRUE(client->IsShared());
+#endif
+
             // Perform some arithmatic.
             EXPECT_EQ(adder->GetValue(), static_cast<uint32_t>(0));
             adder->Add(20);
@@ -176,6 +176,174 @@ namespace Core {
         timer.Flush();
     }
 
+    class SequenceHandler {
+    public:
+        SequenceHandler() = delete;
+        SequenceHandler& operator=(const SequenceHandler&) = delete;
+
+        SequenceHandler(const uint32_t id, const uint64_t scheduled)
+            : _id(id)
+            , _scheduled(scheduled)
+        {
+        }
+        SequenceHandler(const SequenceHandler& copy) = default;
+        SequenceHandler(SequenceHandler&& move) = default;
+        ~SequenceHandler() = default;
+
+    public:
+        bool operator==(const SequenceHandler& RHS) const
+        {
+            return (_id == RHS._id);
+        }
+        bool operator!=(const SequenceHandler& RHS) const
+        {
+            return (!operator==(RHS));
+        }
+        size_t Hash() const
+        {
+            return (_id);
+        }
+        uint64_t Timed(const uint64_t scheduledTime)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+
+            EXPECT_EQ(scheduledTime, _scheduled);
+            EXPECT_GE(::Thunder::Core::Time::Now().Ticks(), _scheduled);
+
+            _fired.push_back(_scheduled);
+
+            lock.unlock();
+
+            _cv.notify_one();
+
+            return (0);
+        }
+
+        static void Reset()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _fired.clear();
+        }
+        static bool Wait(const size_t count, const uint32_t milliseconds)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            return (_cv.wait_for(lock, std::chrono::milliseconds(milliseconds), [count]() { return (_fired.size() >= count); }));
+        }
+        static std::vector<uint64_t> Fired()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            return (_fired);
+        }
+
+    private:
+        uint32_t _id;
+        uint64_t _scheduled;
+
+        static std::vector<uint64_t> _fired;
+        static std::mutex _mutex;
+        static std::condition_variable _cv;
+    };
+
+    std::vector<uint64_t> SequenceHandler::_fired;
+    std::mutex SequenceHandler::_mutex;
+    std::condition_variable SequenceHandler::_cv;
+
+    template <template <typename, typename> class PENDING>
+    void CheckTimerSequence()
+    {
+        constexpr uint32_t entries = 200;
+
+        ::Thunder::Core::TimerType<SequenceHandler, PENDING> timer(::Thunder::Core::Thread::DefaultStackSize(), _T("SequenceTimer"));
+
+        SequenceHandler::Reset();
+
+        const uint64_t now = ::Thunder::Core::Time::Now().Ticks();
+
+        // Spread the entries in a scrambled order over the first two levels of a wheel.
+        for (uint32_t index = 0; index < entries; index++) {
+            const uint64_t scheduled = now + (((index * 7919) % 600) * ::Thunder::Core::Time::TicksPerMillisecond) + index;
+            timer.Schedule(scheduled, SequenceHandler(index, scheduled));
+        }
+
+        EXPECT_EQ(timer.Pending(), entries);
+        EXPECT_TRUE(SequenceHandler::Wait(entries, 5000));
+
+        std::vector<uint64_t> fired(SequenceHandler::Fired());
+
+        ASSERT_EQ(fired.size(), entries);
+
+        // Entries may only be reordered within the resolution of the timer.
+        for (uint32_t index = 1; index < entries; index++) {
+            EXPECT_LT(fired[index - 1], fired[index] + ::Thunder::Core::Time::TicksPerMillisecond);
+        }
+
+        timer.Flush();
+    }
+
+    template <template <typename, typename> class PENDING>
+    void CheckTimerRevoke()
+    {
+        constexpr uint32_t entries = 1000;
+
+        ::Thunder::Core::TimerType<SequenceHandler, PENDING> timer(::Thunder::Core::Thread::DefaultStackSize(), _T("RevokeTimer"));
+
+        SequenceHandler::Reset();
+
+        const uint64_t now = ::Thunder::Core::Time::Now().Ticks();
+
+        // Spread the entries over all levels of a wheel, and beyond.
+        for (uint32_t index = 0; index < entries; index++) {
+            const uint64_t scheduled = now + ((1ULL << (index % 40)) * ::Thunder::Core::Time::TicksPerMillisecond) + (10000 * ::Thunder::Core::Time::TicksPerMillisecond);
+            timer.Schedule(scheduled, SequenceHandler(index, scheduled));
+        }
+
+        EXPECT_EQ(timer.Pending(), entries);
+
+        for (uint32_t index = 0; index < entries; index += 2) {
+            EXPECT_TRUE(timer.Revoke(SequenceHandler(index, 0)));
+        }
+        for (uint32_t index = 0; index < entries; index++) {
+            EXPECT_EQ(timer.HasEntry(SequenceHandler(index, 0)), ((index & 1) == 1));
+        }
+
+        EXPECT_FALSE(timer.Revoke(SequenceHandler(0, 0)));
+        EXPECT_EQ(timer.Pending(), entries / 2);
+
+        // Move one of them to the front, it should fire on its own.
+        const uint64_t soon = ::Thunder::Core::Time::Now().Ticks() + (50 * ::Thunder::Core::Time::TicksPerMillisecond);
+        timer.Trigger(soon, SequenceHandler(1, soon));
+
+        EXPECT_EQ(timer.Pending(), entries / 2);
+        EXPECT_TRUE(SequenceHandler::Wait(1, 2000));
+        EXPECT_FALSE(timer.HasEntry(SequenceHandler(1, 0)));
+        EXPECT_EQ(timer.Pending(), (entries / 2) - 1);
+
+        timer.Flush();
+
+        EXPECT_EQ(timer.Pending(), 0u);
+        EXPECT_EQ(SequenceHandler::Fired().size(), 1u);
+    }
+
+    TEST(Core_Timer, SequenceList)
+    {
+        CheckTimerSequence<::Thunder::Core::TimerListType>();
+    }
+
+    TEST(Core_Timer, SequenceWheel)
+    {
+        CheckTimerSequence<::Thunder::Core::TimerWheelType>();
+    }
+
+    TEST(Core_Timer, RevokeList)
+    {
+        CheckTimerRevoke<::Thunder::Core::TimerListType>();
+    }
+
+    TEST(Core_Timer, RevokeWheel)
+    {
+        CheckTimerRevoke<::Thunder::Core::TimerWheelType>();
+    }
+
     TEST(Core_Timer, WatchDogType)
     {
         WatchDogHandler timer;
@@ -228,6 +228,272 @@ namespace Core {
         ::Thunder::Core::Singleton::Dispose();
     }
 
+    class FileSerializer : public Web::Response::Serializer {
+    public:
+        FileSerializer() = delete;
+        FileSerializer(const FileSerializer&) = delete;
+        FileSerializer& operator=(const FileSerializer&) = delete;
+
+        FileSerializer(const bool splice)
+            : _splice(splice)
+            , _offset(~0)
+            , _length(0)
+            , _serialized(false)
+        {
+        }
+        ~FileSerializer() override = default;
+
+    public:
+        void Serialized(const Web::Response&) override
+        {
+            _serialized = true;
+        }
+        bool Splice(const ::Thunder::Core::File::Handle, const uint64_t offset, const uint32_t length) override
+        {
+            _offset = offset;
+            _length = length;
+
+            return (_splice);
+        }
+
+        bool _splice;
+        uint64_t _offset;
+        uint32_t _length;
+        bool _serialized;
+    };
+
+    TEST(WebLink, FileBody)
+    {
+        const string content = "Just a file to send";
+
+        ::Thunder::Core::File file("WebLinkFileBody.txt");
+
+        ASSERT_TRUE(file.Create());
+        EXPECT_EQ(file.Write(reinterpret_cast<const uint8_t*>(content.c_str()), static_cast<uint32_t>(content.length())), content.length());
+        file.Close();
+
+        for (const bool splice : { true, false }) {
+            FileSerializer serializer(splice);
+
+            ::Thunder::Core::ProxyType<Web::Response> response(::Thunder::Core::ProxyType<Web::Response>::Create());
+            ::Thunder::Core::ProxyType<Web::FileBody> body(::Thunder::Core::ProxyType<Web::FileBody>::Create());
+
+            *body = file.Name();
+            response->ErrorCode = 200;
+            response->Body<Web::FileBody>(body);
+
+            serializer.Submit(*response);
+
+            uint8_t buffer[1024];
+            uint16_t length = serializer.Serialize(buffer, sizeof(buffer));
+            const string message(reinterpret_cast<const char*>(buffer), length);
+
+            EXPECT_EQ(serializer._offset, 0u);
+            EXPECT_EQ(serializer._length, content.length());
+            EXPECT_NE(message.find("Content-Length: 19\r\n"), string::npos);
+
+            if (splice == true) {
+                // The link sends the file after the headers.
+                EXPECT_EQ(message.substr(message.length() - 4), "\r\n\r\n");
+            } else {
+                EXPECT_EQ(message.substr(message.length() - content.length() - 4), "\r\n\r\n" + content);
+            }
+
+            EXPECT_FALSE(serializer._serialized);
+            EXPECT_EQ(serializer.Serialize(buffer, sizeof(buffer)), 0);
+            EXPECT_TRUE(serializer._serialized);
+            EXPECT_FALSE(body->IsOpen());
+        }
+
+        EXPECT_TRUE(file.Destroy());
+    }
+
+    class RequestParser : public Web::Request::Deserializer {
+    public:
+        RequestParser(const RequestParser&) = delete;
+        RequestParser& operator=(const RequestParser&) = delete;
+
+        RequestParser() = default;
+        ~RequestParser() override = default;
+
+    public:
+        void Deserialized(Web::Request& element VARIABLE_IS_NOT_USED) override
+        {
+            _complete++;
+        }
+        Web::Request* Element() override
+        {
+            _requests.push_back(::Thunder::Core::ProxyType<Web::Request>::Create());
+            return (&(*_requests.back()));
+        }
+        bool LinkBody(Web::Request& element) override
+        {
+            element.Body<Web::TextBody>(::Thunder::Core::ProxyType<Web::TextBody>::Create());
+            return (true);
+        }
+
+    public:
+        std::vector<::Thunder::Core::ProxyType<Web::Request>> _requests;
+        uint32_t _complete = 0;
+    };
+
+    TEST(WebLink, TextBodyInWindows)
+    {
+        Web::TextBody text;
+        Web::IBody& body(text);
+        text = _T("0123456789abcdef");
+
+        uint8_t buffer[5];
+        string result;
+
+        // Every call continues where the previous one stopped, the last one returns what is left.
+        EXPECT_EQ(body.Serialize(), 16u);
+        for (const uint32_t expected : { 5u, 5u, 5u, 1u, 0u }) {
+            const uint32_t loaded = body.Serialize(buffer, static_cast<uint32_t>(sizeof(buffer)));
+
+            EXPECT_EQ(loaded, expected);
+            result.append(reinterpret_cast<const char*>(buffer), loaded);
+        }
+        body.End();
+
+        EXPECT_EQ(result, _T("0123456789abcdef"));
+    }
+
+    TEST(WebLink, RequestParser)
+    {
+        const string message =
+            "GET /Service/Controller?first=1&second=2#top HTTP/1.1\r\n"
+            "host: localhost:80\r\n"
+            "X-Unknown: ignored\r\n"
+            "Accept-Encoding: deflate, gzip\r\n"
+            "If-None-Match: \"1234-56\", W/\"78\"\r\n"
+            "Connection: keep-alive\r\n"
+            "\r\n"
+            "POST /Service/Controller/Activate HTTP/1.0\r\n"
+            "Content-Length:  5 \r\n"
+            "\r\n"
+            "hello"
+            "DELETE /Service#only HTTP/1.1\r\n"
+            "\r\n";
+
+        // In one go the header blocks are scanned in place, byte by byte they go through the parser.
+        for (const uint16_t step : { static_cast<uint16_t>(message.length()), static_cast<uint16_t>(1) }) {
+            RequestParser parser;
+            uint16_t offset = 0;
+
+            while (offset < message.length()) {
+                const uint16_t length = std::min(step, static_cast<uint16_t>(message.length() - offset));
+
+                EXPECT_EQ(parser.Deserialize(reinterpret_cast<const uint8_t*>(&message[offset]), length), length);
+                offset += length;
+            }
+
+            ASSERT_EQ(parser._requests.size(), 3u);
+            EXPECT_EQ(parser._complete, 3u);
+
+            const Web::Request& get(*parser._requests[0]);
+            EXPECT_EQ(get.Verb, Web::Request::HTTP_GET);
+            EXPECT_EQ(get.Path, "/Service/Controller");
+            EXPECT_EQ(get.Query.Value(), "first=1&second=2");
+            EXPECT_EQ(get.Fragment.Value(), "top");
+            EXPECT_EQ(get.MajorVersion, 1);
+            EXPECT_EQ(get.MinorVersion, 1);
+            EXPECT_EQ(get.Host.Value(), "localhost:80");
+            EXPECT_EQ(get.AcceptEncoding.Value(), Web::ENCODING_GZIP);
+            EXPECT_EQ(get.Connection.Value(), Web::Request::CONNECTION_KEEPALIVE);
+            // Both ways, the value starts out quoted, so it loses that first pair of quotes only.
+            EXPECT_EQ(get.IfNoneMatch.Value(), "1234-56, W/\"78\"");
+
+            const Web::Request& post(*parser._requests[1]);
+            EXPECT_EQ(post.Verb, Web::Request::HTTP_POST);
+            EXPECT_EQ(post.Path, "/Service/Controller/Activate");
+            EXPECT_FALSE(post.Query.IsSet());
+            EXPECT_EQ(post.MinorVersion, 0);
+            EXPECT_EQ(post.ContentLength.Value(), 5u);
+            EXPECT_FALSE(post.Host.IsSet());
+            EXPECT_EQ(static_cast<const string&>(*(post.Body<Web::TextBody>())), "hello");
+
+            const Web::Request& remove(*parser._requests[2]);
+            EXPECT_EQ(remove.Verb, Web::Request::HTTP_DELETE);
+            EXPECT_EQ(remove.Path, "/Service");
+            EXPECT_FALSE(remove.Query.IsSet());
+            EXPECT_EQ(remove.Fragment.Value(), "only");
+        }
+    }
+
+    TEST(WebLink, ConditionalRequest)
+    {
+        const string message =
+            "GET /index.html HTTP/1.1\r\n"
+            "If-None-Match: \"1234-56\", W/\"78\"\r\n"
+            "\r\n"
+            "GET /index.html HTTP/1.1\r\n"
+            "If-None-Match: *\r\n"
+            "\r\n"
+            "GET /index.html HTTP/1.1\r\n"
+            "If-None-Match: \"9a\"\r\n"
+            "If-Modified-Since: Tue, 15 Nov 1994 08:12:31 GMT\r\n"
+            "\r\n"
+            "GET /index.html HTTP/1.1\r\n"
+            "If-Modified-Since: Tue, 15 Nov 1994 08:12:31 GMT\r\n"
+            "\r\n"
+            "GET /index.html HTTP/1.1\r\n"
+            "\r\n";
+
+        RequestParser parser;
+
+        EXPECT_EQ(parser.Deserialize(reinterpret_cast<const uint8_t*>(message.c_str()), static_cast<uint16_t>(message.length())), message.length());
+        ASSERT_EQ(parser._requests.size(), 5u);
+
+        const ::Thunder::Core::Time modified(1994, 11, 15, 8, 12, 31, 0, false);
+        const ::Thunder::Core::Time later(1994, 11, 15, 8, 12, 32, 0, false);
+
+        // Strong and weak tags in the list both match.
+        EXPECT_FALSE(parser._requests[0]->IsModified(_T("\"1234-56\""), later));
+        EXPECT_FALSE(parser._requests[0]->IsModified(_T("\"78\""), later));
+        EXPECT_TRUE(parser._requests[0]->IsModified(_T("\"9a\""), modified));
+
+        EXPECT_FALSE(parser._requests[1]->IsModified(_T("\"9a\""), later));
+
+        // If-None-Match takes precedence over If-Modified-Since.
+        EXPECT_TRUE(parser._requests[2]->IsModified(_T("\"78\""), modified));
+        EXPECT_FALSE(parser._requests[2]->IsModified(_T("\"9a\""), later));
+
+        ASSERT_TRUE(parser._requests[3]->IfModifiedSince.IsSet());
+        EXPECT_FALSE(parser._requests[3]->IsModified(_T("\"9a\""), modified));
+        EXPECT_FALSE(parser._requests[3]->IsModified(_T("\"9a\""), ::Thunder::Core::Time(modified).Add(500)));
+        EXPECT_TRUE(parser._requests[3]->IsModified(_T("\"9a\""), later));
+
+        EXPECT_TRUE(parser._requests[4]->IsModified(_T("\"9a\""), modified));
+    }
+
+    TEST(WebLink, NotModifiedResponse)
+    {
+        Web::Response response;
+        response.ErrorCode = Web::STATUS_NOT_MODIFIED;
+        response.Message = _T("Not Modified");
+        response.ETag = _T("\"1234-56\"");
+        response.Modified = ::Thunder::Core::Time(1994, 11, 15, 8, 12, 31, 0, false);
+        response.Vary = _T("Accept-Encoding");
+
+        string text;
+        response.ToString(text);
+
+        EXPECT_EQ(text.find(_T("HTTP/1.1 304 Not Modified\r\n")), 0u);
+        EXPECT_NE(text.find(_T("\r\nETag: \"1234-56\"\r\n")), string::npos);
+        EXPECT_NE(text.find(_T("\r\nLast-Modified: Tue, 15 Nov 1994 08:12:31 GMT\r\n")), string::npos);
+        EXPECT_NE(text.find(_T("\r\nVary: Accept-Encoding\r\n")), string::npos);
+
+        Web::Response parsed;
+        Web::Response::FromString(parsed, text);
+
+        EXPECT_EQ(parsed.ErrorCode, Web::STATUS_NOT_MODIFIED);
+        ASSERT_TRUE(parsed.Vary.IsSet());
+        EXPECT_EQ(parsed.Vary.Value(), _T("Accept-Encoding"));
+        ASSERT_TRUE(parsed.Modified.IsSet());
+        EXPECT_EQ(parsed.Modified.Value(), response.Modified.Value());
+    }
+
 } // Core
 } // Tests
 } // Thunder
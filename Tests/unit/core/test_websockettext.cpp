@@ -140,6 +140,303 @@ namespace Core {
         mutable ::Thunder::Core::Event _dataPending;
     };
 
+    // Sends the text it is asked for from its own memory, through SendPayload.
+    class PayloadSocketServer : public Web::WebSocketServerType<::Thunder::Core::SocketStream> {
+    private:
+        typedef Web::WebSocketServerType<::Thunder::Core::SocketStream> BaseClass;
+
+    public:
+        PayloadSocketServer() = delete;
+        PayloadSocketServer(const PayloadSocketServer&) = delete;
+        PayloadSocketServer& operator=(const PayloadSocketServer&) = delete;
+
+        PayloadSocketServer(const SOCKET& socket, const ::Thunder::Core::NodeId& remoteNode, ::Thunder::Core::SocketServerType<PayloadSocketServer>*)
+            : BaseClass(false, false, false, socket, remoteNode, 1024, 1024)
+            , _payload(200000, 'p')
+            , _pending(false)
+        {
+            _payload += '\n';
+        }
+        ~PayloadSocketServer() override = default;
+
+    public:
+        bool IsIdle() const override
+        {
+            return (_pending == false);
+        }
+        void StateChange() override
+        {
+        }
+        uint32_t SendData(uint8_t* /* dataFrame */, const uint32_t /* maxSendSize */) override
+        {
+            return (0);
+        }
+        uint32_t ReceiveData(uint8_t* /* dataFrame */, const uint32_t receivedSize) override
+        {
+            // Any request is answered with the payload.
+            _pending = true;
+            Trigger();
+
+            return (receivedSize);
+        }
+        uint32_t SendPayload(const uint8_t*& payload) override
+        {
+            uint32_t result = 0;
+
+            if (_pending == true) {
+                _pending = false;
+                payload = reinterpret_cast<const uint8_t*>(_payload.c_str());
+                result = static_cast<uint32_t>(_payload.length());
+            }
+
+            return (result);
+        }
+
+    private:
+        string _payload;
+        bool _pending;
+    };
+
+    TEST(WebSocket, TextPayload)
+    {
+        constexpr uint32_t initHandshakeValue = 0, maxWaitTime = 4, maxWaitTimeMs = 4000, maxInitTime = 2000;
+        constexpr uint8_t maxRetries = 1;
+
+        const std::string connector {"/tmp/wpewebsockettext1"};
+
+        IPTestAdministrator::Callback callback_child = [&](IPTestAdministrator& testAdmin) {
+            ::Thunder::Core::SocketServerType<PayloadSocketServer> payloadWebSocketServer(::Thunder::Core::NodeId(connector.c_str()));
+
+            ASSERT_EQ(payloadWebSocketServer.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            ASSERT_EQ(testAdmin.Wait(initHandshakeValue), ::Thunder::Core::ERROR_NONE);
+            ASSERT_EQ(testAdmin.Wait(initHandshakeValue), ::Thunder::Core::ERROR_NONE);
+
+            ASSERT_EQ(payloadWebSocketServer.Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator::Callback callback_parent = [&](IPTestAdministrator& testAdmin) {
+            // a small delay so the child can be set up
+            SleepMs(maxInitTime);
+
+            ASSERT_EQ(testAdmin.Signal(initHandshakeValue, maxRetries), ::Thunder::Core::ERROR_NONE);
+
+            TextSocketClient textWebSocketClient(::Thunder::Core::NodeId(connector.c_str()));
+
+            ASSERT_EQ(textWebSocketClient.Open(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            ASSERT_TRUE(textWebSocketClient.IsOpen());
+
+            textWebSocketClient.Submit(string("payload"));
+
+            EXPECT_EQ(textWebSocketClient.Wait(), ::Thunder::Core::ERROR_NONE);
+
+            string received;
+
+            textWebSocketClient.Retrieve(received);
+
+            EXPECT_EQ(received, string(200000, 'p'));
+
+            EXPECT_EQ(textWebSocketClient.Close(maxWaitTimeMs), ::Thunder::Core::ERROR_NONE);
+
+            ASSERT_EQ(testAdmin.Signal(initHandshakeValue, maxRetries), ::Thunder::Core::ERROR_NONE);
+        };
+
+        IPTestAdministrator testAdmin(callback_parent, callback_child, initHandshakeValue, maxWaitTime);
+
+        // Code after this line is executed by both parent and child
+
+        ::Thunder::Core::Singleton::Dispose();
+    }
+
+    TEST(WebSocket, DeflateNegotiation)
+    {
+        Web::WebSocket::Deflate::Settings clientSettings;
+        clientSettings.clientNoContextTakeover = true;
+
+        Web::WebSocket::Deflate::Settings serverSettings;
+        serverSettings.clientMaxWindowBits = 12;
+
+        Web::WebSocket::Deflate client;
+        Web::WebSocket::Deflate server;
+
+        string response;
+
+        // Not configured, nothing is accepted.
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate"), response));
+        EXPECT_TRUE(response.empty());
+
+        client.Configure(clientSettings);
+        server.Configure(serverSettings);
+
+        const string offer = client.Offer();
+
+        EXPECT_EQ(offer, string(_T("permessage-deflate; client_max_window_bits; client_no_context_takeover")));
+
+        // A window of 2^8 can not be honoured, the next offer is taken.
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate; server_max_window_bits=8, x-webkit-deflate-frame, ") + offer, response));
+        EXPECT_EQ(response, string(_T("permessage-deflate; client_no_context_takeover; client_max_window_bits=12")));
+        EXPECT_TRUE(server.IsActive());
+
+        EXPECT_TRUE(client.Confirm(response));
+        EXPECT_TRUE(client.IsActive());
+
+        client.Reset();
+        server.Reset();
+
+        EXPECT_FALSE(client.IsActive());
+        EXPECT_FALSE(server.IsActive());
+
+        // Unknown or duplicate parameters are declined.
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate; level=9"), response));
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate; client_no_context_takeover; client_no_context_takeover"), response));
+        EXPECT_FALSE(client.Confirm(_T("permessage-deflate; client_max_window_bits=8")));
+        EXPECT_FALSE(client.Confirm(_T("x-webkit-deflate-frame")));
+
+        // No extension at all is fine, the link runs uncompressed.
+        EXPECT_TRUE(client.Confirm(string()));
+        EXPECT_FALSE(client.IsActive());
+    }
+
+    TEST(WebSocket, DeflateMessages)
+    {
+        Web::WebSocket::Deflate::Settings settings;
+        settings.serverNoContextTakeover = true;
+
+        Web::WebSocket::Deflate client;
+        Web::WebSocket::Deflate server;
+        string response;
+
+        client.Configure(settings);
+        server.Configure(settings);
+
+        ASSERT_TRUE(server.Accept(client.Offer(), response));
+        ASSERT_TRUE(client.Confirm(response));
+
+        string notification;
+
+        for (uint32_t index = 0; notification.length() < 100000; index++) {
+            notification += _T("{\"jsonrpc\":\"2.0\",\"method\":\"client.events.1.statechange\",\"params\":{\"index\":") + ::Thunder::Core::NumberType<uint32_t>(index).Text() + _T("}}");
+        }
+
+        // Twice, the second message is compressed with and without the history of the first.
+        for (uint8_t round = 0; round < 2; round++) {
+            Web::WebSocket::Deflate& sender = (round == 0 ? static_cast<Web::WebSocket::Deflate&>(server) : client);
+            Web::WebSocket::Deflate& receiver = (round == 0 ? static_cast<Web::WebSocket::Deflate&>(client) : server);
+
+            for (uint8_t message = 0; message < 2; message++) {
+                const uint8_t* data = reinterpret_cast<const uint8_t*>(notification.c_str());
+                uint32_t length = static_cast<uint32_t>(notification.length());
+                string received;
+                bool final = false;
+
+                // Compressed per fragment of at most 4KB, and framed in chunks of at most 1KB.
+                while (final == false) {
+                    const uint16_t fragment = static_cast<uint16_t>(std::min(length, static_cast<uint32_t>(4096)));
+
+                    sender.Compress(data, fragment, (fragment == length));
+
+                    data += fragment;
+                    length -= fragment;
+
+                    while (sender.Pending() != 0) {
+                        uint8_t frame[1024];
+                        uint8_t* inflated;
+                        uint16_t size;
+
+                        size = sender.Compressed(frame, sizeof(frame), final);
+
+                        receiver.Decompress(frame, size, final);
+
+                        while ((size = receiver.Decompressed(inflated)) != 0) {
+                            received.append(reinterpret_cast<const char*>(inflated), size);
+                        }
+                    }
+                }
+
+                EXPECT_EQ(received, notification);
+            }
+
+            const Web::WebSocket::Deflate::Statistics& sent = sender.Counters();
+            const Web::WebSocket::Deflate::Statistics& arrived = receiver.Counters();
+
+            EXPECT_EQ(sent.messagesOut, 2u);
+            EXPECT_EQ(sent.rawOut, (2 * notification.length()));
+            EXPECT_LT(sent.deflatedOut, (sent.rawOut / 4));
+            EXPECT_EQ(arrived.messagesIn, 2u);
+            EXPECT_EQ(arrived.rawIn, sent.rawOut);
+            EXPECT_EQ(arrived.deflatedIn, sent.deflatedOut);
+        }
+    }
+
+    TEST(WebSocket, DeflateFragmentBoundary)
+    {
+        Web::WebSocket::Deflate::Settings settings;
+
+        Web::WebSocket::Deflate client;
+        Web::WebSocket::Deflate server;
+        string response;
+
+        client.Configure(settings);
+        server.Configure(settings);
+
+        ASSERT_TRUE(server.Accept(client.Offer(), response));
+        ASSERT_TRUE(client.Confirm(response));
+
+        // Exactly three fragments, the sender only learns the message ended after the last full one.
+        const uint16_t capacity = 4096;
+        string message;
+
+        for (uint32_t index = 0; message.length() < (3 * capacity); index++) {
+            message += ::Thunder::Core::NumberType<uint32_t>(index).Text() + _T(",");
+        }
+        message.resize(3 * capacity);
+
+        for (uint8_t round = 0; round < 2; round++) {
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(message.c_str());
+            uint32_t length = static_cast<uint32_t>(message.length());
+            string received;
+            bool final = false;
+            uint32_t frames = 0;
+
+            while (final == false) {
+                const uint16_t fragment = static_cast<uint16_t>(std::min(length, static_cast<uint32_t>(capacity)));
+
+                server.Compress(data, fragment, (fragment < capacity));
+
+                data += fragment;
+                length -= fragment;
+
+                // The last Compress() has no input left, it must still close the message with a (tiny) final frame.
+                do {
+                    uint8_t frame[1024];
+                    uint8_t* inflated;
+                    uint16_t size;
+
+                    size = server.Compressed(frame, sizeof(frame), final);
+
+                    EXPECT_LE(size, sizeof(frame));
+
+                    client.Decompress(frame, size, final);
+                    frames++;
+
+                    while ((size = client.Decompressed(inflated)) != 0) {
+                        received.append(reinterpret_cast<const char*>(inflated), size);
+                    }
+                } while (server.Pending() != 0);
+
+                ASSERT_LT(frames, 100u);
+            }
+
+            EXPECT_EQ(server.Pending(), 0u);
+            EXPECT_EQ(received.length(), message.length());
+            EXPECT_TRUE(received == message);
+        }
+
+        EXPECT_EQ(server.Counters().messagesOut, 2u);
+        EXPECT_EQ(client.Counters().messagesIn, 2u);
+    }
+
     TEST(WebSocket, Text)
     {
         constexpr uint32_t initHandshakeValue = 0, VARIABLE_IS_NOT_USED maxWaitTime = 4, maxWaitTimeMs = 4000, maxInitTime = 2000;
@@ -1183,6 +1183,122 @@ namespace Core {
         workerPool.Stop();
         ::Thunder::Core::WorkerPool::Assign(nullptr);
     }
+    class ChainedJobTester : public EventControl {
+    public:
+        ChainedJobTester() = delete;
+        ChainedJobTester(const ChainedJobTester&) = delete;
+        ChainedJobTester& operator=(const ChainedJobTester&) = delete;
+
+        ChainedJobTester(const uint32_t length, ChainedJobTester* followUp = nullptr)
+            : _remaining(length)
+            , _runs(0)
+            , _followUp(followUp)
+            , _proceed()
+            , _job(*this)
+        {
+        }
+        ~ChainedJobTester()
+        {
+            _job.Revoke();
+        }
+
+    public:
+        bool Submit()
+        {
+            return _job.Submit();
+        }
+        void Revoke()
+        {
+            _job.Revoke();
+        }
+        void Proceed()
+        {
+            _proceed.Notify();
+        }
+        uint32_t Runs() const
+        {
+            return _runs;
+        }
+        void Dispatch()
+        {
+            _runs++;
+            if (_followUp != nullptr) {
+                // Submitted from a worker thread, wait till the test had a chance to revoke it.
+                _followUp->Submit();
+                Notify();
+                _proceed.WaitForEvent(MaxJobWaitTime);
+            } else if (--_remaining == 0) {
+                Notify();
+            } else {
+                _job.Submit();
+            }
+        }
+
+    private:
+        std::atomic<uint32_t> _remaining;
+        std::atomic<uint32_t> _runs;
+        ChainedJobTester* _followUp;
+        EventControl _proceed;
+        ::Thunder::Core::WorkerPool::JobType<ChainedJobTester&> _job;
+    };
+
+    TEST(Core_WorkerPool, Check_JobType_ChainedSubmit)
+    {
+        WorkerPoolTester workerPool(4, 0, 8);
+        ::Thunder::Core::WorkerPool::Assign(&workerPool);
+        workerPool.RunThreadPool();
+        {
+            ChainedJobTester first(1000);
+            ChainedJobTester second(1000);
+            first.Submit();
+            second.Submit();
+            EXPECT_EQ(first.WaitForEvent(MaxJobWaitTime * 3), ::Thunder::Core::ERROR_NONE);
+            EXPECT_EQ(second.WaitForEvent(MaxJobWaitTime * 3), ::Thunder::Core::ERROR_NONE);
+            EXPECT_EQ(first.Runs(), 1000u);
+            EXPECT_EQ(second.Runs(), 1000u);
+        }
+        workerPool.Stop();
+        ::Thunder::Core::WorkerPool::Assign(nullptr);
+    }
+    TEST(Core_WorkerPool, Check_JobType_ChainedSubmit_Revoke)
+    {
+        WorkerPoolTester workerPool(1, 0, 8);
+        ::Thunder::Core::WorkerPool::Assign(&workerPool);
+        workerPool.RunThreadPool();
+        {
+            ChainedJobTester followUp(1);
+            ChainedJobTester first(1, &followUp);
+            EXPECT_EQ(first.Submit(), true);
+            EXPECT_EQ(first.WaitForEvent(MaxJobWaitTime), ::Thunder::Core::ERROR_NONE);
+            followUp.Revoke();
+            first.Proceed();
+            EXPECT_EQ(followUp.WaitForEvent(MaxJobWaitTime), ::Thunder::Core::ERROR_TIMEDOUT);
+            EXPECT_EQ(followUp.Runs(), 0u);
+        }
+        workerPool.Stop();
+        ::Thunder::Core::WorkerPool::Assign(nullptr);
+    }
+    TEST(Core_WorkerPool, Check_JobType_ChainedSubmit_Stop)
+    {
+        WorkerPoolTester workerPool(1, 0, 8);
+        ::Thunder::Core::WorkerPool::Assign(&workerPool);
+        workerPool.RunThreadPool();
+        {
+            ChainedJobTester followUp(1);
+            ChainedJobTester first(1, &followUp);
+            EXPECT_EQ(first.Submit(), true);
+            EXPECT_EQ(first.WaitForEvent(MaxJobWaitTime), ::Thunder::Core::ERROR_NONE);
+
+            // Stop while the follow up is still pending, it should run before the worker stops.
+            std::thread stopper([&workerPool]() { workerPool.Stop(); });
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            first.Proceed();
+            stopper.join();
+
+            EXPECT_EQ(followUp.WaitForEvent(MaxJobWaitTime), ::Thunder::Core::ERROR_NONE);
+        }
+        ::Thunder::Core::WorkerPool::Assign(nullptr);
+    }
     void CheckJobType_Reschedule(const uint16_t scheduleTime, const uint16_t rescheduleTime)
     {
         WorkerPoolTester workerPool(4, 0, 1);
@@ -0,0 +1,147 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2021 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include "Module.h"
+
+using namespace Thunder;
+
+// Micro benchmark comparing the job queue flavours a ThreadPool can be built
+// with. Producers Insert jobs, consumers Extract them, just like the ResourceMonitor
+// and the Minions do. The payload is the same ProxyType<IDispatch> the pool uses.
+class QueueBenchmark {
+private:
+    class Job : public Core::IDispatch {
+    public:
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        Job() = default;
+        ~Job() override = default;
+
+        void Dispatch() override
+        {
+        }
+    };
+
+    using Element = Core::ProxyType<Core::IDispatch>;
+
+public:
+    QueueBenchmark(const QueueBenchmark&) = delete;
+    QueueBenchmark& operator=(const QueueBenchmark&) = delete;
+
+    QueueBenchmark(const uint32_t jobs)
+        : _jobs(jobs)
+        , _job(Element(Core::ProxyType<Job>::Create()))
+    {
+    }
+    ~QueueBenchmark() = default;
+
+public:
+    template <typename QUEUE>
+    uint64_t Run(const uint8_t producers, const uint8_t consumers)
+    {
+        QUEUE queue(64);
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t> extracted(0);
+        const uint32_t perProducer = Jobs(producers) / producers;
+        const uint32_t total = Jobs(producers);
+
+        const uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint8_t index = 0; index < consumers; index++) {
+            threads.emplace_back([&]() {
+                Element entry;
+                while (queue.Extract(entry, Core::infinite) == true) {
+                    entry.Release();
+                    if (extracted.fetch_add(1) == (total - 1)) {
+                        queue.Disable();
+                    }
+                }
+            });
+        }
+        for (uint8_t index = 0; index < producers; index++) {
+            threads.emplace_back([&]() {
+                for (uint32_t count = 0; count < perProducer; count++) {
+                    queue.Insert(_job, Core::infinite);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        return (Core::Time::Now().Ticks() - start);
+    }
+
+    void Report(const uint8_t producers, const uint8_t consumers)
+    {
+        const uint64_t locked = Run<Core::QueueType<Element>>(producers, consumers);
+        const uint64_t lockFree = Run<Core::LockFreeQueueType<Element>>(producers, consumers);
+
+        printf("%3d producers %3d consumers | QueueType %10.0f jobs/s | LockFreeQueueType %10.0f jobs/s | x%.2f\n",
+            producers, consumers,
+            Rate(producers, locked), Rate(producers, lockFree),
+            (lockFree != 0 ? static_cast<double>(locked) / static_cast<double>(lockFree) : 0.0));
+    }
+
+private:
+    // The jobs are evenly spread over the producers, the remainder is not inserted.
+    uint32_t Jobs(const uint8_t producers) const
+    {
+        return ((_jobs / producers) * producers);
+    }
+    double Rate(const uint8_t producers, const uint64_t ticks) const
+    {
+        return (ticks != 0 ? (static_cast<double>(Jobs(producers)) * Core::Time::TicksPerMillisecond * 1000) / static_cast<double>(ticks) : 0.0);
+    }
+
+private:
+    const uint32_t _jobs;
+    Element _job;
+};
+
+#ifdef __WINDOWS__
+int _tmain(int argc, _TCHAR* argv[])
+#else
+int main(int argc, char** argv)
+#endif
+{
+    uint32_t jobs = 1000000;
+
+    if (argc > 1) {
+        jobs = static_cast<uint32_t>(atoi(argv[1]));
+    }
+
+    printf("Inserting %u jobs through each queue.\n", jobs);
+
+    {
+        QueueBenchmark benchmark(jobs);
+
+        const uint8_t configurations[][2] = { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 4, 4 }, { 8, 8 } };
+
+        for (const auto& configuration : configurations) {
+            benchmark.Report(configuration[0], configuration[1]);
+        }
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}
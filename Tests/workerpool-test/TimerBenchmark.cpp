@@ -0,0 +1,188 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2021 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+#include "Module.h"
+
+using namespace Thunder;
+
+// Micro benchmark comparing the pending administrations a TimerType can be built
+// with. Entries are scheduled in a random order, like the WorkerPool does for
+// delayed jobs, after which they are either all revoked or all expired.
+class TimerBenchmark {
+private:
+    class Handler {
+    public:
+        Handler() = delete;
+        Handler& operator=(const Handler&) = delete;
+
+        Handler(const uint32_t id, std::atomic<uint32_t>& fired)
+            : _id(id)
+            , _fired(fired)
+        {
+        }
+        Handler(const Handler& copy) = default;
+        Handler(Handler&& move) = default;
+        ~Handler() = default;
+
+    public:
+        bool operator==(const Handler& RHS) const
+        {
+            return (_id == RHS._id);
+        }
+        bool operator!=(const Handler& RHS) const
+        {
+            return (!operator==(RHS));
+        }
+        size_t Hash() const
+        {
+            return (_id);
+        }
+        uint64_t Timed(const uint64_t /* scheduledTime */)
+        {
+            _fired++;
+            return (0);
+        }
+
+    private:
+        uint32_t _id;
+        std::atomic<uint32_t>& _fired;
+    };
+
+    struct Result {
+        uint64_t Schedule;
+        uint64_t Revoke;
+        uint64_t Expire;
+    };
+
+public:
+    TimerBenchmark(const TimerBenchmark&) = delete;
+    TimerBenchmark& operator=(const TimerBenchmark&) = delete;
+
+    TimerBenchmark(const uint32_t entries)
+        : _entries(entries)
+        , _offsets(entries)
+        , _order(entries)
+    {
+        std::mt19937 generator(entries);
+        std::uniform_int_distribution<uint32_t> spread(0, 1000 * Core::Time::TicksPerMillisecond);
+
+        for (uint32_t index = 0; index < _entries; index++) {
+            _offsets[index] = spread(generator);
+            _order[index] = index;
+        }
+
+        std::shuffle(_order.begin(), _order.end(), generator);
+    }
+    ~TimerBenchmark() = default;
+
+public:
+    template <template <typename, typename> class PENDING>
+    Result Run()
+    {
+        Result result;
+        std::atomic<uint32_t> fired(0);
+        Core::TimerType<Handler, PENDING> timer(Core::Thread::DefaultStackSize(), _T("TimerBenchmark"));
+
+        // Far enough in the future to not expire while we are revoking.
+        uint64_t base = Core::Time::Now().Ticks() + (60 * 1000 * Core::Time::TicksPerMillisecond);
+
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < _entries; index++) {
+            timer.Schedule(base + (_offsets[index] * 60), Handler(index, fired));
+        }
+        result.Schedule = Core::Time::Now().Ticks() - start;
+
+        start = Core::Time::Now().Ticks();
+        for (const uint32_t index : _order) {
+            timer.Revoke(Handler(index, fired));
+        }
+        result.Revoke = Core::Time::Now().Ticks() - start;
+
+        ASSERT(timer.Pending() == 0);
+
+        // Now let them all expire within a second.
+        base = Core::Time::Now().Ticks() + (100 * Core::Time::TicksPerMillisecond);
+        for (uint32_t index = 0; index < _entries; index++) {
+            timer.Schedule(base + _offsets[index], Handler(index, fired));
+        }
+        const uint64_t last = base + (1000 * Core::Time::TicksPerMillisecond);
+
+        while (fired.load() < _entries) {
+            SleepMs(1);
+        }
+        const uint64_t now = Core::Time::Now().Ticks();
+        result.Expire = (now > last ? now - last : 0);
+
+        return (result);
+    }
+
+    void Report()
+    {
+        const Result list = Run<Core::TimerListType>();
+        const Result wheel = Run<Core::TimerWheelType>();
+
+        printf("                 | %14s | %14s | %8s\n", "TimerListType", "TimerWheelType", "speedup");
+        Print("schedule (ms)", list.Schedule, wheel.Schedule);
+        Print("revoke (ms)", list.Revoke, wheel.Revoke);
+        Print("expire lag (ms)", list.Expire, wheel.Expire);
+    }
+
+private:
+    void Print(const char label[], const uint64_t list, const uint64_t wheel) const
+    {
+        printf("%16s | %14.2f | %14.2f | x%.2f\n", label,
+            Milliseconds(list), Milliseconds(wheel),
+            (wheel != 0 ? static_cast<double>(list) / static_cast<double>(wheel) : 0.0));
+    }
+    double Milliseconds(const uint64_t ticks) const
+    {
+        return (static_cast<double>(ticks) / Core::Time::TicksPerMillisecond);
+    }
+
+private:
+    const uint32_t _entries;
+    std::vector<uint32_t> _offsets;
+    std::vector<uint32_t> _order;
+};
+
+#ifdef __WINDOWS__
+int _tmain(int argc, _TCHAR* argv[])
+#else
+int main(int argc, char** argv)
+#endif
+{
+    uint32_t entries = 100000;
+
+    if (argc > 1) {
+        entries = static_cast<uint32_t>(atoi(argv[1]));
+    }
+
+    printf("Scheduling %u entries on each timer.\n", entries);
+
+    {
+        TimerBenchmark benchmark(entries);
+
+        benchmark.Report();
+    }
+
+    Core::Singleton::Dispose();
+
+    return (0);
+}